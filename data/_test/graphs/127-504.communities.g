@@ -0,0 +1,20 @@
+$`1`
+ [1]   2   9  11  17  18  20  22  24  31  42  43  47  54  58  62  66  70  71  79
+[20]  82  94  96  99 101 112 114 119 122 123 124
+
+$`2`
+ [1]   1   7  19  25  28  36  44  50  51  59  60  63  67  74  77  85  90  93  97
+[20] 102 107 108 111 113 115 118 127
+
+$`3`
+ [1]   5  10  21  27  29  32  34  46  52  55  56  57  64  68  72  81  83  84  88
+[20] 100 105 109 116 121 126
+
+$`4`
+ [1]   3  12  14  15  16  23  33  37  45  48  61  65  69  76  78  89  91  92  95
+[20]  98 103 104 110 125
+
+$`5`
+ [1]   4   6   8  13  26  30  35  38  39  40  41  49  53  73  75  80  86  87 106
+[20] 117 120
+
@@ -0,0 +1,15625 @@
+0 1 46
+0 2 22
+0 3 60
+0 4 59
+0 5 47
+0 6 4
+0 7 50
+0 8 41
+0 9 60
+0 10 49
+0 11 36
+0 13 26
+0 14 33
+0 15 29
+0 16 43
+0 17 41
+0 18 22
+0 19 51
+0 20 88
+0 21 50
+0 22 21
+0 23 50
+0 24 60
+0 25 56
+0 26 63
+0 27 5
+0 28 62
+0 29 45
+0 30 30
+0 31 70
+0 32 38
+0 33 76
+0 34 56
+0 35 9
+0 36 30
+0 37 60
+0 38 54
+0 39 49
+0 40 32
+0 41 52
+0 42 58
+0 43 15
+0 44 31
+0 45 77
+0 46 52
+0 47 26
+0 48 55
+0 49 19
+0 50 12
+0 51 60
+0 52 43
+0 53 52
+0 54 74
+0 55 39
+0 56 45
+0 57 52
+0 58 14
+0 59 26
+0 60 35
+0 61 60
+0 62 19
+0 63 49
+0 64 48
+0 65 47
+0 66 7
+0 67 74
+0 68 33
+0 69 43
+0 70 34
+0 71 61
+0 72 41
+0 73 4
+0 74 66
+0 75 32
+0 76 15
+0 77 39
+0 78 44
+0 79 43
+0 80 58
+0 81 39
+0 82 75
+0 83 56
+0 84 15
+0 86 46
+0 87 71
+0 88 24
+0 89 21
+0 90 25
+0 91 20
+0 92 16
+0 93 46
+0 94 40
+0 95 41
+0 96 3
+0 97 13
+0 98 42
+0 99 47
+0 100 46
+0 101 6
+0 102 38
+0 103 29
+0 104 63
+0 106 12
+0 107 22
+0 108 55
+0 109 33
+0 110 16
+0 111 49
+0 112 13
+0 113 44
+0 114 9
+0 115 64
+0 116 59
+0 117 1
+0 118 46
+0 119 42
+0 120 53
+0 121 48
+0 122 49
+0 123 47
+0 124 50
+0 125 58
+0 126 16
+1 0 38
+1 2 22
+1 3 75
+1 4 33
+1 5 62
+1 6 42
+1 7 65
+1 8 35
+1 9 31
+1 10 19
+1 11 45
+1 13 35
+1 14 22
+1 15 44
+1 16 20
+1 17 11
+1 18 28
+1 19 21
+1 20 65
+1 21 20
+1 22 36
+1 23 12
+1 24 75
+1 25 71
+1 26 43
+1 27 39
+1 28 47
+1 29 60
+1 30 7
+1 31 41
+1 32 48
+1 33 53
+1 34 71
+1 35 38
+1 36 36
+1 37 75
+1 38 69
+1 39 81
+1 40 65
+1 41 19
+1 42 29
+1 43 33
+1 44 46
+1 45 73
+1 46 28
+1 47 15
+1 48 70
+1 49 44
+1 50 29
+1 51 37
+1 52 58
+1 53 23
+1 54 48
+1 55 39
+1 56 41
+1 57 23
+1 58 40
+1 59 32
+1 60 34
+1 61 30
+1 62 35
+1 63 31
+1 64 37
+1 65 23
+1 66 36
+1 67 45
+1 68 22
+1 69 25
+1 70 48
+1 71 32
+1 72 56
+1 73 33
+1 74 81
+1 75 42
+1 76 21
+1 77 48
+1 78 29
+1 79 58
+1 80 29
+1 81 21
+1 82 63
+1 83 27
+1 84 44
+1 86 61
+1 87 45
+1 88 33
+1 89 44
+1 90 35
+1 91 39
+1 92 36
+1 93 16
+1 94 49
+1 95 18
+1 96 32
+1 97 46
+1 98 19
+1 99 43
+1 100 28
+1 101 35
+1 102 53
+1 103 18
+1 104 34
+1 106 30
+1 107 38
+1 108 43
+1 109 23
+1 110 22
+1 111 11
+1 112 31
+1 113 26
+1 114 38
+1 115 60
+1 116 74
+1 117 39
+1 118 28
+1 119 57
+1 120 38
+1 121 30
+1 122 29
+1 123 24
+1 124 40
+1 125 29
+1 126 34
+2 0 16
+2 1 53
+2 3 67
+2 4 66
+2 5 54
+2 6 20
+2 7 57
+2 8 48
+2 9 67
+2 10 56
+2 11 46
+2 13 36
+2 14 40
+2 15 36
+2 16 50
+2 17 48
+2 18 29
+2 19 58
+2 20 95
+2 21 57
+2 22 28
+2 23 57
+2 24 67
+2 25 63
+2 26 70
+2 27 17
+2 28 69
+2 29 52
+2 30 37
+2 31 77
+2 32 45
+2 33 83
+2 34 63
+2 35 16
+2 36 37
+2 37 67
+2 38 61
+2 39 61
+2 40 44
+2 41 59
+2 42 65
+2 43 22
+2 44 38
+2 45 84
+2 46 59
+2 47 33
+2 48 62
+2 49 26
+2 50 24
+2 51 67
+2 52 50
+2 53 59
+2 54 81
+2 55 46
+2 56 52
+2 57 59
+2 58 19
+2 59 33
+2 60 13
+2 61 67
+2 62 26
+2 63 56
+2 64 55
+2 65 54
+2 66 14
+2 67 81
+2 68 40
+2 69 50
+2 70 41
+2 71 68
+2 72 48
+2 73 11
+2 74 73
+2 75 39
+2 76 22
+2 77 49
+2 78 51
+2 79 50
+2 80 65
+2 81 46
+2 82 82
+2 83 63
+2 84 22
+2 86 53
+2 87 78
+2 88 34
+2 89 35
+2 90 32
+2 91 30
+2 92 27
+2 93 53
+2 94 50
+2 95 48
+2 96 10
+2 97 25
+2 98 49
+2 99 54
+2 100 53
+2 101 13
+2 102 45
+2 103 36
+2 104 70
+2 106 19
+2 107 29
+2 108 62
+2 109 40
+2 110 23
+2 111 56
+2 112 20
+2 113 51
+2 114 16
+2 115 71
+2 116 66
+2 117 17
+2 118 53
+2 119 49
+2 120 60
+2 121 55
+2 122 56
+2 123 54
+2 124 57
+2 125 65
+2 126 23
+3 0 41
+3 1 54
+3 2 31
+3 4 65
+3 5 23
+3 6 45
+3 7 15
+3 8 61
+3 9 63
+3 10 63
+3 11 46
+3 13 36
+3 14 31
+3 15 45
+3 16 57
+3 17 61
+3 18 43
+3 19 54
+3 20 97
+3 21 64
+3 22 37
+3 23 57
+3 24 49
+3 25 32
+3 26 75
+3 27 42
+3 28 78
+3 29 21
+3 30 56
+3 31 73
+3 32 49
+3 33 85
+3 34 21
+3 35 30
+3 36 41
+3 37 35
+3 38 43
+3 39 9
+3 40 7
+3 41 66
+3 42 61
+3 43 36
+3 44 47
+3 45 93
+3 46 55
+3 47 37
+3 48 31
+3 49 51
+3 50 43
+3 51 69
+3 52 19
+3 53 55
+3 54 80
+3 55 55
+3 56 61
+3 57 56
+3 58 40
+3 59 30
+3 60 43
+3 61 36
+3 62 46
+3 63 63
+3 64 46
+3 65 45
+3 66 39
+3 67 77
+3 68 31
+3 69 46
+3 70 54
+3 71 64
+3 72 30
+3 73 36
+3 74 17
+3 75 43
+3 76 36
+3 77 49
+3 78 50
+3 79 32
+3 80 61
+3 81 50
+3 82 91
+3 83 59
+3 84 42
+3 86 22
+3 87 77
+3 88 34
+3 89 55
+3 90 36
+3 91 30
+3 92 41
+3 93 36
+3 94 22
+3 95 64
+3 96 35
+3 97 47
+3 98 45
+3 99 63
+3 100 49
+3 101 38
+3 102 54
+3 103 27
+3 104 66
+3 106 33
+3 107 29
+3 108 71
+3 109 32
+3 110 37
+3 111 56
+3 112 34
+3 113 55
+3 114 35
+3 115 80
+3 116 35
+3 117 33
+3 118 49
+3 119 31
+3 120 69
+3 121 59
+3 122 38
+3 123 48
+3 124 49
+3 125 61
+3 126 23
+4 0 40
+4 1 57
+4 2 46
+4 3 58
+4 5 45
+4 6 44
+4 7 48
+4 8 59
+4 9 15
+4 10 49
+4 11 59
+4 13 45
+4 14 46
+4 15 27
+4 16 63
+4 17 50
+4 18 53
+4 19 51
+4 20 32
+4 21 50
+4 22 33
+4 23 51
+4 24 58
+4 25 54
+4 26 30
+4 27 41
+4 28 29
+4 29 43
+4 30 57
+4 31 25
+4 32 59
+4 33 20
+4 34 54
+4 35 40
+4 36 45
+4 37 58
+4 38 52
+4 39 64
+4 40 56
+4 41 52
+4 42 59
+4 43 33
+4 44 29
+4 45 46
+4 46 58
+4 47 39
+4 48 53
+4 49 46
+4 50 48
+4 51 13
+4 52 41
+4 53 53
+4 54 15
+4 55 23
+4 56 23
+4 57 53
+4 58 45
+4 59 57
+4 60 39
+4 61 59
+4 62 51
+4 63 24
+4 64 38
+4 65 30
+4 66 39
+4 67 30
+4 68 46
+4 69 59
+4 70 52
+4 71 14
+4 72 39
+4 73 35
+4 74 64
+4 75 54
+4 76 46
+4 77 62
+4 78 56
+4 79 41
+4 80 19
+4 81 57
+4 82 45
+4 83 25
+4 84 47
+4 86 44
+4 87 12
+4 88 47
+4 89 60
+4 90 47
+4 91 45
+4 92 33
+4 93 55
+4 94 56
+4 95 61
+4 96 35
+4 97 39
+4 98 55
+4 99 25
+4 100 56
+4 101 37
+4 102 50
+4 103 42
+4 104 18
+4 106 43
+4 107 44
+4 108 25
+4 109 47
+4 110 47
+4 111 50
+4 112 35
+4 113 59
+4 114 41
+4 115 33
+4 116 57
+4 117 41
+4 118 55
+4 119 40
+4 120 20
+4 121 61
+4 122 58
+4 123 48
+4 124 64
+4 125 27
+4 126 38
+5 0 24
+5 1 42
+5 2 8
+5 3 13
+5 4 53
+5 6 28
+5 7 3
+5 8 49
+5 9 51
+5 10 48
+5 11 31
+5 13 21
+5 14 8
+5 15 30
+5 16 45
+5 17 49
+5 18 31
+5 19 42
+5 20 85
+5 21 49
+5 22 22
+5 23 45
+5 24 37
+5 25 20
+5 26 63
+5 27 25
+5 28 63
+5 29 22
+5 30 44
+5 31 61
+5 32 34
+5 33 73
+5 34 9
+5 35 18
+5 36 26
+5 37 23
+5 38 31
+5 39 19
+5 40 20
+5 41 51
+5 42 49
+5 43 24
+5 44 32
+5 45 78
+5 46 43
+5 47 22
+5 48 8
+5 49 34
+5 50 32
+5 51 57
+5 52 7
+5 53 43
+5 54 68
+5 55 40
+5 56 46
+5 57 44
+5 58 26
+5 59 32
+5 60 20
+5 61 24
+5 62 34
+5 63 50
+5 64 23
+5 65 29
+5 66 22
+5 67 65
+5 68 8
+5 69 34
+5 70 42
+5 71 52
+5 72 18
+5 73 19
+5 74 19
+5 75 28
+5 76 24
+5 77 34
+5 78 38
+5 79 20
+5 80 49
+5 81 38
+5 82 76
+5 83 47
+5 84 30
+5 86 10
+5 87 65
+5 88 19
+5 89 43
+5 90 21
+5 91 18
+5 92 29
+5 93 24
+5 94 32
+5 95 52
+5 96 18
+5 97 32
+5 98 33
+5 99 48
+5 100 37
+5 101 21
+5 102 39
+5 103 4
+5 104 54
+5 106 21
+5 107 17
+5 108 56
+5 109 9
+5 110 25
+5 111 44
+5 112 22
+5 113 43
+5 114 23
+5 115 65
+5 116 23
+5 117 21
+5 118 37
+5 119 19
+5 120 54
+5 121 47
+5 122 26
+5 123 36
+5 124 26
+5 125 49
+5 126 11
+6 0 16
+6 1 51
+6 2 18
+6 3 57
+6 4 56
+6 5 44
+6 7 47
+6 8 41
+6 9 60
+6 10 49
+6 11 32
+6 13 22
+6 14 29
+6 15 26
+6 16 50
+6 17 41
+6 18 28
+6 19 51
+6 20 85
+6 21 50
+6 22 18
+6 23 54
+6 24 57
+6 25 53
+6 26 60
+6 27 1
+6 28 59
+6 29 42
+6 30 37
+6 31 70
+6 32 35
+6 33 73
+6 34 53
+6 35 16
+6 36 27
+6 37 57
+6 38 51
+6 39 45
+6 40 28
+6 41 52
+6 42 58
+6 43 15
+6 44 28
+6 45 74
+6 46 52
+6 47 22
+6 48 52
+6 49 26
+6 50 8
+6 51 57
+6 52 40
+6 53 52
+6 54 71
+6 55 36
+6 56 42
+6 57 53
+6 58 17
+6 59 23
+6 60 31
+6 61 58
+6 62 26
+6 63 46
+6 64 44
+6 65 50
+6 66 14
+6 67 74
+6 68 29
+6 69 43
+6 70 34
+6 71 58
+6 72 38
+6 73 11
+6 74 63
+6 75 29
+6 76 21
+6 77 35
+6 78 41
+6 79 40
+6 80 58
+6 81 39
+6 82 72
+6 83 56
+6 84 22
+6 86 43
+6 87 68
+6 88 20
+6 89 17
+6 90 22
+6 91 16
+6 92 20
+6 93 46
+6 94 36
+6 95 48
+6 96 10
+6 97 9
+6 98 42
+6 99 44
+6 100 46
+6 101 13
+6 102 35
+6 103 25
+6 104 63
+6 106 19
+6 107 22
+6 108 52
+6 109 30
+6 110 22
+6 111 53
+6 112 13
+6 113 44
+6 114 16
+6 115 61
+6 116 56
+6 117 17
+6 118 46
+6 119 39
+6 120 50
+6 121 48
+6 122 49
+6 123 53
+6 124 47
+6 125 58
+6 126 16
+7 0 26
+7 1 39
+7 2 29
+7 3 10
+7 4 50
+7 5 21
+7 6 30
+7 8 46
+7 9 48
+7 10 48
+7 11 31
+7 13 21
+7 14 29
+7 15 30
+7 16 42
+7 17 46
+7 18 28
+7 19 39
+7 20 82
+7 21 49
+7 22 22
+7 23 42
+7 24 34
+7 25 30
+7 26 60
+7 27 27
+7 28 63
+7 29 19
+7 30 41
+7 31 58
+7 32 34
+7 33 70
+7 34 6
+7 35 15
+7 36 26
+7 37 20
+7 38 28
+7 39 16
+7 40 17
+7 41 51
+7 42 46
+7 43 21
+7 44 32
+7 45 78
+7 46 40
+7 47 22
+7 48 29
+7 49 36
+7 50 29
+7 51 54
+7 52 4
+7 53 40
+7 54 65
+7 55 40
+7 56 46
+7 57 41
+7 58 25
+7 59 32
+7 60 41
+7 61 21
+7 62 31
+7 63 48
+7 64 44
+7 65 30
+7 66 24
+7 67 62
+7 68 29
+7 69 31
+7 70 39
+7 71 49
+7 72 15
+7 73 21
+7 74 27
+7 75 28
+7 76 21
+7 77 34
+7 78 35
+7 79 17
+7 80 46
+7 81 35
+7 82 76
+7 83 44
+7 84 27
+7 86 7
+7 87 62
+7 88 19
+7 89 40
+7 90 21
+7 91 15
+7 92 26
+7 93 21
+7 94 29
+7 95 49
+7 96 20
+7 97 32
+7 98 30
+7 99 48
+7 100 34
+7 101 23
+7 102 39
+7 103 25
+7 104 51
+7 106 18
+7 107 14
+7 108 56
+7 109 29
+7 110 22
+7 111 41
+7 112 19
+7 113 40
+7 114 20
+7 115 65
+7 116 20
+7 117 18
+7 118 34
+7 119 16
+7 120 54
+7 121 44
+7 122 23
+7 123 33
+7 124 46
+7 125 46
+7 126 8
+8 0 53
+8 1 32
+8 2 45
+8 3 88
+8 4 43
+8 5 75
+8 6 57
+8 7 78
+8 9 41
+8 10 41
+8 11 58
+8 13 48
+8 14 45
+8 15 57
+8 16 35
+8 17 33
+8 18 50
+8 19 36
+8 20 75
+8 21 35
+8 22 49
+8 23 35
+8 24 88
+8 25 84
+8 26 53
+8 27 54
+8 28 57
+8 29 73
+8 30 34
+8 31 51
+8 32 61
+8 33 63
+8 34 84
+8 35 42
+8 36 51
+8 37 88
+8 38 82
+8 39 94
+8 40 78
+8 41 37
+8 42 39
+8 43 48
+8 44 59
+8 45 83
+8 46 33
+8 47 38
+8 48 83
+8 49 63
+8 50 51
+8 51 47
+8 52 71
+8 53 33
+8 54 58
+8 55 49
+8 56 51
+8 57 38
+8 58 52
+8 59 54
+8 60 56
+8 61 49
+8 62 57
+8 63 41
+8 64 60
+8 65 31
+8 66 51
+8 67 55
+8 68 44
+8 69 24
+8 70 67
+8 71 42
+8 72 69
+8 73 48
+8 74 94
+8 75 55
+8 76 43
+8 77 61
+8 78 28
+8 79 71
+8 80 39
+8 81 20
+8 82 73
+8 83 37
+8 84 54
+8 86 74
+8 87 55
+8 88 46
+8 89 66
+8 90 48
+8 91 42
+8 92 53
+8 93 35
+8 94 62
+8 95 38
+8 96 47
+8 97 59
+8 98 23
+8 99 53
+8 100 27
+8 101 50
+8 102 66
+8 103 41
+8 104 44
+8 106 45
+8 107 41
+8 108 53
+8 109 46
+8 110 44
+8 111 34
+8 112 46
+8 113 25
+8 114 47
+8 115 70
+8 116 87
+8 117 45
+8 118 27
+8 119 70
+8 120 48
+8 121 29
+8 122 30
+8 123 16
+8 124 63
+8 125 39
+8 126 35
+9 0 25
+9 1 47
+9 2 32
+9 3 61
+9 4 6
+9 5 48
+9 6 29
+9 7 51
+9 8 50
+9 10 42
+9 11 48
+9 13 38
+9 14 42
+9 15 30
+9 16 56
+9 17 43
+9 18 38
+9 19 44
+9 20 38
+9 21 43
+9 22 36
+9 23 44
+9 24 61
+9 25 57
+9 26 17
+9 27 26
+9 28 16
+9 29 46
+9 30 44
+9 31 10
+9 32 47
+9 33 26
+9 34 57
+9 35 25
+9 36 39
+9 37 61
+9 38 55
+9 39 67
+9 40 53
+9 41 45
+9 42 52
+9 43 24
+9 44 32
+9 45 42
+9 46 51
+9 47 35
+9 48 56
+9 49 33
+9 50 33
+9 51 6
+9 52 44
+9 53 46
+9 54 21
+9 55 8
+9 56 10
+9 57 46
+9 58 30
+9 59 42
+9 60 24
+9 61 57
+9 62 36
+9 63 14
+9 64 23
+9 65 23
+9 66 24
+9 67 15
+9 68 40
+9 69 48
+9 70 43
+9 71 1
+9 72 42
+9 73 20
+9 74 67
+9 75 41
+9 76 31
+9 77 51
+9 78 52
+9 79 44
+9 80 12
+9 81 44
+9 82 32
+9 83 10
+9 84 32
+9 86 47
+9 87 18
+9 88 36
+9 89 45
+9 90 34
+9 91 32
+9 92 20
+9 93 48
+9 94 52
+9 95 54
+9 96 20
+9 97 34
+9 98 47
+9 99 12
+9 100 43
+9 101 22
+9 102 53
+9 103 38
+9 104 3
+9 106 28
+9 107 31
+9 108 12
+9 109 35
+9 110 32
+9 111 43
+9 112 22
+9 113 49
+9 114 26
+9 115 29
+9 116 60
+9 117 26
+9 118 42
+9 119 43
+9 120 7
+9 121 53
+9 122 45
+9 123 41
+9 124 59
+9 125 12
+9 126 25
+10 0 21
+10 1 8
+10 2 17
+10 3 59
+10 4 14
+10 5 46
+10 6 25
+10 7 49
+10 8 16
+10 9 12
+10 11 36
+10 13 26
+10 14 17
+10 15 28
+10 16 14
+10 17 19
+10 18 9
+10 19 2
+10 20 46
+10 21 1
+10 22 20
+10 23 7
+10 24 59
+10 25 55
+10 26 24
+10 27 22
+10 28 28
+10 29 44
+10 30 15
+10 31 22
+10 32 32
+10 33 34
+10 34 55
+10 35 20
+10 36 17
+10 37 59
+10 38 53
+10 39 65
+10 40 49
+10 41 3
+10 42 10
+10 43 14
+10 44 30
+10 45 54
+10 46 9
+10 47 10
+10 48 54
+10 49 25
+10 50 10
+10 51 18
+10 52 42
+10 53 4
+10 54 29
+10 55 20
+10 56 22
+10 57 4
+10 58 24
+10 59 13
+10 60 22
+10 61 15
+10 62 16
+10 63 12
+10 64 32
+10 65 4
+10 66 17
+10 67 26
+10 68 10
+10 69 17
+10 70 33
+10 71 13
+10 72 40
+10 73 16
+10 74 65
+10 75 26
+10 76 2
+10 77 39
+10 78 14
+10 79 42
+10 80 10
+10 81 21
+10 82 44
+10 83 8
+10 84 27
+10 86 45
+10 87 26
+10 88 24
+10 89 25
+10 90 19
+10 91 20
+10 92 17
+10 93 11
+10 94 40
+10 95 12
+10 96 15
+10 97 30
+10 98 6
+10 99 24
+10 100 20
+10 101 18
+10 102 37
+10 103 13
+10 104 15
+10 106 11
+10 107 19
+10 108 24
+10 109 18
+10 110 3
+10 111 6
+10 112 12
+10 113 10
+10 114 19
+10 115 41
+10 116 58
+10 117 20
+10 118 20
+10 119 41
+10 120 19
+10 121 12
+10 122 10
+10 123 22
+10 124 35
+10 125 10
+10 126 15
+11 0 17
+11 1 46
+11 2 18
+11 3 39
+11 4 38
+11 5 26
+11 6 21
+11 7 29
+11 8 36
+11 9 53
+11 10 44
+11 13 24
+11 14 16
+11 15 8
+11 16 49
+11 17 36
+11 18 30
+11 19 46
+11 20 67
+11 21 45
+11 22 14
+11 23 49
+11 24 39
+11 25 35
+11 26 42
+11 27 18
+11 28 41
+11 29 24
+11 30 38
+11 31 60
+11 32 31
+11 33 55
+11 34 35
+11 35 17
+11 36 23
+11 37 39
+11 38 33
+11 39 45
+11 40 37
+11 41 47
+11 42 53
+11 43 10
+11 44 10
+11 45 56
+11 46 47
+11 47 19
+11 48 34
+11 49 27
+11 50 25
+11 51 39
+11 52 22
+11 53 47
+11 54 53
+11 55 18
+11 56 24
+11 57 48
+11 58 19
+11 59 34
+11 60 13
+11 61 40
+11 62 29
+11 63 28
+11 64 31
+11 65 37
+11 66 24
+11 67 57
+11 68 7
+11 69 38
+11 70 29
+11 71 40
+11 72 20
+11 73 12
+11 74 45
+11 75 25
+11 76 23
+11 77 3
+11 78 37
+11 79 22
+11 80 51
+11 81 34
+11 82 54
+11 83 49
+11 84 29
+11 86 25
+11 87 50
+11 88 22
+11 89 38
+11 90 18
+11 91 18
+11 92 15
+11 93 39
+11 94 37
+11 95 49
+11 96 20
+11 97 20
+11 98 37
+11 99 26
+11 100 41
+11 101 14
+11 102 31
+11 103 14
+11 104 47
+11 106 20
+11 107 17
+11 108 34
+11 109 17
+11 110 24
+11 111 48
+11 112 8
+11 113 39
+11 114 23
+11 115 43
+11 116 38
+11 117 18
+11 118 41
+11 119 21
+11 120 32
+11 121 43
+11 122 42
+11 123 48
+11 124 34
+11 125 40
+11 126 11
+12 0 30
+12 1 51
+12 2 28
+12 3 22
+12 4 62
+12 5 20
+12 6 34
+12 7 12
+12 8 51
+12 9 60
+12 10 59
+12 11 35
+12 13 25
+12 14 28
+12 15 34
+12 16 54
+12 17 51
+12 18 32
+12 19 51
+12 20 93
+12 21 60
+12 22 26
+12 23 54
+12 24 46
+12 25 29
+12 26 68
+12 27 31
+12 28 67
+12 29 18
+12 30 51
+12 31 70
+12 32 38
+12 33 81
+12 34 18
+12 35 19
+12 36 30
+12 37 32
+12 38 40
+12 39 6
+12 40 29
+12 41 62
+12 42 58
+12 43 25
+12 44 36
+12 45 82
+12 46 52
+12 47 26
+12 48 28
+12 49 40
+12 50 33
+12 51 65
+12 52 16
+12 53 52
+12 54 77
+12 55 44
+12 56 50
+12 57 53
+12 58 29
+12 59 36
+12 60 40
+12 61 33
+12 62 35
+12 63 54
+12 64 43
+12 65 42
+12 66 28
+12 67 74
+12 68 28
+12 69 43
+12 70 44
+12 71 61
+12 72 27
+12 73 25
+12 74 39
+12 75 32
+12 76 25
+12 77 38
+12 78 47
+12 79 10
+12 80 58
+12 81 47
+12 82 80
+12 83 56
+12 84 31
+12 86 11
+12 87 74
+12 88 23
+12 89 44
+12 90 25
+12 91 19
+12 92 30
+12 93 33
+12 94 19
+12 95 61
+12 96 24
+12 97 36
+12 98 42
+12 99 52
+12 100 46
+12 101 27
+12 102 43
+12 103 24
+12 104 63
+12 106 22
+12 107 18
+12 108 60
+12 109 29
+12 110 26
+12 111 53
+12 112 23
+12 113 52
+12 114 24
+12 115 69
+12 116 32
+12 117 22
+12 118 46
+12 119 28
+12 120 58
+12 121 56
+12 122 35
+12 123 45
+12 124 46
+12 125 58
+12 126 12
+13 0 39
+13 1 35
+13 2 23
+13 3 40
+13 4 39
+13 5 27
+13 6 43
+13 7 30
+13 8 44
+13 9 44
+13 10 44
+13 11 27
+13 14 23
+13 15 9
+13 16 38
+13 17 44
+13 18 47
+13 19 40
+13 20 68
+13 21 42
+13 22 1
+13 23 45
+13 24 40
+13 25 36
+13 26 43
+13 27 40
+13 28 42
+13 29 25
+13 30 37
+13 31 54
+13 32 27
+13 33 56
+13 34 36
+13 35 34
+13 36 13
+13 37 40
+13 38 34
+13 39 46
+13 40 38
+13 41 44
+13 42 42
+13 43 37
+13 44 11
+13 45 57
+13 46 37
+13 47 16
+13 48 35
+13 49 49
+13 50 47
+13 51 40
+13 52 23
+13 53 36
+13 54 54
+13 55 19
+13 56 25
+13 57 42
+13 58 41
+13 59 51
+13 60 35
+13 61 41
+13 62 49
+13 63 29
+13 64 38
+13 65 42
+13 66 37
+13 67 58
+13 68 23
+13 69 27
+13 70 56
+13 71 41
+13 72 21
+13 73 34
+13 74 46
+13 75 22
+13 76 40
+13 77 30
+13 78 24
+13 79 23
+13 80 42
+13 81 31
+13 82 55
+13 83 40
+13 84 45
+13 86 26
+13 87 51
+13 88 15
+13 89 58
+13 90 15
+13 91 28
+13 92 42
+13 93 38
+13 94 14
+13 95 48
+13 96 33
+13 97 21
+13 98 34
+13 99 27
+13 100 30
+13 101 36
+13 102 18
+13 103 19
+13 104 47
+13 106 37
+13 107 33
+13 108 35
+13 109 23
+13 110 41
+13 111 44
+13 112 35
+13 113 36
+13 114 39
+13 115 44
+13 116 39
+13 117 37
+13 118 30
+13 119 22
+13 120 33
+13 121 40
+13 122 33
+13 123 45
+13 124 39
+13 125 41
+13 126 27
+14 0 33
+14 1 48
+14 2 21
+14 3 53
+14 4 52
+14 5 40
+14 6 37
+14 7 43
+14 8 54
+14 9 52
+14 10 40
+14 11 23
+14 13 13
+14 15 22
+14 16 51
+14 17 41
+14 18 35
+14 19 42
+14 20 81
+14 21 41
+14 22 14
+14 23 42
+14 24 53
+14 25 49
+14 26 56
+14 27 34
+14 28 55
+14 29 38
+14 30 50
+14 31 62
+14 32 26
+14 33 69
+14 34 49
+14 35 22
+14 36 18
+14 37 53
+14 38 47
+14 39 59
+14 40 43
+14 41 43
+14 42 50
+14 43 28
+14 44 24
+14 45 70
+14 46 49
+14 47 14
+14 48 48
+14 49 43
+14 50 36
+14 51 53
+14 52 36
+14 53 44
+14 54 67
+14 55 32
+14 56 38
+14 57 44
+14 58 20
+14 59 39
+14 60 14
+14 61 54
+14 62 38
+14 63 42
+14 64 15
+14 65 21
+14 66 31
+14 67 66
+14 68 6
+14 69 40
+14 70 47
+14 71 53
+14 72 34
+14 73 28
+14 74 59
+14 75 20
+14 76 28
+14 77 26
+14 78 37
+14 79 36
+14 80 50
+14 81 44
+14 82 68
+14 83 48
+14 84 34
+14 86 39
+14 87 64
+14 88 11
+14 89 47
+14 90 13
+14 91 31
+14 92 33
+14 93 46
+14 94 27
+14 95 52
+14 96 27
+14 97 24
+14 98 46
+14 99 40
+14 100 43
+14 101 30
+14 102 31
+14 103 17
+14 104 55
+14 106 25
+14 107 35
+14 108 48
+14 109 1
+14 110 29
+14 111 41
+14 112 26
+14 113 49
+14 114 33
+14 115 57
+14 116 52
+14 117 25
+14 118 43
+14 119 35
+14 120 46
+14 121 52
+14 122 46
+14 123 39
+14 124 18
+14 125 50
+14 126 29
+15 0 35
+15 1 40
+15 2 19
+15 3 31
+15 4 30
+15 5 18
+15 6 39
+15 7 21
+15 8 49
+15 9 45
+15 10 49
+15 11 32
+15 13 18
+15 14 19
+15 16 43
+15 17 49
+15 18 38
+15 19 45
+15 20 59
+15 21 47
+15 22 6
+15 23 50
+15 24 31
+15 25 27
+15 26 34
+15 27 36
+15 28 33
+15 29 16
+15 30 42
+15 31 52
+15 32 32
+15 33 47
+15 34 27
+15 35 25
+15 36 18
+15 37 31
+15 38 25
+15 39 37
+15 40 29
+15 41 49
+15 42 47
+15 43 31
+15 44 2
+15 45 48
+15 46 42
+15 47 12
+15 48 26
+15 49 45
+15 50 39
+15 51 31
+15 52 14
+15 53 41
+15 54 45
+15 55 10
+15 56 16
+15 57 47
+15 58 35
+15 59 42
+15 60 31
+15 61 32
+15 62 41
+15 63 20
+15 64 34
+15 65 40
+15 66 33
+15 67 49
+15 68 19
+15 69 32
+15 70 50
+15 71 32
+15 72 12
+15 73 30
+15 74 37
+15 75 27
+15 76 31
+15 77 35
+15 78 29
+15 79 14
+15 80 43
+15 81 36
+15 82 46
+15 83 41
+15 84 37
+15 86 17
+15 87 42
+15 88 20
+15 89 50
+15 90 20
+15 91 19
+15 92 36
+15 93 31
+15 94 29
+15 95 53
+15 96 29
+15 97 12
+15 98 39
+15 99 18
+15 100 35
+15 101 32
+15 102 23
+15 103 15
+15 104 39
+15 106 28
+15 107 24
+15 108 26
+15 109 20
+15 110 32
+15 111 49
+15 112 29
+15 113 41
+15 114 30
+15 115 35
+15 116 30
+15 117 28
+15 118 35
+15 119 13
+15 120 24
+15 121 45
+15 122 34
+15 123 44
+15 124 37
+15 125 32
+15 126 18
+16 0 33
+16 1 17
+16 2 17
+16 3 70
+16 4 28
+16 5 57
+16 6 37
+16 7 60
+16 8 30
+16 9 26
+16 10 14
+16 11 40
+16 13 30
+16 14 17
+16 15 39
+16 17 19
+16 18 23
+16 19 16
+16 20 60
+16 21 15
+16 22 31
+16 23 7
+16 24 70
+16 25 66
+16 26 38
+16 27 34
+16 28 42
+16 29 55
+16 30 24
+16 31 36
+16 32 37
+16 33 48
+16 34 66
+16 35 33
+16 36 22
+16 37 70
+16 38 64
+16 39 76
+16 40 60
+16 41 17
+16 42 22
+16 43 28
+16 44 41
+16 45 68
+16 46 23
+16 47 10
+16 48 65
+16 49 39
+16 50 24
+16 51 32
+16 52 53
+16 53 18
+16 54 43
+16 55 34
+16 56 36
+16 57 9
+16 58 35
+16 59 27
+16 60 29
+16 61 20
+16 62 30
+16 63 26
+16 64 32
+16 65 4
+16 66 31
+16 67 40
+16 68 17
+16 69 22
+16 70 38
+16 71 27
+16 72 51
+16 73 28
+16 74 76
+16 75 31
+16 76 16
+16 77 43
+16 78 19
+16 79 53
+16 80 24
+16 81 26
+16 82 58
+16 83 22
+16 84 39
+16 86 56
+16 87 40
+16 88 28
+16 89 39
+16 90 24
+16 91 34
+16 92 31
+16 93 11
+16 94 44
+16 95 17
+16 96 27
+16 97 41
+16 98 18
+16 99 38
+16 100 25
+16 101 30
+16 102 48
+16 103 13
+16 104 29
+16 106 25
+16 107 33
+16 108 38
+16 109 18
+16 110 17
+16 111 6
+16 112 26
+16 113 15
+16 114 33
+16 115 55
+16 116 69
+16 117 34
+16 118 25
+16 119 52
+16 120 33
+16 121 19
+16 122 22
+16 123 22
+16 124 35
+16 125 24
+16 126 29
+17 0 29
+17 1 16
+17 2 25
+17 3 67
+17 4 22
+17 5 54
+17 6 33
+17 7 57
+17 8 24
+17 9 20
+17 10 8
+17 11 44
+17 13 34
+17 14 25
+17 15 36
+17 16 22
+17 18 17
+17 19 10
+17 20 54
+17 21 9
+17 22 28
+17 23 15
+17 24 67
+17 25 63
+17 26 32
+17 27 30
+17 28 36
+17 29 52
+17 30 11
+17 31 30
+17 32 40
+17 33 42
+17 34 63
+17 35 28
+17 36 25
+17 37 67
+17 38 61
+17 39 73
+17 40 57
+17 41 11
+17 42 18
+17 43 22
+17 44 38
+17 45 62
+17 46 17
+17 47 18
+17 48 62
+17 49 33
+17 50 18
+17 51 26
+17 52 50
+17 53 12
+17 54 37
+17 55 28
+17 56 30
+17 57 12
+17 58 32
+17 59 21
+17 60 30
+17 61 19
+17 62 24
+17 63 20
+17 64 40
+17 65 12
+17 66 25
+17 67 34
+17 68 18
+17 69 25
+17 70 37
+17 71 21
+17 72 48
+17 73 24
+17 74 73
+17 75 34
+17 76 10
+17 77 47
+17 78 22
+17 79 50
+17 80 18
+17 81 23
+17 82 52
+17 83 16
+17 84 35
+17 86 53
+17 87 34
+17 88 32
+17 89 33
+17 90 27
+17 91 28
+17 92 25
+17 93 5
+17 94 48
+17 95 20
+17 96 23
+17 97 38
+17 98 14
+17 99 32
+17 100 22
+17 101 26
+17 102 45
+17 103 21
+17 104 23
+17 106 19
+17 107 27
+17 108 32
+17 109 26
+17 110 11
+17 111 14
+17 112 20
+17 113 18
+17 114 27
+17 115 49
+17 116 66
+17 117 28
+17 118 28
+17 119 49
+17 120 27
+17 121 20
+17 122 18
+17 123 28
+17 124 43
+17 125 18
+17 126 23
+18 0 15
+18 1 44
+18 2 26
+18 3 50
+18 4 49
+18 5 37
+18 6 19
+18 7 40
+18 8 34
+18 9 53
+18 10 42
+18 11 32
+18 13 22
+18 14 26
+18 15 19
+18 16 42
+18 17 34
+18 19 44
+18 20 78
+18 21 43
+18 22 11
+18 23 47
+18 24 50
+18 25 46
+18 26 53
+18 27 16
+18 28 52
+18 29 35
+18 30 29
+18 31 63
+18 32 31
+18 33 66
+18 34 46
+18 35 15
+18 36 23
+18 37 50
+18 38 44
+18 39 56
+18 40 43
+18 41 45
+18 42 51
+18 43 8
+18 44 21
+18 45 67
+18 46 45
+18 47 19
+18 48 45
+18 49 18
+18 50 1
+18 51 50
+18 52 33
+18 53 45
+18 54 64
+18 55 29
+18 56 35
+18 57 46
+18 58 24
+18 59 4
+18 60 38
+18 61 51
+18 62 27
+18 63 39
+18 64 41
+18 65 46
+18 66 17
+18 67 67
+18 68 26
+18 69 36
+18 70 27
+18 71 51
+18 72 31
+18 73 10
+18 74 56
+18 75 25
+18 76 14
+18 77 35
+18 78 34
+18 79 33
+18 80 51
+18 81 32
+18 82 65
+18 83 49
+18 84 25
+18 86 36
+18 87 61
+18 88 20
+18 89 36
+18 90 18
+18 91 16
+18 92 13
+18 93 39
+18 94 34
+18 95 40
+18 96 13
+18 97 24
+18 98 35
+18 99 37
+18 100 39
+18 101 12
+18 102 28
+18 103 22
+18 104 56
+18 106 18
+18 107 15
+18 108 45
+18 109 26
+18 110 15
+18 111 46
+18 112 6
+18 113 37
+18 114 19
+18 115 54
+18 116 49
+18 117 14
+18 118 39
+18 119 32
+18 120 43
+18 121 41
+18 122 42
+18 123 46
+18 124 43
+18 125 51
+18 126 9
+19 0 22
+19 1 6
+19 2 16
+19 3 69
+19 4 12
+19 5 56
+19 6 26
+19 7 59
+19 8 21
+19 9 10
+19 10 13
+19 11 39
+19 13 29
+19 14 16
+19 15 38
+19 16 12
+19 17 17
+19 18 22
+19 20 44
+19 21 14
+19 22 30
+19 23 6
+19 24 69
+19 25 65
+19 26 22
+19 27 23
+19 28 26
+19 29 54
+19 30 13
+19 31 20
+19 32 30
+19 33 32
+19 34 65
+19 35 22
+19 36 15
+19 37 69
+19 38 63
+19 39 67
+19 40 50
+19 41 16
+19 42 8
+19 43 27
+19 44 40
+19 45 52
+19 46 14
+19 47 9
+19 48 64
+19 49 32
+19 50 23
+19 51 16
+19 52 52
+19 53 2
+19 54 27
+19 55 18
+19 56 20
+19 57 2
+19 58 26
+19 59 26
+19 60 20
+19 61 13
+19 62 29
+19 63 10
+19 64 31
+19 65 16
+19 66 20
+19 67 24
+19 68 8
+19 69 15
+19 70 31
+19 71 11
+19 72 50
+19 73 17
+19 74 75
+19 75 24
+19 76 15
+19 77 42
+19 78 12
+19 79 52
+19 80 8
+19 81 19
+19 82 42
+19 83 6
+19 84 28
+19 86 55
+19 87 24
+19 88 27
+19 89 38
+19 90 17
+19 91 33
+19 92 25
+19 93 10
+19 94 43
+19 95 10
+19 96 16
+19 97 31
+19 98 4
+19 99 22
+19 100 18
+19 101 19
+19 102 47
+19 103 12
+19 104 13
+19 106 24
+19 107 32
+19 108 22
+19 109 17
+19 110 16
+19 111 5
+19 112 25
+19 113 8
+19 114 22
+19 115 39
+19 116 68
+19 117 23
+19 118 18
+19 119 51
+19 120 17
+19 121 12
+19 122 8
+19 123 25
+19 124 34
+19 125 8
+19 126 26
+20 0 8
+20 1 37
+20 2 26
+20 3 64
+20 4 15
+20 5 51
+20 6 12
+20 7 54
+20 8 27
+20 9 16
+20 10 35
+20 11 34
+20 13 24
+20 14 28
+20 15 33
+20 16 40
+20 17 27
+20 18 21
+20 19 37
+20 21 36
+20 22 25
+20 23 40
+20 24 64
+20 25 60
+20 26 7
+20 27 9
+20 28 27
+20 29 49
+20 30 29
+20 31 25
+20 32 33
+20 33 35
+20 34 60
+20 35 8
+20 36 25
+20 37 64
+20 38 58
+20 39 53
+20 40 36
+20 41 38
+20 42 44
+20 43 1
+20 44 35
+20 45 41
+20 46 38
+20 47 21
+20 48 59
+20 49 18
+20 50 16
+20 51 15
+20 52 47
+20 53 38
+20 54 30
+20 55 24
+20 56 9
+20 57 39
+20 58 22
+20 59 25
+20 60 39
+20 61 46
+20 62 20
+20 63 13
+20 64 38
+20 65 32
+20 66 15
+20 67 30
+20 68 28
+20 69 29
+20 70 20
+20 71 16
+20 72 45
+20 73 3
+20 74 70
+20 75 27
+20 76 14
+20 77 37
+20 78 33
+20 79 47
+20 80 14
+20 81 25
+20 82 39
+20 83 26
+20 84 20
+20 86 50
+20 87 27
+20 88 22
+20 89 29
+20 90 20
+20 91 18
+20 92 6
+20 93 32
+20 94 38
+20 95 40
+20 96 11
+20 97 17
+20 98 28
+20 99 11
+20 100 32
+20 101 5
+20 102 42
+20 103 24
+20 104 12
+20 106 11
+20 107 17
+20 108 19
+20 109 28
+20 110 15
+20 111 39
+20 112 8
+20 113 30
+20 114 17
+20 115 28
+20 116 63
+20 117 9
+20 118 32
+20 119 46
+20 120 22
+20 121 34
+20 122 35
+20 123 39
+20 124 45
+20 125 25
+20 126 11
+21 0 23
+21 1 7
+21 2 16
+21 3 69
+21 4 13
+21 5 56
+21 6 27
+21 7 59
+21 8 15
+21 9 11
+21 10 14
+21 11 39
+21 13 29
+21 14 16
+21 15 38
+21 16 13
+21 17 18
+21 18 23
+21 19 1
+21 20 45
+21 22 30
+21 23 6
+21 24 69
+21 25 65
+21 26 23
+21 27 24
+21 28 27
+21 29 54
+21 30 14
+21 31 21
+21 32 31
+21 33 33
+21 34 65
+21 35 23
+21 36 16
+21 37 69
+21 38 63
+21 39 68
+21 40 51
+21 41 2
+21 42 9
+21 43 28
+21 44 40
+21 45 53
+21 46 8
+21 47 9
+21 48 64
+21 49 33
+21 50 24
+21 51 17
+21 52 52
+21 53 3
+21 54 28
+21 55 19
+21 56 21
+21 57 3
+21 58 27
+21 59 27
+21 60 21
+21 61 14
+21 62 30
+21 63 11
+21 64 31
+21 65 3
+21 66 21
+21 67 25
+21 68 9
+21 69 16
+21 70 32
+21 71 12
+21 72 50
+21 73 18
+21 74 75
+21 75 25
+21 76 16
+21 77 42
+21 78 13
+21 79 52
+21 80 9
+21 81 20
+21 82 43
+21 83 7
+21 84 29
+21 86 55
+21 87 25
+21 88 27
+21 89 39
+21 90 18
+21 91 34
+21 92 26
+21 93 10
+21 94 43
+21 95 11
+21 96 17
+21 97 32
+21 98 5
+21 99 23
+21 100 19
+21 101 20
+21 102 47
+21 103 12
+21 104 14
+21 106 25
+21 107 33
+21 108 23
+21 109 17
+21 110 17
+21 111 5
+21 112 26
+21 113 9
+21 114 23
+21 115 40
+21 116 68
+21 117 24
+21 118 19
+21 119 51
+21 120 18
+21 121 13
+21 122 9
+21 123 21
+21 124 34
+21 125 9
+21 126 27
+22 0 38
+22 1 34
+22 2 22
+22 3 39
+22 4 38
+22 5 26
+22 6 42
+22 7 29
+22 8 43
+22 9 43
+22 10 43
+22 11 26
+22 13 16
+22 14 22
+22 15 8
+22 16 37
+22 17 43
+22 18 46
+22 19 39
+22 20 67
+22 21 41
+22 23 44
+22 24 39
+22 25 35
+22 26 42
+22 27 39
+22 28 41
+22 29 24
+22 30 36
+22 31 53
+22 32 26
+22 33 55
+22 34 35
+22 35 33
+22 36 12
+22 37 39
+22 38 33
+22 39 45
+22 40 37
+22 41 43
+22 42 41
+22 43 36
+22 44 10
+22 45 56
+22 46 36
+22 47 15
+22 48 34
+22 49 48
+22 50 46
+22 51 39
+22 52 22
+22 53 35
+22 54 53
+22 55 18
+22 56 24
+22 57 41
+22 58 40
+22 59 50
+22 60 34
+22 61 40
+22 62 48
+22 63 28
+22 64 37
+22 65 41
+22 66 36
+22 67 57
+22 68 22
+22 69 26
+22 70 55
+22 71 40
+22 72 20
+22 73 33
+22 74 45
+22 75 21
+22 76 39
+22 77 29
+22 78 23
+22 79 22
+22 80 41
+22 81 30
+22 82 54
+22 83 39
+22 84 44
+22 86 25
+22 87 50
+22 88 14
+22 89 57
+22 90 14
+22 91 27
+22 92 41
+22 93 37
+22 94 23
+22 95 47
+22 96 32
+22 97 20
+22 98 33
+22 99 26
+22 100 29
+22 101 35
+22 102 17
+22 103 18
+22 104 46
+22 106 36
+22 107 32
+22 108 34
+22 109 22
+22 110 40
+22 111 43
+22 112 34
+22 113 35
+22 114 38
+22 115 43
+22 116 38
+22 117 36
+22 118 29
+22 119 21
+22 120 32
+22 121 39
+22 122 32
+22 123 44
+22 124 38
+22 125 40
+22 126 26
+23 0 26
+23 1 34
+23 2 10
+23 3 63
+23 4 45
+23 5 50
+23 6 30
+23 7 53
+23 8 30
+23 9 43
+23 10 32
+23 11 33
+23 13 23
+23 14 10
+23 15 32
+23 16 37
+23 17 33
+23 18 20
+23 19 33
+23 20 77
+23 21 33
+23 22 24
+23 24 63
+23 25 59
+23 26 55
+23 27 27
+23 28 59
+23 29 48
+23 30 25
+23 31 53
+23 32 36
+23 33 65
+23 34 59
+23 35 26
+23 36 28
+23 37 63
+23 38 57
+23 39 69
+23 40 53
+23 41 35
+23 42 29
+23 43 25
+23 44 34
+23 45 80
+23 46 23
+23 47 3
+23 48 58
+23 49 36
+23 50 21
+23 51 49
+23 52 46
+23 53 35
+23 54 60
+23 55 42
+23 56 48
+23 57 35
+23 58 28
+23 59 24
+23 60 22
+23 61 46
+23 62 27
+23 63 43
+23 64 25
+23 65 13
+23 66 24
+23 67 57
+23 68 10
+23 69 26
+23 70 44
+23 71 44
+23 72 44
+23 73 21
+23 74 69
+23 75 30
+23 76 13
+23 77 36
+23 78 30
+23 79 46
+23 80 41
+23 81 22
+23 82 75
+23 83 39
+23 84 32
+23 86 49
+23 87 57
+23 88 21
+23 89 36
+23 90 23
+23 91 31
+23 92 28
+23 93 4
+23 94 37
+23 95 36
+23 96 20
+23 97 34
+23 98 13
+23 99 50
+23 100 21
+23 101 23
+23 102 41
+23 103 6
+23 104 46
+23 106 22
+23 107 30
+23 108 55
+23 109 11
+23 110 14
+23 111 24
+23 112 23
+23 113 27
+23 114 26
+23 115 67
+23 116 62
+23 117 27
+23 118 29
+23 119 45
+23 120 50
+23 121 31
+23 122 17
+23 123 31
+23 124 28
+23 125 41
+23 126 26
+24 0 24
+24 1 50
+24 2 31
+24 3 64
+24 4 63
+24 5 51
+24 6 28
+24 7 54
+24 8 45
+24 9 64
+24 10 53
+24 11 34
+24 13 24
+24 14 32
+24 15 33
+24 16 47
+24 17 45
+24 18 26
+24 19 55
+24 20 92
+24 21 54
+24 22 25
+24 23 54
+24 25 60
+24 26 67
+24 27 14
+24 28 66
+24 29 49
+24 30 34
+24 31 74
+24 32 37
+24 33 80
+24 34 60
+24 35 13
+24 36 29
+24 37 64
+24 38 58
+24 39 58
+24 40 41
+24 41 56
+24 42 62
+24 43 19
+24 44 35
+24 45 81
+24 46 56
+24 47 25
+24 48 59
+24 49 23
+24 50 21
+24 51 64
+24 52 47
+24 53 56
+24 54 78
+24 55 43
+24 56 49
+24 57 56
+24 58 28
+24 59 30
+24 60 44
+24 61 64
+24 62 25
+24 63 53
+24 64 47
+24 65 51
+24 66 21
+24 67 78
+24 68 32
+24 69 47
+24 70 38
+24 71 65
+24 72 45
+24 73 19
+24 74 70
+24 75 31
+24 76 19
+24 77 37
+24 78 48
+24 79 47
+24 80 62
+24 81 43
+24 82 79
+24 83 60
+24 84 25
+24 86 50
+24 87 75
+24 88 22
+24 89 34
+24 90 24
+24 91 18
+24 92 24
+24 93 50
+24 94 38
+24 95 45
+24 96 18
+24 97 22
+24 98 46
+24 99 51
+24 100 50
+24 101 10
+24 102 42
+24 103 28
+24 104 67
+24 106 16
+24 107 17
+24 108 59
+24 109 32
+24 110 20
+24 111 53
+24 112 17
+24 113 48
+24 114 23
+24 115 68
+24 116 63
+24 117 16
+24 118 50
+24 119 46
+24 120 57
+24 121 52
+24 122 53
+24 123 51
+24 124 49
+24 125 62
+24 126 20
+25 0 26
+25 1 44
+25 2 10
+25 3 15
+25 4 55
+25 5 2
+25 6 30
+25 7 5
+25 8 51
+25 9 53
+25 10 50
+25 11 33
+25 13 23
+25 14 10
+25 15 32
+25 16 47
+25 17 51
+25 18 33
+25 19 44
+25 20 87
+25 21 51
+25 22 24
+25 23 47
+25 24 39
+25 26 65
+25 27 27
+25 28 65
+25 29 24
+25 30 46
+25 31 63
+25 32 36
+25 33 75
+25 34 11
+25 35 20
+25 36 28
+25 37 25
+25 38 33
+25 39 21
+25 40 22
+25 41 53
+25 42 51
+25 43 26
+25 44 34
+25 45 80
+25 46 45
+25 47 24
+25 48 10
+25 49 36
+25 50 34
+25 51 59
+25 52 9
+25 53 45
+25 54 70
+25 55 42
+25 56 48
+25 57 46
+25 58 28
+25 59 34
+25 60 22
+25 61 26
+25 62 36
+25 63 52
+25 64 25
+25 65 31
+25 66 24
+25 67 67
+25 68 10
+25 69 36
+25 70 44
+25 71 54
+25 72 20
+25 73 21
+25 74 21
+25 75 30
+25 76 26
+25 77 36
+25 78 40
+25 79 22
+25 80 51
+25 81 40
+25 82 78
+25 83 49
+25 84 32
+25 86 12
+25 87 67
+25 88 21
+25 89 45
+25 90 23
+25 91 20
+25 92 31
+25 93 26
+25 94 34
+25 95 54
+25 96 20
+25 97 34
+25 98 35
+25 99 50
+25 100 39
+25 101 23
+25 102 41
+25 103 6
+25 104 56
+25 106 23
+25 107 19
+25 108 58
+25 109 11
+25 110 27
+25 111 46
+25 112 24
+25 113 45
+25 114 25
+25 115 67
+25 116 25
+25 117 23
+25 118 39
+25 119 21
+25 120 56
+25 121 49
+25 122 28
+25 123 38
+25 124 28
+25 125 51
+25 126 13
+26 0 14
+26 1 43
+26 2 25
+26 3 61
+26 4 8
+26 5 48
+26 6 18
+26 7 51
+26 8 33
+26 9 23
+26 10 41
+26 11 31
+26 13 21
+26 14 25
+26 15 30
+26 16 40
+26 17 33
+26 18 27
+26 19 43
+26 20 40
+26 21 42
+26 22 22
+26 23 46
+26 24 61
+26 25 57
+26 27 15
+26 28 24
+26 29 46
+26 30 27
+26 31 18
+26 32 30
+26 33 28
+26 34 57
+26 35 14
+26 36 22
+26 37 61
+26 38 55
+26 39 59
+26 40 42
+26 41 44
+26 42 50
+26 43 7
+26 44 32
+26 45 41
+26 46 44
+26 47 18
+26 48 56
+26 49 16
+26 50 22
+26 51 8
+26 52 44
+26 53 44
+26 54 23
+26 55 31
+26 56 12
+26 57 45
+26 58 25
+26 59 31
+26 60 32
+26 61 52
+26 62 26
+26 63 13
+26 64 31
+26 65 25
+26 66 21
+26 67 23
+26 68 25
+26 69 35
+26 70 26
+26 71 9
+26 72 42
+26 73 9
+26 74 67
+26 75 24
+26 76 20
+26 77 34
+26 78 39
+26 79 44
+26 80 22
+26 81 31
+26 82 40
+26 83 33
+26 84 26
+26 86 47
+26 87 20
+26 88 19
+26 89 35
+26 90 17
+26 91 15
+26 92 3
+26 93 38
+26 94 35
+26 95 38
+26 96 17
+26 97 23
+26 98 34
+26 99 11
+26 100 38
+26 101 11
+26 102 39
+26 103 21
+26 104 5
+26 106 17
+26 107 14
+26 108 20
+26 109 25
+26 110 21
+26 111 45
+26 112 5
+26 113 36
+26 114 20
+26 115 28
+26 116 60
+26 117 15
+26 118 38
+26 119 43
+26 120 15
+26 121 40
+26 122 41
+26 123 43
+26 124 42
+26 125 26
+26 126 8
+27 0 15
+27 1 50
+27 2 17
+27 3 56
+27 4 55
+27 5 43
+27 6 19
+27 7 46
+27 8 40
+27 9 59
+27 10 48
+27 11 31
+27 13 21
+27 14 28
+27 15 25
+27 16 49
+27 17 40
+27 18 27
+27 19 50
+27 20 84
+27 21 49
+27 22 17
+27 23 53
+27 24 56
+27 25 52
+27 26 59
+27 28 58
+27 29 41
+27 30 36
+27 31 69
+27 32 34
+27 33 72
+27 34 52
+27 35 15
+27 36 26
+27 37 56
+27 38 50
+27 39 44
+27 40 27
+27 41 51
+27 42 57
+27 43 14
+27 44 27
+27 45 73
+27 46 51
+27 47 21
+27 48 51
+27 49 25
+27 50 7
+27 51 56
+27 52 39
+27 53 51
+27 54 70
+27 55 35
+27 56 41
+27 57 52
+27 58 16
+27 59 31
+27 60 30
+27 61 57
+27 62 25
+27 63 45
+27 64 43
+27 65 49
+27 66 13
+27 67 73
+27 68 28
+27 69 42
+27 70 33
+27 71 57
+27 72 37
+27 73 10
+27 74 62
+27 75 28
+27 76 20
+27 77 34
+27 78 40
+27 79 39
+27 80 57
+27 81 38
+27 82 71
+27 83 55
+27 84 21
+27 86 42
+27 87 67
+27 88 19
+27 89 34
+27 90 21
+27 91 15
+27 92 19
+27 93 45
+27 94 35
+27 95 47
+27 96 9
+27 97 8
+27 98 41
+27 99 43
+27 100 45
+27 101 12
+27 102 34
+27 103 24
+27 104 62
+27 106 18
+27 107 21
+27 108 51
+27 109 29
+27 110 21
+27 111 52
+27 112 12
+27 113 43
+27 114 15
+27 115 60
+27 116 55
+27 117 16
+27 118 45
+27 119 38
+27 120 49
+27 121 47
+27 122 48
+27 123 52
+27 124 46
+27 125 57
+27 126 15
+28 0 33
+28 1 48
+28 2 40
+28 3 52
+28 4 28
+28 5 39
+28 6 37
+28 7 42
+28 8 53
+28 9 32
+28 10 58
+28 11 53
+28 13 39
+28 14 40
+28 15 21
+28 16 60
+28 17 53
+28 18 46
+28 19 60
+28 20 26
+28 21 59
+28 22 27
+28 23 60
+28 24 52
+28 25 48
+28 26 33
+28 27 34
+28 29 37
+28 30 54
+28 31 41
+28 32 53
+28 33 14
+28 34 48
+28 35 33
+28 36 39
+28 37 52
+28 38 46
+28 39 58
+28 40 50
+28 41 61
+28 42 55
+28 43 27
+28 44 23
+28 45 44
+28 46 58
+28 47 33
+28 48 47
+28 49 43
+28 50 41
+28 51 23
+28 52 35
+28 53 49
+28 54 19
+28 55 31
+28 56 27
+28 57 62
+28 58 38
+28 59 50
+28 60 52
+28 61 53
+28 62 43
+28 63 18
+28 64 54
+28 65 40
+28 66 31
+28 67 29
+28 68 40
+28 69 49
+28 70 46
+28 71 24
+28 72 33
+28 73 28
+28 74 58
+28 75 48
+28 76 39
+28 77 56
+28 78 50
+28 79 35
+28 80 30
+28 81 45
+28 82 33
+28 83 28
+28 84 39
+28 86 38
+28 87 40
+28 88 41
+28 89 52
+28 90 41
+28 91 40
+28 92 32
+28 93 51
+28 94 50
+28 95 63
+28 96 27
+28 97 33
+28 98 48
+28 99 29
+28 100 44
+28 101 30
+28 102 44
+28 103 36
+28 104 28
+28 106 36
+28 107 43
+28 108 13
+28 109 41
+28 110 40
+28 111 59
+28 112 34
+28 113 50
+28 114 33
+28 115 34
+28 116 51
+28 117 34
+28 118 43
+28 119 34
+28 120 30
+28 121 54
+28 122 46
+28 123 58
+28 124 58
+28 125 19
+28 126 37
+29 0 23
+29 1 44
+29 2 10
+29 3 15
+29 4 55
+29 5 2
+29 6 27
+29 7 5
+29 8 44
+29 9 53
+29 10 46
+29 11 28
+29 13 18
+29 14 10
+29 15 27
+29 16 47
+29 17 44
+29 18 25
+29 19 44
+29 20 86
+29 21 47
+29 22 19
+29 23 39
+29 24 31
+29 25 11
+29 26 61
+29 27 24
+29 28 60
+29 30 39
+29 31 63
+29 32 31
+29 33 74
+29 34 11
+29 35 12
+29 36 23
+29 37 25
+29 38 25
+29 39 21
+29 40 16
+29 41 49
+29 42 43
+29 43 18
+29 44 29
+29 45 75
+29 46 37
+29 47 19
+29 48 10
+29 49 33
+29 50 26
+29 51 58
+29 52 1
+29 53 45
+29 54 70
+29 55 37
+29 56 43
+29 57 46
+29 58 22
+29 59 29
+29 60 22
+29 61 26
+29 62 28
+29 63 47
+29 64 25
+29 65 27
+29 66 21
+29 67 67
+29 68 10
+29 69 36
+29 70 37
+29 71 54
+29 72 12
+29 73 18
+29 74 21
+29 75 25
+29 76 18
+29 77 31
+29 78 40
+29 79 14
+29 80 51
+29 81 36
+29 82 73
+29 83 49
+29 84 24
+29 86 4
+29 87 67
+29 88 16
+29 89 37
+29 90 18
+29 91 12
+29 92 23
+29 93 18
+29 94 32
+29 95 50
+29 96 17
+29 97 29
+29 98 27
+29 99 45
+29 100 35
+29 101 20
+29 102 36
+29 103 6
+29 104 56
+29 106 15
+29 107 11
+29 108 53
+29 109 11
+29 110 19
+29 111 38
+29 112 16
+29 113 41
+29 114 17
+29 115 62
+29 116 17
+29 117 15
+29 118 39
+29 119 13
+29 120 51
+29 121 45
+29 122 28
+29 123 38
+29 124 28
+29 125 51
+29 126 5
+30 0 44
+30 1 16
+30 2 30
+30 3 82
+30 4 34
+30 5 69
+30 6 48
+30 7 72
+30 8 29
+30 9 32
+30 10 23
+30 11 52
+30 13 42
+30 14 30
+30 15 51
+30 16 13
+30 17 27
+30 18 32
+30 19 25
+30 20 66
+30 21 24
+30 22 43
+30 23 20
+30 24 82
+30 25 78
+30 26 44
+30 27 45
+30 28 48
+30 29 67
+30 31 42
+30 32 50
+30 33 54
+30 34 78
+30 35 36
+30 36 35
+30 37 82
+30 38 76
+30 39 88
+30 40 72
+30 41 26
+30 42 28
+30 43 37
+30 44 53
+30 45 74
+30 46 22
+30 47 23
+30 48 77
+30 49 48
+30 50 33
+30 51 38
+30 52 65
+30 53 24
+30 54 49
+30 55 40
+30 56 42
+30 57 22
+30 58 46
+30 59 36
+30 60 42
+30 61 33
+30 62 39
+30 63 32
+30 64 45
+30 65 17
+30 66 40
+30 67 46
+30 68 30
+30 69 18
+30 70 51
+30 71 33
+30 72 63
+30 73 39
+30 74 88
+30 75 44
+30 76 25
+30 77 55
+30 78 22
+30 79 65
+30 80 30
+30 81 14
+30 82 64
+30 83 28
+30 84 48
+30 86 68
+30 87 46
+30 88 40
+30 89 48
+30 90 37
+30 91 36
+30 92 40
+30 93 24
+30 94 56
+30 95 11
+30 96 38
+30 97 53
+30 98 12
+30 99 44
+30 100 21
+30 101 41
+30 102 60
+30 103 26
+30 104 35
+30 106 34
+30 107 35
+30 108 44
+30 109 31
+30 110 26
+30 111 19
+30 112 35
+30 113 19
+30 114 41
+30 115 61
+30 116 81
+30 117 39
+30 118 21
+30 119 64
+30 120 39
+30 121 23
+30 122 24
+30 123 17
+30 124 48
+30 125 30
+30 126 29
+31 0 15
+31 1 52
+31 2 22
+31 3 51
+31 4 17
+31 5 38
+31 6 19
+31 7 41
+31 8 47
+31 9 11
+31 10 49
+31 11 45
+31 13 35
+31 14 33
+31 15 20
+31 16 49
+31 17 47
+31 18 28
+31 19 51
+31 20 47
+31 21 50
+31 22 26
+31 23 51
+31 24 51
+31 25 47
+31 26 22
+31 27 16
+31 28 21
+31 29 36
+31 30 36
+31 32 38
+31 33 35
+31 34 47
+31 35 15
+31 36 30
+31 37 51
+31 38 45
+31 39 57
+31 40 43
+31 41 52
+31 42 59
+31 43 21
+31 44 22
+31 45 48
+31 46 58
+31 47 26
+31 48 46
+31 49 25
+31 50 23
+31 51 13
+31 52 34
+31 53 53
+31 54 32
+31 55 19
+31 56 21
+31 57 53
+31 58 20
+31 59 32
+31 60 14
+31 61 52
+31 62 27
+31 63 20
+31 64 13
+31 65 30
+31 66 22
+31 67 5
+31 68 30
+31 69 49
+31 70 40
+31 71 6
+31 72 32
+31 73 10
+31 74 57
+31 75 32
+31 76 21
+31 77 48
+31 78 49
+31 79 34
+31 80 19
+31 81 45
+31 82 37
+31 83 17
+31 84 27
+31 86 37
+31 87 29
+31 88 33
+31 89 36
+31 90 25
+31 91 29
+31 92 25
+31 93 51
+31 94 49
+31 95 47
+31 96 18
+31 97 24
+31 98 48
+31 99 18
+31 100 48
+31 101 12
+31 102 43
+31 103 29
+31 104 14
+31 106 18
+31 107 28
+31 108 17
+31 109 25
+31 110 22
+31 111 50
+31 112 19
+31 113 50
+31 114 16
+31 115 35
+31 116 50
+31 117 16
+31 118 47
+31 119 33
+31 120 12
+31 121 54
+31 122 50
+31 123 48
+31 124 50
+31 125 19
+31 126 22
+32 0 29
+32 1 42
+32 2 13
+32 3 66
+32 4 48
+32 5 53
+32 6 33
+32 7 56
+32 8 50
+32 9 46
+32 10 34
+32 11 36
+32 13 26
+32 14 13
+32 15 35
+32 16 48
+32 17 35
+32 18 42
+32 19 36
+32 20 80
+32 21 35
+32 22 27
+32 23 36
+32 24 66
+32 25 62
+32 26 58
+32 27 30
+32 28 62
+32 29 51
+32 30 46
+32 31 56
+32 33 68
+32 34 62
+32 35 29
+32 36 31
+32 37 66
+32 38 60
+32 39 72
+32 40 56
+32 41 37
+32 42 44
+32 43 34
+32 44 37
+32 45 83
+32 46 43
+32 47 24
+32 48 61
+32 49 39
+32 50 37
+32 51 52
+32 52 49
+32 53 38
+32 54 63
+32 55 45
+32 56 51
+32 57 38
+32 58 31
+32 59 46
+32 60 25
+32 61 49
+32 62 36
+32 63 46
+32 64 28
+32 65 15
+32 66 27
+32 67 60
+32 68 13
+32 69 49
+32 70 53
+32 71 47
+32 72 47
+32 73 24
+32 74 72
+32 75 24
+32 76 35
+32 77 39
+32 78 48
+32 79 49
+32 80 44
+32 81 53
+32 82 78
+32 83 42
+32 84 35
+32 86 52
+32 87 60
+32 88 24
+32 89 45
+32 90 26
+32 91 40
+32 92 37
+32 93 40
+32 94 40
+32 95 46
+32 96 23
+32 97 37
+32 98 40
+32 99 53
+32 100 52
+32 101 26
+32 102 44
+32 103 9
+32 104 49
+32 106 31
+32 107 39
+32 108 58
+32 109 14
+32 110 23
+32 111 35
+32 112 32
+32 113 44
+32 114 29
+32 115 70
+32 116 65
+32 117 30
+32 118 52
+32 119 48
+32 120 53
+32 121 46
+32 122 44
+32 123 33
+32 124 12
+32 125 44
+32 126 35
+33 0 20
+33 1 47
+33 2 26
+33 3 38
+33 4 14
+33 5 25
+33 6 24
+33 7 28
+33 8 39
+33 9 28
+33 10 47
+33 11 39
+33 13 25
+33 14 26
+33 15 7
+33 16 50
+33 17 39
+33 18 33
+33 19 49
+33 20 12
+33 21 48
+33 22 13
+33 23 52
+33 24 38
+33 25 34
+33 26 19
+33 27 21
+33 28 33
+33 29 23
+33 30 41
+33 31 27
+33 32 39
+33 34 34
+33 35 20
+33 36 25
+33 37 38
+33 38 32
+33 39 44
+33 40 36
+33 41 50
+33 42 54
+33 43 13
+33 44 9
+33 45 53
+33 46 49
+33 47 19
+33 48 33
+33 49 30
+33 50 28
+33 51 17
+33 52 21
+33 53 48
+33 54 29
+33 55 17
+33 56 21
+33 57 51
+33 58 31
+33 59 37
+33 60 38
+33 61 39
+33 62 32
+33 63 4
+33 64 40
+33 65 34
+33 66 27
+33 67 15
+33 68 26
+33 69 39
+33 70 32
+33 71 18
+33 72 19
+33 73 15
+33 74 44
+33 75 34
+33 76 26
+33 77 42
+33 78 36
+33 79 21
+33 80 26
+33 81 37
+33 82 49
+33 83 38
+33 84 32
+33 86 24
+33 87 26
+33 88 27
+33 89 41
+33 90 27
+33 91 26
+33 92 18
+33 93 38
+33 94 36
+33 95 52
+33 96 23
+33 97 19
+33 98 40
+33 99 23
+33 100 42
+33 101 17
+33 102 30
+33 103 22
+33 104 14
+33 106 23
+33 107 29
+33 108 29
+33 109 27
+33 110 27
+33 111 51
+33 112 20
+33 113 42
+33 114 26
+33 115 40
+33 116 37
+33 117 21
+33 118 42
+33 119 20
+33 120 24
+33 121 46
+33 122 41
+33 123 51
+33 124 44
+33 125 35
+33 126 23
+34 0 42
+34 1 33
+34 2 32
+34 3 15
+34 4 44
+34 5 24
+34 6 46
+34 7 16
+34 8 40
+34 9 42
+34 10 42
+34 11 47
+34 13 37
+34 14 32
+34 15 46
+34 16 36
+34 17 40
+34 18 44
+34 19 33
+34 20 76
+34 21 43
+34 22 38
+34 23 39
+34 24 50
+34 25 33
+34 26 54
+34 27 43
+34 28 58
+34 29 22
+34 30 35
+34 31 52
+34 32 50
+34 33 64
+34 35 31
+34 36 42
+34 37 14
+34 38 44
+34 39 10
+34 40 18
+34 41 45
+34 42 40
+34 43 37
+34 44 48
+34 45 84
+34 46 41
+34 47 38
+34 48 32
+34 49 52
+34 50 45
+34 51 48
+34 52 20
+34 53 34
+34 54 59
+34 55 48
+34 56 52
+34 57 35
+34 58 41
+34 59 45
+34 60 44
+34 61 15
+34 62 47
+34 63 42
+34 64 47
+34 65 31
+34 66 40
+34 67 56
+34 68 32
+34 69 25
+34 70 33
+34 71 43
+34 72 31
+34 73 37
+34 74 32
+34 75 44
+34 76 37
+34 77 50
+34 78 29
+34 79 33
+34 80 40
+34 81 29
+34 82 74
+34 83 38
+34 84 43
+34 86 23
+34 87 56
+34 88 35
+34 89 56
+34 90 37
+34 91 31
+34 92 42
+34 93 22
+34 94 23
+34 95 43
+34 96 36
+34 97 48
+34 98 31
+34 99 54
+34 100 28
+34 101 39
+34 102 55
+34 103 28
+34 104 45
+34 106 34
+34 107 30
+34 108 54
+34 109 33
+34 110 38
+34 111 38
+34 112 35
+34 113 34
+34 114 36
+34 115 71
+34 116 36
+34 117 34
+34 118 28
+34 119 32
+34 120 49
+34 121 38
+34 122 17
+34 123 27
+34 124 50
+34 125 40
+34 126 24
+35 0 11
+35 1 42
+35 2 24
+35 3 57
+35 4 53
+35 5 44
+35 6 15
+35 7 47
+35 8 32
+35 9 51
+35 10 40
+35 11 30
+35 13 20
+35 14 24
+35 15 26
+35 16 45
+35 17 32
+35 18 13
+35 19 42
+35 20 85
+35 21 41
+35 22 18
+35 23 45
+35 24 57
+35 25 53
+35 26 60
+35 27 12
+35 28 59
+35 29 42
+35 30 32
+35 31 61
+35 32 29
+35 33 73
+35 34 53
+35 36 21
+35 37 57
+35 38 51
+35 39 56
+35 40 39
+35 41 43
+35 42 49
+35 43 6
+35 44 28
+35 45 74
+35 46 43
+35 47 17
+35 48 52
+35 49 21
+35 50 14
+35 51 57
+35 52 40
+35 53 43
+35 54 68
+35 55 36
+35 56 42
+35 57 44
+35 58 16
+35 59 17
+35 60 36
+35 61 51
+35 62 16
+35 63 46
+35 64 39
+35 65 44
+35 66 9
+35 67 65
+35 68 24
+35 69 34
+35 70 25
+35 71 52
+35 72 38
+35 73 6
+35 74 63
+35 75 23
+35 76 6
+35 77 33
+35 78 38
+35 79 40
+35 80 49
+35 81 30
+35 82 72
+35 83 47
+35 84 12
+35 86 43
+35 87 65
+35 88 18
+35 89 25
+35 90 16
+35 91 14
+35 92 11
+35 93 37
+35 94 34
+35 95 43
+35 96 5
+35 97 20
+35 98 33
+35 99 44
+35 100 37
+35 101 8
+35 102 35
+35 103 20
+35 104 54
+35 106 3
+35 107 13
+35 108 52
+35 109 24
+35 110 7
+35 111 44
+35 112 4
+35 113 35
+35 114 11
+35 115 61
+35 116 56
+35 117 3
+35 118 37
+35 119 39
+35 120 50
+35 121 39
+35 122 40
+35 123 44
+35 124 41
+35 125 49
+35 126 7
+36 0 26
+36 1 51
+36 2 10
+36 3 54
+36 4 55
+36 5 41
+36 6 30
+36 7 44
+36 8 58
+36 9 60
+36 10 49
+36 11 26
+36 13 16
+36 14 10
+36 15 25
+36 16 54
+36 17 50
+36 18 36
+36 19 51
+36 20 84
+36 21 50
+36 22 17
+36 23 51
+36 24 54
+36 25 50
+36 26 59
+36 27 27
+36 28 58
+36 29 39
+36 30 47
+36 31 70
+36 32 15
+36 33 72
+36 34 50
+36 35 26
+36 37 54
+36 38 48
+36 39 60
+36 40 46
+36 41 52
+36 42 58
+36 43 32
+36 44 25
+36 45 73
+36 46 53
+36 47 3
+36 48 49
+36 49 36
+36 50 34
+36 51 56
+36 52 37
+36 53 52
+36 54 70
+36 55 35
+36 56 41
+36 57 53
+36 58 28
+36 59 40
+36 60 22
+36 61 55
+36 62 36
+36 63 45
+36 64 25
+36 65 30
+36 66 24
+36 67 74
+36 68 10
+36 69 43
+36 70 51
+36 71 57
+36 72 35
+36 73 21
+36 74 60
+36 75 9
+36 76 29
+36 77 29
+36 78 40
+36 79 37
+36 80 58
+36 81 47
+36 82 71
+36 83 56
+36 84 32
+36 86 40
+36 87 67
+36 88 14
+36 89 45
+36 90 2
+36 91 34
+36 92 37
+36 93 54
+36 94 30
+36 95 58
+36 96 20
+36 97 27
+36 98 50
+36 99 43
+36 100 46
+36 101 23
+36 102 34
+36 103 6
+36 104 63
+36 106 29
+36 107 39
+36 108 51
+36 109 10
+36 110 30
+36 111 50
+36 112 30
+36 113 52
+36 114 26
+36 115 60
+36 116 53
+36 117 27
+36 118 46
+36 119 36
+36 120 49
+36 121 56
+36 122 49
+36 123 48
+36 124 27
+36 125 57
+36 126 33
+37 0 35
+37 1 19
+37 2 32
+37 3 1
+37 4 30
+37 5 24
+37 6 39
+37 7 16
+37 8 26
+37 9 28
+37 10 28
+37 11 40
+37 13 30
+37 14 32
+37 15 39
+37 16 22
+37 17 26
+37 18 37
+37 19 19
+37 20 62
+37 21 29
+37 22 31
+37 23 25
+37 24 50
+37 25 33
+37 26 40
+37 27 36
+37 28 44
+37 29 22
+37 30 21
+37 31 38
+37 32 43
+37 33 50
+37 34 18
+37 35 24
+37 36 34
+37 38 44
+37 39 10
+37 40 8
+37 41 31
+37 42 26
+37 43 30
+37 44 41
+37 45 70
+37 46 27
+37 47 28
+37 48 32
+37 49 45
+37 50 38
+37 51 34
+37 52 20
+37 53 20
+37 54 45
+37 55 34
+37 56 38
+37 57 21
+37 58 34
+37 59 31
+37 60 39
+37 61 1
+37 62 40
+37 63 28
+37 64 47
+37 65 17
+37 66 33
+37 67 42
+37 68 27
+37 69 11
+37 70 19
+37 71 29
+37 72 31
+37 73 30
+37 74 18
+37 75 37
+37 76 30
+37 77 43
+37 78 15
+37 79 33
+37 80 26
+37 81 15
+37 82 60
+37 83 24
+37 84 36
+37 86 16
+37 87 42
+37 88 28
+37 89 49
+37 90 30
+37 91 24
+37 92 35
+37 93 8
+37 94 23
+37 95 29
+37 96 29
+37 97 41
+37 98 17
+37 99 40
+37 100 14
+37 101 32
+37 102 48
+37 103 28
+37 104 31
+37 106 27
+37 107 23
+37 108 40
+37 109 33
+37 110 31
+37 111 24
+37 112 28
+37 113 20
+37 114 29
+37 115 57
+37 116 36
+37 117 27
+37 118 14
+37 119 32
+37 120 35
+37 121 24
+37 122 3
+37 123 13
+37 124 50
+37 125 26
+37 126 17
+38 0 28
+38 1 53
+38 2 31
+38 3 36
+38 4 62
+38 5 23
+38 6 32
+38 7 26
+38 8 49
+38 9 62
+38 10 51
+38 11 33
+38 13 23
+38 14 31
+38 15 32
+38 16 53
+38 17 49
+38 18 30
+38 19 53
+38 20 91
+38 21 52
+38 22 24
+38 23 44
+38 24 6
+38 25 32
+38 26 66
+38 27 20
+38 28 65
+38 29 21
+38 30 40
+38 31 72
+38 32 36
+38 33 79
+38 34 28
+38 35 17
+38 36 28
+38 37 36
+38 39 38
+38 40 21
+38 41 54
+38 42 48
+38 43 23
+38 44 34
+38 45 80
+38 46 42
+38 47 24
+38 48 31
+38 49 29
+38 50 27
+38 51 63
+38 52 6
+38 53 54
+38 54 77
+38 55 42
+38 56 48
+38 57 55
+38 58 27
+38 59 34
+38 60 43
+38 61 37
+38 62 31
+38 63 52
+38 64 46
+38 65 32
+38 66 26
+38 67 76
+38 68 31
+38 69 45
+38 70 42
+38 71 63
+38 72 17
+38 73 23
+38 74 42
+38 75 30
+38 76 23
+38 77 36
+38 78 47
+38 79 19
+38 80 60
+38 81 41
+38 82 78
+38 83 58
+38 84 29
+38 86 9
+38 87 74
+38 88 21
+38 89 40
+38 90 23
+38 91 17
+38 92 28
+38 93 23
+38 94 37
+38 95 51
+38 96 22
+38 97 28
+38 98 32
+38 99 50
+38 100 40
+38 101 16
+38 102 41
+38 103 27
+38 104 65
+38 106 20
+38 107 16
+38 108 58
+38 109 31
+38 110 24
+38 111 43
+38 112 21
+38 113 46
+38 114 22
+38 115 67
+38 116 22
+38 117 20
+38 118 48
+38 119 18
+38 120 56
+38 121 50
+38 122 39
+38 123 49
+38 124 48
+38 125 60
+38 126 10
+39 0 32
+39 1 45
+39 2 22
+39 3 16
+39 4 56
+39 5 14
+39 6 36
+39 7 6
+39 8 52
+39 9 54
+39 10 54
+39 11 37
+39 13 27
+39 14 22
+39 15 36
+39 16 48
+39 17 52
+39 18 34
+39 19 45
+39 20 88
+39 21 55
+39 22 28
+39 23 48
+39 24 40
+39 25 23
+39 26 66
+39 27 33
+39 28 69
+39 29 12
+39 30 47
+39 31 64
+39 32 40
+39 33 76
+39 34 12
+39 35 21
+39 36 32
+39 37 26
+39 38 34
+39 40 23
+39 41 57
+39 42 52
+39 43 27
+39 44 38
+39 45 84
+39 46 46
+39 47 28
+39 48 22
+39 49 42
+39 50 35
+39 51 60
+39 52 10
+39 53 46
+39 54 71
+39 55 46
+39 56 52
+39 57 47
+39 58 31
+39 59 38
+39 60 34
+39 61 27
+39 62 37
+39 63 54
+39 64 37
+39 65 36
+39 66 30
+39 67 68
+39 68 22
+39 69 37
+39 70 45
+39 71 55
+39 72 21
+39 73 27
+39 74 33
+39 75 34
+39 76 27
+39 77 40
+39 78 41
+39 79 23
+39 80 52
+39 81 41
+39 82 82
+39 83 50
+39 84 33
+39 86 13
+39 87 68
+39 88 25
+39 89 46
+39 90 27
+39 91 21
+39 92 32
+39 93 27
+39 94 13
+39 95 55
+39 96 26
+39 97 38
+39 98 36
+39 99 54
+39 100 40
+39 101 29
+39 102 45
+39 103 18
+39 104 57
+39 106 24
+39 107 20
+39 108 62
+39 109 23
+39 110 28
+39 111 47
+39 112 25
+39 113 46
+39 114 26
+39 115 71
+39 116 26
+39 117 24
+39 118 40
+39 119 22
+39 120 60
+39 121 50
+39 122 29
+39 123 39
+39 124 40
+39 125 52
+39 126 14
+40 0 49
+40 1 62
+40 2 39
+40 3 33
+40 4 73
+40 5 31
+40 6 53
+40 7 23
+40 8 69
+40 9 71
+40 10 71
+40 11 54
+40 13 44
+40 14 39
+40 15 53
+40 16 65
+40 17 69
+40 18 51
+40 19 62
+40 20 105
+40 21 72
+40 22 45
+40 23 65
+40 24 57
+40 25 40
+40 26 83
+40 27 50
+40 28 86
+40 29 29
+40 30 64
+40 31 81
+40 32 57
+40 33 93
+40 34 29
+40 35 38
+40 36 49
+40 37 43
+40 38 51
+40 39 17
+40 41 74
+40 42 69
+40 43 44
+40 44 55
+40 45 101
+40 46 63
+40 47 45
+40 48 39
+40 49 59
+40 50 52
+40 51 77
+40 52 27
+40 53 63
+40 54 88
+40 55 63
+40 56 69
+40 57 64
+40 58 48
+40 59 55
+40 60 51
+40 61 44
+40 62 54
+40 63 71
+40 64 54
+40 65 53
+40 66 47
+40 67 85
+40 68 39
+40 69 54
+40 70 62
+40 71 72
+40 72 38
+40 73 44
+40 74 50
+40 75 51
+40 76 44
+40 77 57
+40 78 58
+40 79 40
+40 80 69
+40 81 58
+40 82 99
+40 83 67
+40 84 50
+40 86 30
+40 87 85
+40 88 42
+40 89 63
+40 90 44
+40 91 38
+40 92 49
+40 93 44
+40 94 30
+40 95 72
+40 96 43
+40 97 55
+40 98 53
+40 99 71
+40 100 57
+40 101 46
+40 102 62
+40 103 35
+40 104 74
+40 106 41
+40 107 37
+40 108 79
+40 109 40
+40 110 45
+40 111 64
+40 112 42
+40 113 63
+40 114 43
+40 115 88
+40 116 43
+40 117 41
+40 118 57
+40 119 39
+40 120 77
+40 121 67
+40 122 46
+40 123 56
+40 124 57
+40 125 69
+40 126 31
+41 0 36
+41 1 20
+41 2 30
+41 3 81
+41 4 26
+41 5 68
+41 6 40
+41 7 71
+41 8 34
+41 9 24
+41 10 27
+41 11 51
+41 13 41
+41 14 30
+41 15 50
+41 16 26
+41 17 31
+41 18 36
+41 19 14
+41 20 58
+41 21 28
+41 22 42
+41 23 20
+41 24 81
+41 25 77
+41 26 36
+41 27 37
+41 28 40
+41 29 66
+41 30 17
+41 31 34
+41 32 44
+41 33 46
+41 34 77
+41 35 35
+41 36 29
+41 37 81
+41 38 75
+41 39 81
+41 40 64
+41 42 22
+41 43 41
+41 44 52
+41 45 66
+41 46 27
+41 47 23
+41 48 76
+41 49 46
+41 50 37
+41 51 30
+41 52 64
+41 53 16
+41 54 41
+41 55 32
+41 56 34
+41 57 16
+41 58 40
+41 59 40
+41 60 34
+41 61 27
+41 62 43
+41 63 24
+41 64 45
+41 65 30
+41 66 34
+41 67 38
+41 68 22
+41 69 17
+41 70 45
+41 71 25
+41 72 62
+41 73 31
+41 74 87
+41 75 38
+41 76 29
+41 77 54
+41 78 14
+41 79 64
+41 80 22
+41 81 21
+41 82 56
+41 83 20
+41 84 42
+41 86 67
+41 87 38
+41 88 39
+41 89 52
+41 90 31
+41 91 35
+41 92 39
+41 93 24
+41 94 55
+41 95 24
+41 96 30
+41 97 45
+41 98 18
+41 99 36
+41 100 20
+41 101 33
+41 102 59
+41 103 26
+41 104 27
+41 106 38
+41 107 34
+41 108 36
+41 109 31
+41 110 30
+41 111 19
+41 112 39
+41 113 22
+41 114 36
+41 115 53
+41 116 80
+41 117 37
+41 118 20
+41 119 63
+41 120 31
+41 121 26
+41 122 22
+41 123 34
+41 124 48
+41 125 22
+41 126 28
+42 0 53
+42 1 37
+42 2 47
+42 3 100
+42 4 43
+42 5 87
+42 6 57
+42 7 90
+42 8 46
+42 9 41
+42 10 44
+42 11 70
+42 13 60
+42 14 47
+42 15 69
+42 16 43
+42 17 48
+42 18 53
+42 19 31
+42 20 75
+42 21 45
+42 22 61
+42 23 37
+42 24 100
+42 25 96
+42 26 53
+42 27 54
+42 28 57
+42 29 85
+42 30 41
+42 31 51
+42 32 61
+42 33 63
+42 34 96
+42 35 53
+42 36 46
+42 37 100
+42 38 94
+42 39 98
+42 40 81
+42 41 47
+42 43 58
+42 44 71
+42 45 83
+42 46 39
+42 47 40
+42 48 95
+42 49 63
+42 50 54
+42 51 47
+42 52 83
+42 53 33
+42 54 58
+42 55 49
+42 56 51
+42 57 33
+42 58 57
+42 59 57
+42 60 51
+42 61 44
+42 62 60
+42 63 41
+42 64 62
+42 65 29
+42 66 51
+42 67 55
+42 68 39
+42 69 42
+42 70 62
+42 71 42
+42 72 81
+42 73 48
+42 74 106
+42 75 55
+42 76 46
+42 77 73
+42 78 43
+42 79 83
+42 80 39
+42 81 38
+42 82 73
+42 83 37
+42 84 59
+42 86 86
+42 87 55
+42 88 58
+42 89 69
+42 90 48
+42 91 60
+42 92 56
+42 93 20
+42 94 74
+42 95 41
+42 96 47
+42 97 62
+42 98 29
+42 99 53
+42 100 37
+42 101 50
+42 102 78
+42 103 43
+42 104 44
+42 106 55
+42 107 59
+42 108 53
+42 109 48
+42 110 47
+42 111 36
+42 112 56
+42 113 39
+42 114 53
+42 115 70
+42 116 99
+42 117 54
+42 118 45
+42 119 82
+42 120 48
+42 121 43
+42 122 15
+42 123 47
+42 124 65
+42 125 39
+42 126 53
+43 0 7
+43 1 36
+43 2 25
+43 3 63
+43 4 47
+43 5 50
+43 6 11
+43 7 53
+43 8 26
+43 9 45
+43 10 34
+43 11 33
+43 13 23
+43 14 27
+43 15 32
+43 16 39
+43 17 26
+43 18 20
+43 19 36
+43 20 79
+43 21 35
+43 22 24
+43 23 39
+43 24 63
+43 25 59
+43 26 57
+43 27 8
+43 28 57
+43 29 48
+43 30 28
+43 31 55
+43 32 32
+43 33 67
+43 34 59
+43 35 7
+43 36 24
+43 37 63
+43 38 57
+43 39 52
+43 40 35
+43 41 37
+43 42 43
+43 44 34
+43 45 72
+43 46 37
+43 47 20
+43 48 58
+43 49 17
+43 50 15
+43 51 51
+43 52 46
+43 53 37
+43 54 62
+43 55 34
+43 56 40
+43 57 38
+43 58 21
+43 59 24
+43 60 38
+43 61 45
+43 62 19
+43 63 44
+43 64 42
+43 65 38
+43 66 14
+43 67 59
+43 68 27
+43 69 28
+43 70 19
+43 71 46
+43 72 44
+43 73 2
+43 74 69
+43 75 26
+43 76 13
+43 77 36
+43 78 32
+43 79 46
+43 80 43
+43 81 24
+43 82 70
+43 83 41
+43 84 19
+43 86 49
+43 87 59
+43 88 21
+43 89 28
+43 90 19
+43 91 17
+43 92 5
+43 93 31
+43 94 37
+43 95 39
+43 96 10
+43 97 16
+43 98 27
+43 99 42
+43 100 31
+43 101 4
+43 102 41
+43 103 23
+43 104 48
+43 106 10
+43 107 16
+43 108 50
+43 109 27
+43 110 14
+43 111 38
+43 112 7
+43 113 29
+43 114 16
+43 115 59
+43 116 62
+43 117 8
+43 118 31
+43 119 45
+43 120 48
+43 121 33
+43 122 34
+43 123 38
+43 124 44
+43 125 43
+43 126 10
+44 0 34
+44 1 38
+44 2 24
+44 3 29
+44 4 42
+44 5 16
+44 6 38
+44 7 19
+44 8 47
+44 9 47
+44 10 47
+44 11 30
+44 13 16
+44 14 24
+44 15 12
+44 16 41
+44 17 47
+44 18 36
+44 19 43
+44 20 71
+44 21 45
+44 22 4
+44 23 48
+44 24 29
+44 25 25
+44 26 46
+44 27 35
+44 28 45
+44 29 14
+44 30 40
+44 31 57
+44 32 30
+44 33 59
+44 34 25
+44 35 23
+44 36 16
+44 37 29
+44 38 23
+44 39 35
+44 40 27
+44 41 47
+44 42 45
+44 43 29
+44 45 60
+44 46 40
+44 47 19
+44 48 24
+44 49 44
+44 50 37
+44 51 43
+44 52 12
+44 53 39
+44 54 57
+44 55 22
+44 56 28
+44 57 45
+44 58 33
+44 59 40
+44 60 36
+44 61 30
+44 62 39
+44 63 32
+44 64 39
+44 65 38
+44 66 32
+44 67 61
+44 68 24
+44 69 30
+44 70 48
+44 71 44
+44 72 10
+44 73 29
+44 74 35
+44 75 25
+44 76 29
+44 77 33
+44 78 27
+44 79 12
+44 80 45
+44 81 34
+44 82 58
+44 83 43
+44 84 35
+44 86 15
+44 87 54
+44 88 18
+44 89 48
+44 90 18
+44 91 23
+44 92 34
+44 93 29
+44 94 27
+44 95 51
+44 96 28
+44 97 24
+44 98 37
+44 99 30
+44 100 33
+44 101 31
+44 102 21
+44 103 20
+44 104 50
+44 106 26
+44 107 22
+44 108 38
+44 109 25
+44 110 30
+44 111 47
+44 112 27
+44 113 39
+44 114 28
+44 115 47
+44 116 28
+44 117 26
+44 118 33
+44 119 11
+44 120 36
+44 121 43
+44 122 32
+44 123 42
+44 124 42
+44 125 44
+44 126 16
+45 0 28
+45 1 65
+45 2 35
+45 3 64
+45 4 30
+45 5 51
+45 6 32
+45 7 54
+45 8 60
+45 9 24
+45 10 62
+45 11 58
+45 13 48
+45 14 46
+45 15 33
+45 16 62
+45 17 60
+45 18 41
+45 19 64
+45 20 60
+45 21 63
+45 22 39
+45 23 64
+45 24 64
+45 25 60
+45 26 35
+45 27 29
+45 28 34
+45 29 49
+45 30 49
+45 31 13
+45 32 51
+45 33 48
+45 34 60
+45 35 28
+45 36 43
+45 37 64
+45 38 58
+45 39 70
+45 40 56
+45 41 65
+45 42 72
+45 43 34
+45 44 35
+45 46 71
+45 47 39
+45 48 59
+45 49 38
+45 50 36
+45 51 26
+45 52 47
+45 53 66
+45 54 45
+45 55 32
+45 56 34
+45 57 66
+45 58 33
+45 59 45
+45 60 27
+45 61 65
+45 62 40
+45 63 33
+45 64 26
+45 65 43
+45 66 35
+45 67 18
+45 68 43
+45 69 62
+45 70 53
+45 71 19
+45 72 45
+45 73 23
+45 74 70
+45 75 45
+45 76 34
+45 77 61
+45 78 62
+45 79 47
+45 80 32
+45 81 58
+45 82 50
+45 83 30
+45 84 40
+45 86 50
+45 87 42
+45 88 46
+45 89 49
+45 90 38
+45 91 42
+45 92 38
+45 93 64
+45 94 62
+45 95 60
+45 96 31
+45 97 37
+45 98 61
+45 99 31
+45 100 61
+45 101 25
+45 102 56
+45 103 42
+45 104 27
+45 106 31
+45 107 41
+45 108 30
+45 109 38
+45 110 35
+45 111 63
+45 112 32
+45 113 63
+45 114 29
+45 115 48
+45 116 63
+45 117 29
+45 118 60
+45 119 46
+45 120 25
+45 121 67
+45 122 63
+45 123 61
+45 124 63
+45 125 32
+45 126 35
+46 0 33
+46 1 20
+46 2 19
+46 3 71
+46 4 26
+46 5 58
+46 6 37
+46 7 61
+46 8 7
+46 9 24
+46 10 12
+46 11 42
+46 13 32
+46 14 19
+46 15 40
+46 16 26
+46 17 31
+46 18 21
+46 19 14
+46 20 58
+46 21 13
+46 22 32
+46 23 9
+46 24 71
+46 25 67
+46 26 36
+46 27 34
+46 28 40
+46 29 56
+46 30 27
+46 31 34
+46 32 44
+46 33 46
+46 34 67
+46 35 32
+46 36 29
+46 37 71
+46 38 65
+46 39 77
+46 40 61
+46 41 15
+46 42 22
+46 43 26
+46 44 42
+46 45 66
+46 47 12
+46 48 66
+46 49 37
+46 50 22
+46 51 30
+46 52 54
+46 53 16
+46 54 41
+46 55 32
+46 56 34
+46 57 16
+46 58 36
+46 59 25
+46 60 31
+46 61 27
+46 62 28
+46 63 24
+46 64 34
+46 65 16
+46 66 29
+46 67 38
+46 68 19
+46 69 29
+46 70 45
+46 71 25
+46 72 52
+46 73 28
+46 74 77
+46 75 38
+46 76 14
+46 77 45
+46 78 26
+46 79 54
+46 80 22
+46 81 27
+46 82 56
+46 83 20
+46 84 39
+46 86 57
+46 87 38
+46 88 30
+46 89 37
+46 90 31
+46 91 32
+46 92 29
+46 93 13
+46 94 46
+46 95 24
+46 96 27
+46 97 42
+46 98 18
+46 99 36
+46 100 30
+46 101 30
+46 102 49
+46 103 15
+46 104 27
+46 106 23
+46 107 31
+46 108 36
+46 109 20
+46 110 15
+46 111 18
+46 112 24
+46 113 20
+46 114 31
+46 115 53
+46 116 70
+46 117 32
+46 118 32
+46 119 53
+46 120 31
+46 121 24
+46 122 13
+46 123 23
+46 124 37
+46 125 22
+46 126 27
+47 0 23
+47 1 55
+47 2 7
+47 3 60
+47 4 59
+47 5 47
+47 6 27
+47 7 50
+47 8 55
+47 9 59
+47 10 47
+47 11 30
+47 13 20
+47 14 7
+47 15 29
+47 16 57
+47 17 48
+47 18 36
+47 19 49
+47 20 88
+47 21 48
+47 22 21
+47 23 49
+47 24 60
+47 25 56
+47 26 63
+47 27 24
+47 28 62
+47 29 45
+47 30 44
+47 31 69
+47 32 33
+47 33 76
+47 34 56
+47 35 23
+47 36 25
+47 37 60
+47 38 54
+47 39 66
+47 40 50
+47 41 50
+47 42 57
+47 43 29
+47 44 31
+47 45 77
+47 46 56
+47 48 55
+47 49 33
+47 50 31
+47 51 60
+47 52 43
+47 53 51
+47 54 74
+47 55 39
+47 56 45
+47 57 51
+47 58 25
+47 59 40
+47 60 19
+47 61 61
+47 62 33
+47 63 49
+47 64 22
+47 65 28
+47 66 21
+47 67 73
+47 68 7
+47 69 47
+47 70 48
+47 71 60
+47 72 41
+47 73 18
+47 74 66
+47 75 27
+47 76 29
+47 77 33
+47 78 44
+47 79 43
+47 80 57
+47 81 51
+47 82 75
+47 83 55
+47 84 29
+47 86 46
+47 87 71
+47 88 18
+47 89 42
+47 90 20
+47 91 37
+47 92 34
+47 93 53
+47 94 34
+47 95 55
+47 96 17
+47 97 31
+47 98 53
+47 99 47
+47 100 50
+47 101 20
+47 102 38
+47 103 3
+47 104 62
+47 106 26
+47 107 36
+47 108 55
+47 109 8
+47 110 30
+47 111 48
+47 112 27
+47 113 56
+47 114 23
+47 115 64
+47 116 59
+47 117 24
+47 118 50
+47 119 42
+47 120 53
+47 121 59
+47 122 53
+47 123 46
+47 124 25
+47 125 57
+47 126 30
+48 0 37
+48 1 56
+48 2 22
+48 3 9
+48 4 67
+48 5 14
+48 6 41
+48 7 17
+48 8 58
+48 9 65
+48 10 60
+48 11 42
+48 13 32
+48 14 22
+48 15 41
+48 16 59
+48 17 58
+48 18 39
+48 19 56
+48 20 99
+48 21 61
+48 22 33
+48 23 53
+48 24 45
+48 25 12
+48 26 75
+48 27 38
+48 28 74
+48 29 14
+48 30 53
+48 31 75
+48 32 45
+48 33 87
+48 34 23
+48 35 26
+48 36 37
+48 37 37
+48 38 39
+48 39 18
+48 40 16
+48 41 63
+48 42 57
+48 43 32
+48 44 43
+48 45 89
+48 46 51
+48 47 33
+48 49 47
+48 50 40
+48 51 71
+48 52 15
+48 53 57
+48 54 82
+48 55 51
+48 56 57
+48 57 58
+48 58 36
+48 59 39
+48 60 34
+48 61 38
+48 62 42
+48 63 61
+48 64 37
+48 65 41
+48 66 35
+48 67 79
+48 68 22
+48 69 48
+48 70 51
+48 71 66
+48 72 26
+48 73 32
+48 74 26
+48 75 39
+48 76 32
+48 77 45
+48 78 52
+48 79 28
+48 80 63
+48 81 50
+48 82 87
+48 83 61
+48 84 38
+48 86 18
+48 87 79
+48 88 30
+48 89 51
+48 90 32
+48 91 26
+48 92 37
+48 93 32
+48 94 31
+48 95 64
+48 96 31
+48 97 43
+48 98 41
+48 99 59
+48 100 49
+48 101 34
+48 102 50
+48 103 18
+48 104 68
+48 106 29
+48 107 25
+48 108 67
+48 109 23
+48 110 33
+48 111 52
+48 112 30
+48 113 55
+48 114 31
+48 115 76
+48 116 31
+48 117 29
+48 118 51
+48 119 27
+48 120 65
+48 121 59
+48 122 40
+48 123 50
+48 124 40
+48 125 63
+48 126 19
+49 0 16
+49 1 27
+49 2 34
+49 3 63
+49 4 45
+49 5 50
+49 6 20
+49 7 53
+49 8 35
+49 9 43
+49 10 34
+49 11 42
+49 13 32
+49 14 36
+49 15 32
+49 16 24
+49 17 35
+49 18 13
+49 19 36
+49 20 77
+49 21 35
+49 22 24
+49 23 31
+49 24 63
+49 25 59
+49 26 55
+49 27 17
+49 28 59
+49 29 48
+49 30 11
+49 31 53
+49 32 41
+49 33 65
+49 34 59
+49 35 16
+49 36 33
+49 37 63
+49 38 57
+49 39 61
+49 40 44
+49 41 37
+49 42 39
+49 43 9
+49 44 34
+49 45 80
+49 46 33
+49 47 29
+49 48 58
+49 50 14
+49 51 49
+49 52 46
+49 53 35
+49 54 60
+49 55 42
+49 56 48
+49 57 33
+49 58 20
+49 59 17
+49 60 47
+49 61 44
+49 62 28
+49 63 43
+49 64 51
+49 65 28
+49 66 23
+49 67 57
+49 68 36
+49 69 29
+49 70 28
+49 71 44
+49 72 44
+49 73 11
+49 74 69
+49 75 35
+49 76 22
+49 77 45
+49 78 33
+49 79 46
+49 80 41
+49 81 25
+49 82 75
+49 83 39
+49 84 28
+49 86 49
+49 87 57
+49 88 30
+49 89 37
+49 90 28
+49 91 26
+49 92 14
+49 93 35
+49 94 46
+49 95 22
+49 96 19
+49 97 25
+49 98 23
+49 99 50
+49 100 32
+49 101 13
+49 102 41
+49 103 32
+49 104 46
+49 106 19
+49 107 25
+49 108 55
+49 109 36
+49 110 23
+49 111 30
+49 112 16
+49 113 30
+49 114 25
+49 115 67
+49 116 62
+49 117 17
+49 118 32
+49 119 45
+49 120 50
+49 121 34
+49 122 35
+49 123 28
+49 124 53
+49 125 41
+49 126 19
+50 0 14
+50 1 43
+50 2 25
+50 3 49
+50 4 48
+50 5 36
+50 6 18
+50 7 39
+50 8 33
+50 9 52
+50 10 41
+50 11 31
+50 13 21
+50 14 25
+50 15 18
+50 16 46
+50 17 33
+50 18 20
+50 19 43
+50 20 77
+50 21 42
+50 22 10
+50 23 46
+50 24 49
+50 25 45
+50 26 52
+50 27 15
+50 28 51
+50 29 34
+50 30 35
+50 31 62
+50 32 30
+50 33 65
+50 34 45
+50 35 14
+50 36 22
+50 37 49
+50 38 43
+50 39 55
+50 40 42
+50 41 44
+50 42 50
+50 43 7
+50 44 20
+50 45 66
+50 46 44
+50 47 18
+50 48 44
+50 49 24
+50 51 49
+50 52 32
+50 53 44
+50 54 63
+50 55 28
+50 56 34
+50 57 45
+50 58 23
+50 59 24
+50 60 37
+50 61 50
+50 62 26
+50 63 38
+50 64 40
+50 65 45
+50 66 16
+50 67 66
+50 68 25
+50 69 35
+50 70 26
+50 71 50
+50 72 30
+50 73 9
+50 74 55
+50 75 24
+50 76 13
+50 77 34
+50 78 33
+50 79 32
+50 80 50
+50 81 31
+50 82 64
+50 83 48
+50 84 24
+50 86 35
+50 87 60
+50 88 19
+50 89 35
+50 90 17
+50 91 15
+50 92 12
+50 93 38
+50 94 33
+50 95 46
+50 96 12
+50 97 23
+50 98 34
+50 99 36
+50 100 38
+50 101 11
+50 102 27
+50 103 21
+50 104 55
+50 106 17
+50 107 14
+50 108 44
+50 109 25
+50 110 14
+50 111 45
+50 112 5
+50 113 36
+50 114 18
+50 115 53
+50 116 48
+50 117 15
+50 118 38
+50 119 31
+50 120 42
+50 121 40
+50 122 41
+50 123 45
+50 124 42
+50 125 50
+50 126 8
+51 0 31
+51 1 44
+51 2 42
+51 3 68
+51 4 18
+51 5 55
+51 6 35
+51 7 58
+51 8 50
+51 9 16
+51 10 36
+51 11 48
+51 13 38
+51 14 42
+51 15 37
+51 16 50
+51 17 37
+51 18 44
+51 19 38
+51 20 42
+51 21 37
+51 22 39
+51 23 38
+51 24 68
+51 25 64
+51 26 17
+51 27 32
+51 28 16
+51 29 53
+51 30 44
+51 31 26
+51 32 47
+51 33 30
+51 34 64
+51 35 31
+51 36 39
+51 37 68
+51 38 62
+51 39 74
+51 40 59
+51 41 39
+51 42 46
+51 43 24
+51 44 39
+51 45 43
+51 46 45
+51 47 35
+51 48 63
+51 49 33
+51 50 39
+51 52 51
+51 53 40
+51 54 33
+51 55 24
+51 56 26
+51 57 40
+51 58 37
+51 59 48
+51 60 40
+51 61 51
+51 62 42
+51 63 15
+51 64 39
+51 65 17
+51 66 30
+51 67 30
+51 68 42
+51 69 48
+51 70 43
+51 71 1
+51 72 49
+51 73 26
+51 74 74
+51 75 41
+51 76 37
+51 77 51
+51 78 50
+51 79 51
+51 80 14
+51 81 44
+51 82 32
+51 83 26
+51 84 38
+51 86 54
+51 87 30
+51 88 36
+51 89 51
+51 90 34
+51 91 32
+51 92 20
+51 93 42
+51 94 52
+51 95 48
+51 96 26
+51 97 40
+51 98 42
+51 99 13
+51 100 43
+51 101 28
+51 102 56
+51 103 38
+51 104 19
+51 106 34
+51 107 31
+51 108 12
+51 109 42
+51 110 38
+51 111 37
+51 112 22
+51 113 46
+51 114 32
+51 115 30
+51 116 67
+51 117 32
+51 118 42
+51 119 50
+51 120 7
+51 121 48
+51 122 45
+51 123 35
+51 124 59
+51 125 18
+51 126 25
+52 0 22
+52 1 47
+52 2 25
+52 3 30
+52 4 56
+52 5 17
+52 6 26
+52 7 20
+52 8 43
+52 9 56
+52 10 45
+52 11 27
+52 13 17
+52 14 25
+52 15 26
+52 16 50
+52 17 43
+52 18 24
+52 19 47
+52 20 85
+52 21 46
+52 22 18
+52 23 38
+52 24 30
+52 25 26
+52 26 60
+52 27 23
+52 28 59
+52 29 15
+52 30 38
+52 31 66
+52 32 30
+52 33 73
+52 34 22
+52 35 11
+52 36 22
+52 37 30
+52 38 24
+52 39 32
+52 40 15
+52 41 48
+52 42 42
+52 43 17
+52 44 28
+52 45 74
+52 46 36
+52 47 18
+52 48 25
+52 49 32
+52 50 25
+52 51 57
+52 53 48
+52 54 71
+52 55 36
+52 56 42
+52 57 49
+52 58 21
+52 59 28
+52 60 37
+52 61 31
+52 62 27
+52 63 46
+52 64 40
+52 65 26
+52 66 20
+52 67 70
+52 68 25
+52 69 39
+52 70 36
+52 71 57
+52 72 11
+52 73 17
+52 74 36
+52 75 24
+52 76 17
+52 77 30
+52 78 41
+52 79 13
+52 80 54
+52 81 35
+52 82 72
+52 83 52
+52 84 23
+52 86 3
+52 87 68
+52 88 15
+52 89 36
+52 90 17
+52 91 11
+52 92 22
+52 93 17
+52 94 31
+52 95 49
+52 96 16
+52 97 28
+52 98 26
+52 99 44
+52 100 34
+52 101 19
+52 102 35
+52 103 21
+52 104 59
+52 106 14
+52 107 10
+52 108 52
+52 109 25
+52 110 18
+52 111 37
+52 112 15
+52 113 40
+52 114 16
+52 115 61
+52 116 16
+52 117 14
+52 118 42
+52 119 12
+52 120 50
+52 121 44
+52 122 33
+52 123 43
+52 124 42
+52 125 54
+52 126 4
+53 0 20
+53 1 28
+53 2 38
+53 3 68
+53 4 10
+53 5 55
+53 6 24
+53 7 58
+53 8 37
+53 9 8
+53 10 35
+53 11 50
+53 13 40
+53 14 38
+53 15 37
+53 16 33
+53 17 39
+53 18 33
+53 19 22
+53 20 42
+53 21 36
+53 22 32
+53 23 28
+53 24 68
+53 25 64
+53 26 20
+53 27 21
+53 28 24
+53 29 53
+53 30 20
+53 31 18
+53 32 49
+53 33 30
+53 34 64
+53 35 20
+53 36 37
+53 37 68
+53 38 62
+53 39 65
+53 40 48
+53 41 38
+53 42 6
+53 43 26
+53 44 39
+53 45 50
+53 46 30
+53 47 31
+53 48 63
+53 49 30
+53 50 28
+53 51 14
+53 52 51
+53 54 25
+53 55 16
+53 56 18
+53 57 24
+53 58 25
+53 59 37
+53 60 32
+53 61 35
+53 62 30
+53 63 8
+53 64 31
+53 65 20
+53 66 18
+53 67 22
+53 68 30
+53 69 33
+53 70 45
+53 71 9
+53 72 49
+53 73 15
+53 74 74
+53 75 43
+53 76 26
+53 77 53
+53 78 34
+53 79 51
+53 80 6
+53 81 29
+53 82 40
+53 83 4
+53 84 26
+53 86 54
+53 87 22
+53 88 38
+53 89 39
+53 90 36
+53 91 34
+53 92 23
+53 93 11
+53 94 54
+53 95 31
+53 96 14
+53 97 29
+53 98 20
+53 99 20
+53 100 28
+53 101 17
+53 102 49
+53 103 34
+53 104 11
+53 106 23
+53 107 33
+53 108 20
+53 109 39
+53 110 27
+53 111 27
+53 112 24
+53 113 30
+53 114 20
+53 115 37
+53 116 67
+53 117 21
+53 118 36
+53 119 50
+53 120 15
+53 121 34
+53 122 6
+53 123 37
+53 124 56
+53 125 6
+53 126 27
+54 0 25
+54 1 48
+54 2 31
+54 3 43
+54 4 19
+54 5 30
+54 6 29
+54 7 33
+54 8 44
+54 9 20
+54 10 40
+54 11 44
+54 13 30
+54 14 31
+54 15 12
+54 16 54
+54 17 41
+54 18 38
+54 19 42
+54 20 17
+54 21 41
+54 22 18
+54 23 42
+54 24 43
+54 25 39
+54 26 21
+54 27 26
+54 28 20
+54 29 28
+54 30 46
+54 31 30
+54 32 44
+54 33 5
+54 34 39
+54 35 25
+54 36 30
+54 37 43
+54 38 37
+54 39 49
+54 40 41
+54 41 43
+54 42 50
+54 43 18
+54 44 14
+54 45 31
+54 46 49
+54 47 24
+54 48 38
+54 49 35
+54 50 33
+54 51 4
+54 52 26
+54 53 44
+54 55 22
+54 56 8
+54 57 44
+54 58 35
+54 59 42
+54 60 43
+54 61 44
+54 62 37
+54 63 9
+54 64 43
+54 65 21
+54 66 28
+54 67 20
+54 68 31
+54 69 44
+54 70 37
+54 71 5
+54 72 24
+54 73 20
+54 74 49
+54 75 39
+54 76 31
+54 77 47
+54 78 41
+54 79 26
+54 80 18
+54 81 42
+54 82 36
+54 83 30
+54 84 36
+54 86 29
+54 87 31
+54 88 32
+54 89 46
+54 90 32
+54 91 31
+54 92 23
+54 93 43
+54 94 41
+54 95 52
+54 96 24
+54 97 24
+54 98 45
+54 99 10
+54 100 47
+54 101 22
+54 102 35
+54 103 27
+54 104 19
+54 106 28
+54 107 34
+54 108 16
+54 109 32
+54 110 32
+54 111 41
+54 112 25
+54 113 47
+54 114 30
+54 115 18
+54 116 42
+54 117 26
+54 118 46
+54 119 25
+54 120 11
+54 121 51
+54 122 46
+54 123 39
+54 124 49
+54 125 16
+54 126 28
+55 0 36
+55 1 51
+55 2 49
+55 3 75
+55 4 20
+55 5 62
+55 6 40
+55 7 65
+55 8 57
+55 9 35
+55 10 57
+55 11 55
+55 13 45
+55 14 49
+55 15 44
+55 16 63
+55 17 57
+55 18 49
+55 19 59
+55 20 49
+55 21 58
+55 22 46
+55 23 59
+55 24 75
+55 25 71
+55 26 24
+55 27 37
+55 28 23
+55 29 60
+55 30 51
+55 31 42
+55 32 54
+55 33 37
+55 34 71
+55 35 36
+55 36 46
+55 37 75
+55 38 69
+55 39 81
+55 40 64
+55 41 60
+55 42 58
+55 43 31
+55 44 46
+55 45 38
+55 46 61
+55 47 42
+55 48 70
+55 49 40
+55 50 44
+55 51 21
+55 52 58
+55 53 52
+55 54 35
+55 56 6
+55 57 61
+55 58 41
+55 59 53
+55 60 56
+55 61 72
+55 62 46
+55 63 10
+55 64 55
+55 65 38
+55 66 34
+55 67 39
+55 68 49
+55 69 52
+55 70 50
+55 71 22
+55 72 56
+55 73 31
+55 74 81
+55 75 48
+55 76 42
+55 77 58
+55 78 56
+55 79 58
+55 80 33
+55 81 48
+55 82 36
+55 83 31
+55 84 42
+55 86 61
+55 87 32
+55 88 43
+55 89 55
+55 90 41
+55 91 39
+55 92 27
+55 93 54
+55 94 59
+55 95 62
+55 96 30
+55 97 45
+55 98 51
+55 99 8
+55 100 47
+55 101 33
+55 102 63
+55 103 45
+55 104 29
+55 106 39
+55 107 38
+55 108 16
+55 109 49
+55 110 43
+55 111 58
+55 112 29
+55 113 53
+55 114 36
+55 115 25
+55 116 74
+55 117 37
+55 118 46
+55 119 57
+55 120 14
+55 121 57
+55 122 49
+55 123 56
+55 124 66
+55 125 22
+55 126 32
+56 0 30
+56 1 45
+56 2 48
+56 3 70
+56 4 14
+56 5 57
+56 6 34
+56 7 60
+56 8 62
+56 9 29
+56 10 51
+56 11 60
+56 13 50
+56 14 54
+56 15 39
+56 16 57
+56 17 52
+56 18 43
+56 19 53
+56 20 44
+56 21 52
+56 22 42
+56 23 53
+56 24 70
+56 25 66
+56 26 29
+56 27 31
+56 28 18
+56 29 55
+56 30 51
+56 31 39
+56 32 59
+56 33 32
+56 34 66
+56 35 30
+56 36 51
+56 37 70
+56 38 64
+56 39 75
+56 40 58
+56 41 54
+56 42 52
+56 43 36
+56 44 41
+56 45 32
+56 46 55
+56 47 47
+56 48 65
+56 49 40
+56 50 38
+56 51 15
+56 52 53
+56 53 46
+56 54 29
+56 55 37
+56 57 55
+56 58 35
+56 59 47
+56 60 53
+56 61 66
+56 62 40
+56 63 4
+56 64 52
+56 65 32
+56 66 28
+56 67 33
+56 68 54
+56 69 46
+56 70 55
+56 71 16
+56 72 51
+56 73 25
+56 74 76
+56 75 53
+56 76 36
+56 77 63
+56 78 50
+56 79 53
+56 80 27
+56 81 42
+56 82 30
+56 83 25
+56 84 36
+56 86 56
+56 87 26
+56 88 48
+56 89 49
+56 90 46
+56 91 44
+56 92 32
+56 93 48
+56 94 64
+56 95 60
+56 96 24
+56 97 39
+56 98 45
+56 99 2
+56 100 41
+56 101 27
+56 102 59
+56 103 50
+56 104 32
+56 106 33
+56 107 43
+56 108 10
+56 109 54
+56 110 37
+56 111 52
+56 112 34
+56 113 47
+56 114 30
+56 115 19
+56 116 69
+56 117 31
+56 118 40
+56 119 52
+56 120 19
+56 121 51
+56 122 43
+56 123 50
+56 124 71
+56 125 16
+56 126 37
+57 0 32
+57 1 8
+57 2 23
+57 3 67
+57 4 25
+57 5 54
+57 6 36
+57 7 57
+57 8 26
+57 9 23
+57 10 11
+57 11 39
+57 13 29
+57 14 23
+57 15 38
+57 16 10
+57 17 19
+57 18 20
+57 19 13
+57 20 57
+57 21 12
+57 22 30
+57 23 17
+57 24 67
+57 25 63
+57 26 35
+57 27 33
+57 28 39
+57 29 52
+57 30 15
+57 31 33
+57 32 28
+57 33 45
+57 34 63
+57 35 31
+57 36 13
+57 37 67
+57 38 61
+57 39 73
+57 40 59
+57 41 14
+57 42 13
+57 43 25
+57 44 38
+57 45 65
+57 46 19
+57 47 16
+57 48 62
+57 49 36
+57 50 21
+57 51 29
+57 52 50
+57 53 15
+57 54 40
+57 55 31
+57 56 33
+57 58 35
+57 59 24
+57 60 33
+57 61 11
+57 62 27
+57 63 23
+57 64 38
+57 65 14
+57 66 28
+57 67 37
+57 68 21
+57 69 13
+57 70 29
+57 71 24
+57 72 48
+57 73 27
+57 74 73
+57 75 22
+57 76 13
+57 77 42
+57 78 10
+57 79 50
+57 80 21
+57 81 17
+57 82 55
+57 83 19
+57 84 38
+57 86 53
+57 87 37
+57 88 27
+57 89 36
+57 90 15
+57 91 31
+57 92 28
+57 93 18
+57 94 43
+57 95 8
+57 96 26
+57 97 40
+57 98 9
+57 99 35
+57 100 16
+57 101 29
+57 102 47
+57 103 19
+57 104 26
+57 106 22
+57 107 30
+57 108 35
+57 109 23
+57 110 14
+57 111 16
+57 112 23
+57 113 6
+57 114 30
+57 115 52
+57 116 66
+57 117 31
+57 118 16
+57 119 49
+57 120 30
+57 121 10
+57 122 13
+57 123 23
+57 124 40
+57 125 21
+57 126 24
+58 0 13
+58 1 44
+58 2 26
+58 3 59
+58 4 55
+58 5 46
+58 6 17
+58 7 49
+58 8 34
+58 9 53
+58 10 42
+58 11 32
+58 13 22
+58 14 26
+58 15 28
+58 16 47
+58 17 34
+58 18 15
+58 19 44
+58 20 87
+58 21 43
+58 22 20
+58 23 47
+58 24 59
+58 25 55
+58 26 62
+58 27 14
+58 28 61
+58 29 44
+58 30 34
+58 31 63
+58 32 31
+58 33 75
+58 34 55
+58 35 2
+58 36 23
+58 37 59
+58 38 53
+58 39 58
+58 40 41
+58 41 45
+58 42 51
+58 43 8
+58 44 30
+58 45 76
+58 46 45
+58 47 19
+58 48 54
+58 49 23
+58 50 16
+58 51 59
+58 52 42
+58 53 45
+58 54 70
+58 55 38
+58 56 44
+58 57 46
+58 59 19
+58 60 38
+58 61 53
+58 62 18
+58 63 48
+58 64 41
+58 65 46
+58 66 11
+58 67 67
+58 68 26
+58 69 36
+58 70 27
+58 71 54
+58 72 40
+58 73 8
+58 74 65
+58 75 25
+58 76 8
+58 77 35
+58 78 40
+58 79 42
+58 80 51
+58 81 32
+58 82 74
+58 83 49
+58 84 14
+58 86 45
+58 87 67
+58 88 20
+58 89 27
+58 90 18
+58 91 16
+58 92 13
+58 93 39
+58 94 36
+58 95 45
+58 96 7
+58 97 22
+58 98 35
+58 99 46
+58 100 39
+58 101 10
+58 102 37
+58 103 22
+58 104 56
+58 106 5
+58 107 15
+58 108 54
+58 109 26
+58 110 9
+58 111 46
+58 112 6
+58 113 37
+58 114 13
+58 115 63
+58 116 58
+58 117 5
+58 118 39
+58 119 41
+58 120 52
+58 121 41
+58 122 42
+58 123 46
+58 124 43
+58 125 51
+58 126 9
+59 0 18
+59 1 55
+59 2 36
+59 3 62
+59 4 61
+59 5 49
+59 6 22
+59 7 52
+59 8 46
+59 9 65
+59 10 54
+59 11 44
+59 13 34
+59 14 38
+59 15 31
+59 16 52
+59 17 46
+59 18 31
+59 19 56
+59 20 90
+59 21 55
+59 22 23
+59 23 59
+59 24 62
+59 25 58
+59 26 65
+59 27 19
+59 28 64
+59 29 47
+59 30 39
+59 31 75
+59 32 43
+59 33 78
+59 34 58
+59 35 18
+59 36 35
+59 37 62
+59 38 56
+59 39 63
+59 40 46
+59 41 57
+59 42 63
+59 43 20
+59 44 33
+59 45 79
+59 46 57
+59 47 31
+59 48 57
+59 49 28
+59 50 13
+59 51 62
+59 52 45
+59 53 57
+59 54 76
+59 55 41
+59 56 47
+59 57 58
+59 58 23
+59 60 49
+59 61 63
+59 62 28
+59 63 51
+59 64 53
+59 65 56
+59 66 16
+59 67 79
+59 68 38
+59 69 48
+59 70 39
+59 71 63
+59 72 43
+59 73 13
+59 74 68
+59 75 37
+59 76 24
+59 77 47
+59 78 46
+59 79 45
+59 80 63
+59 81 44
+59 82 77
+59 83 61
+59 84 24
+59 86 48
+59 87 73
+59 88 32
+59 89 37
+59 90 30
+59 91 28
+59 92 25
+59 93 51
+59 94 46
+59 95 50
+59 96 12
+59 97 27
+59 98 47
+59 99 49
+59 100 51
+59 101 15
+59 102 40
+59 103 34
+59 104 68
+59 106 21
+59 107 27
+59 108 57
+59 109 38
+59 110 25
+59 111 58
+59 112 18
+59 113 49
+59 114 18
+59 115 66
+59 116 61
+59 117 10
+59 118 51
+59 119 44
+59 120 55
+59 121 53
+59 122 54
+59 123 56
+59 124 55
+59 125 63
+59 126 21
+60 0 19
+60 1 50
+60 2 8
+60 3 65
+60 4 61
+60 5 52
+60 6 23
+60 7 55
+60 8 40
+60 9 59
+60 10 48
+60 11 38
+60 13 28
+60 14 32
+60 15 34
+60 16 53
+60 17 40
+60 18 21
+60 19 50
+60 20 93
+60 21 49
+60 22 26
+60 23 53
+60 24 65
+60 25 61
+60 26 68
+60 27 20
+60 28 67
+60 29 50
+60 30 40
+60 31 69
+60 32 37
+60 33 81
+60 34 61
+60 35 8
+60 36 29
+60 37 65
+60 38 59
+60 39 64
+60 40 47
+60 41 51
+60 42 57
+60 43 14
+60 44 36
+60 45 82
+60 46 51
+60 47 25
+60 48 60
+60 49 29
+60 50 22
+60 51 65
+60 52 48
+60 53 51
+60 54 76
+60 55 44
+60 56 50
+60 57 52
+60 58 6
+60 59 25
+60 61 59
+60 62 24
+60 63 54
+60 64 47
+60 65 52
+60 66 17
+60 67 73
+60 68 32
+60 69 42
+60 70 33
+60 71 60
+60 72 46
+60 73 14
+60 74 71
+60 75 31
+60 76 14
+60 77 41
+60 78 46
+60 79 48
+60 80 57
+60 81 38
+60 82 80
+60 83 55
+60 84 20
+60 86 51
+60 87 73
+60 88 26
+60 89 33
+60 90 24
+60 91 22
+60 92 19
+60 93 45
+60 94 42
+60 95 51
+60 96 13
+60 97 28
+60 98 41
+60 99 52
+60 100 45
+60 101 16
+60 102 43
+60 103 28
+60 104 62
+60 106 11
+60 107 21
+60 108 60
+60 109 32
+60 110 15
+60 111 52
+60 112 12
+60 113 43
+60 114 19
+60 115 69
+60 116 64
+60 117 11
+60 118 45
+60 119 47
+60 120 58
+60 121 47
+60 122 48
+60 123 52
+60 124 49
+60 125 57
+60 126 15
+61 0 39
+61 1 18
+61 2 34
+61 3 74
+61 4 29
+61 5 61
+61 6 43
+61 7 64
+61 8 25
+61 9 27
+61 10 27
+61 11 44
+61 13 34
+61 14 34
+61 15 43
+61 16 21
+61 17 25
+61 18 36
+61 19 18
+61 20 61
+61 21 28
+61 22 35
+61 23 24
+61 24 74
+61 25 70
+61 26 39
+61 27 40
+61 28 43
+61 29 59
+61 30 20
+61 31 37
+61 32 47
+61 33 49
+61 34 70
+61 35 28
+61 36 33
+61 37 74
+61 38 68
+61 39 80
+61 40 64
+61 41 30
+61 42 25
+61 43 34
+61 44 45
+61 45 69
+61 46 26
+61 47 27
+61 48 69
+61 49 49
+61 50 37
+61 51 33
+61 52 57
+61 53 19
+61 54 44
+61 55 33
+61 56 37
+61 57 20
+61 58 38
+61 59 40
+61 60 38
+61 62 43
+61 63 27
+61 64 49
+61 65 16
+61 66 37
+61 67 41
+61 68 26
+61 69 10
+61 70 18
+61 71 28
+61 72 55
+61 73 34
+61 74 80
+61 75 41
+61 76 29
+61 77 47
+61 78 14
+61 79 57
+61 80 25
+61 81 14
+61 82 59
+61 83 23
+61 84 40
+61 86 60
+61 87 41
+61 88 32
+61 89 52
+61 90 34
+61 91 28
+61 92 39
+61 93 7
+61 94 48
+61 95 28
+61 96 33
+61 97 45
+61 98 16
+61 99 39
+61 100 13
+61 101 36
+61 102 52
+61 103 30
+61 104 30
+61 106 31
+61 107 27
+61 108 39
+61 109 35
+61 110 30
+61 111 23
+61 112 32
+61 113 19
+61 114 33
+61 115 56
+61 116 73
+61 117 31
+61 118 13
+61 119 56
+61 120 34
+61 121 23
+61 122 2
+61 123 12
+61 124 52
+61 125 25
+61 126 21
+62 0 12
+62 1 36
+62 2 18
+62 3 50
+62 4 49
+62 5 37
+62 6 16
+62 7 40
+62 8 31
+62 9 50
+62 10 39
+62 11 20
+62 13 10
+62 14 18
+62 15 19
+62 16 33
+62 17 31
+62 18 17
+62 19 41
+62 20 78
+62 21 40
+62 22 11
+62 23 40
+62 24 50
+62 25 46
+62 26 53
+62 27 13
+62 28 52
+62 29 35
+62 30 20
+62 31 60
+62 32 23
+62 33 66
+62 34 46
+62 35 4
+62 36 15
+62 37 50
+62 38 44
+62 39 56
+62 40 40
+62 41 42
+62 42 48
+62 43 5
+62 44 21
+62 45 67
+62 46 42
+62 47 11
+62 48 45
+62 49 9
+62 50 18
+62 51 50
+62 52 33
+62 53 42
+62 54 64
+62 55 29
+62 56 35
+62 57 42
+62 58 8
+62 59 15
+62 60 30
+62 61 50
+62 63 39
+62 64 33
+62 65 37
+62 66 1
+62 67 64
+62 68 18
+62 69 33
+62 70 24
+62 71 51
+62 72 31
+62 73 7
+62 74 56
+62 75 17
+62 76 10
+62 77 23
+62 78 34
+62 79 33
+62 80 48
+62 81 29
+62 82 65
+62 83 46
+62 84 16
+62 86 36
+62 87 61
+62 88 8
+62 89 9
+62 90 10
+62 91 4
+62 92 1
+62 93 36
+62 94 24
+62 95 31
+62 96 9
+62 97 21
+62 98 32
+62 99 37
+62 100 36
+62 101 9
+62 102 28
+62 103 14
+62 104 53
+62 106 7
+62 107 3
+62 108 45
+62 109 18
+62 110 11
+62 111 39
+62 112 3
+62 113 34
+62 114 3
+62 115 54
+62 116 49
+62 117 7
+62 118 36
+62 119 32
+62 120 43
+62 121 38
+62 122 39
+62 123 37
+62 124 35
+62 125 48
+62 126 6
+63 0 50
+63 1 67
+63 2 56
+63 3 68
+63 4 10
+63 5 55
+63 6 54
+63 7 58
+63 8 69
+63 9 25
+63 10 59
+63 11 69
+63 13 55
+63 14 56
+63 15 37
+63 16 73
+63 17 60
+63 18 63
+63 19 61
+63 20 42
+63 21 60
+63 22 43
+63 23 61
+63 24 68
+63 25 64
+63 26 40
+63 27 51
+63 28 39
+63 29 53
+63 30 67
+63 31 35
+63 32 69
+63 33 30
+63 34 64
+63 35 50
+63 36 55
+63 37 68
+63 38 62
+63 39 74
+63 40 66
+63 41 62
+63 42 69
+63 43 43
+63 44 39
+63 45 56
+63 46 68
+63 47 49
+63 48 63
+63 49 56
+63 50 58
+63 51 23
+63 52 51
+63 53 63
+63 54 25
+63 55 33
+63 56 33
+63 57 63
+63 58 55
+63 59 67
+63 60 49
+63 61 69
+63 62 61
+63 64 48
+63 65 40
+63 66 49
+63 67 40
+63 68 56
+63 69 69
+63 70 62
+63 71 24
+63 72 49
+63 73 45
+63 74 74
+63 75 64
+63 76 56
+63 77 72
+63 78 66
+63 79 51
+63 80 29
+63 81 67
+63 82 55
+63 83 35
+63 84 57
+63 86 54
+63 87 22
+63 88 57
+63 89 70
+63 90 57
+63 91 55
+63 92 43
+63 93 65
+63 94 66
+63 95 71
+63 96 45
+63 97 49
+63 98 65
+63 99 35
+63 100 66
+63 101 47
+63 102 60
+63 103 52
+63 104 28
+63 106 53
+63 107 54
+63 108 35
+63 109 57
+63 110 57
+63 111 60
+63 112 45
+63 113 69
+63 114 51
+63 115 43
+63 116 67
+63 117 51
+63 118 65
+63 119 50
+63 120 30
+63 121 71
+63 122 68
+63 123 58
+63 124 74
+63 125 37
+63 126 48
+64 0 20
+64 1 47
+64 2 9
+64 3 38
+64 4 37
+64 5 25
+64 6 24
+64 7 28
+64 8 41
+64 9 52
+64 10 49
+64 11 34
+64 13 24
+64 14 20
+64 15 7
+64 16 50
+64 17 41
+64 18 22
+64 19 51
+64 20 66
+64 21 50
+64 22 13
+64 23 54
+64 24 38
+64 25 34
+64 26 41
+64 27 21
+64 28 40
+64 29 23
+64 30 41
+64 31 59
+64 32 25
+64 33 54
+64 34 34
+64 35 9
+64 36 17
+64 37 38
+64 38 32
+64 39 44
+64 40 36
+64 41 52
+64 42 54
+64 43 15
+64 44 9
+64 45 55
+64 46 49
+64 47 13
+64 48 33
+64 49 30
+64 50 23
+64 51 38
+64 52 21
+64 53 48
+64 54 52
+64 55 17
+64 56 23
+64 57 53
+64 58 7
+64 59 26
+64 60 1
+64 61 39
+64 62 25
+64 63 27
+64 65 40
+64 66 18
+64 67 56
+64 68 17
+64 69 39
+64 70 34
+64 71 39
+64 72 19
+64 73 15
+64 74 44
+64 75 19
+64 76 15
+64 77 37
+64 78 36
+64 79 21
+64 80 50
+64 81 39
+64 82 53
+64 83 48
+64 84 21
+64 86 24
+64 87 49
+64 88 22
+64 89 34
+64 90 12
+64 91 23
+64 92 20
+64 93 38
+64 94 36
+64 95 52
+64 96 14
+64 97 19
+64 98 42
+64 99 25
+64 100 42
+64 101 17
+64 102 30
+64 103 16
+64 104 46
+64 106 12
+64 107 22
+64 108 33
+64 109 12
+64 110 16
+64 111 53
+64 112 13
+64 113 44
+64 114 20
+64 115 42
+64 116 37
+64 117 12
+64 118 42
+64 119 20
+64 120 31
+64 121 48
+64 122 41
+64 123 51
+64 124 37
+64 125 39
+64 126 16
+65 0 40
+65 1 27
+65 2 31
+65 3 78
+65 4 33
+65 5 65
+65 6 44
+65 7 68
+65 8 35
+65 9 31
+65 10 19
+65 11 54
+65 13 44
+65 14 31
+65 15 47
+65 16 33
+65 17 20
+65 18 28
+65 19 21
+65 20 65
+65 21 20
+65 22 39
+65 23 21
+65 24 78
+65 25 74
+65 26 43
+65 27 41
+65 28 47
+65 29 63
+65 30 31
+65 31 41
+65 32 51
+65 33 53
+65 34 74
+65 35 39
+65 36 36
+65 37 78
+65 38 72
+65 39 84
+65 40 68
+65 41 22
+65 42 29
+65 43 33
+65 44 49
+65 45 73
+65 46 28
+65 47 24
+65 48 73
+65 49 44
+65 50 29
+65 51 37
+65 52 61
+65 53 23
+65 54 48
+65 55 39
+65 56 41
+65 57 23
+65 58 43
+65 59 32
+65 60 41
+65 61 34
+65 62 35
+65 63 31
+65 64 46
+65 66 36
+65 67 45
+65 68 29
+65 69 34
+65 70 52
+65 71 32
+65 72 59
+65 73 35
+65 74 84
+65 75 45
+65 76 21
+65 77 57
+65 78 33
+65 79 61
+65 80 29
+65 81 38
+65 82 63
+65 83 27
+65 84 46
+65 86 64
+65 87 45
+65 88 42
+65 89 44
+65 90 38
+65 91 39
+65 92 36
+65 93 25
+65 94 58
+65 95 31
+65 96 34
+65 97 49
+65 98 25
+65 99 43
+65 100 37
+65 101 37
+65 102 56
+65 103 27
+65 104 34
+65 106 30
+65 107 38
+65 108 43
+65 109 32
+65 110 22
+65 111 20
+65 112 31
+65 113 29
+65 114 38
+65 115 60
+65 116 77
+65 117 39
+65 118 37
+65 119 60
+65 120 38
+65 121 31
+65 122 29
+65 123 18
+65 124 49
+65 125 29
+65 126 34
+66 0 20
+66 1 51
+66 2 33
+66 3 66
+66 4 62
+66 5 53
+66 6 21
+66 7 56
+66 8 41
+66 9 60
+66 10 49
+66 11 39
+66 13 29
+66 14 33
+66 15 35
+66 16 54
+66 17 41
+66 18 22
+66 19 51
+66 20 94
+66 21 50
+66 22 27
+66 23 54
+66 24 66
+66 25 62
+66 26 69
+66 27 21
+66 28 68
+66 29 51
+66 30 41
+66 31 70
+66 32 38
+66 33 82
+66 34 62
+66 35 9
+66 36 30
+66 37 66
+66 38 60
+66 39 65
+66 40 48
+66 41 52
+66 42 58
+66 43 15
+66 44 37
+66 45 83
+66 46 52
+66 47 26
+66 48 61
+66 49 30
+66 50 23
+66 51 66
+66 52 49
+66 53 52
+66 54 77
+66 55 45
+66 56 51
+66 57 53
+66 58 7
+66 59 26
+66 60 45
+66 61 60
+66 62 25
+66 63 55
+66 64 48
+66 65 53
+66 67 74
+66 68 33
+66 69 43
+66 70 34
+66 71 61
+66 72 47
+66 73 15
+66 74 72
+66 75 32
+66 76 15
+66 77 42
+66 78 47
+66 79 49
+66 80 58
+66 81 39
+66 82 81
+66 83 56
+66 84 21
+66 86 52
+66 87 74
+66 88 27
+66 89 34
+66 90 25
+66 91 23
+66 92 20
+66 93 46
+66 94 43
+66 95 52
+66 96 14
+66 97 29
+66 98 42
+66 99 53
+66 100 46
+66 101 17
+66 102 44
+66 103 29
+66 104 63
+66 106 12
+66 107 22
+66 108 61
+66 109 33
+66 110 13
+66 111 53
+66 112 13
+66 113 44
+66 114 2
+66 115 70
+66 116 65
+66 117 12
+66 118 46
+66 119 48
+66 120 59
+66 121 48
+66 122 49
+66 123 53
+66 124 50
+66 125 58
+66 126 16
+67 0 10
+67 1 47
+67 2 28
+67 3 67
+67 4 41
+67 5 54
+67 6 14
+67 7 57
+67 8 42
+67 9 39
+67 10 50
+67 11 40
+67 13 30
+67 14 34
+67 15 36
+67 16 44
+67 17 42
+67 18 23
+67 19 52
+67 20 73
+67 21 51
+67 22 28
+67 23 51
+67 24 67
+67 25 63
+67 26 51
+67 27 11
+67 28 50
+67 29 52
+67 30 31
+67 31 49
+67 32 39
+67 33 61
+67 34 63
+67 35 10
+67 36 31
+67 37 67
+67 38 61
+67 39 55
+67 40 38
+67 41 53
+67 42 59
+67 43 16
+67 44 38
+67 45 51
+67 46 53
+67 47 27
+67 48 62
+67 49 20
+67 50 18
+67 51 34
+67 52 50
+67 53 53
+67 54 56
+67 55 46
+67 56 42
+67 57 53
+67 58 16
+67 59 27
+67 60 41
+67 61 61
+67 62 22
+67 63 39
+67 64 49
+67 65 48
+67 66 17
+67 68 34
+67 69 44
+67 70 35
+67 71 35
+67 72 48
+67 73 5
+67 74 73
+67 75 33
+67 76 16
+67 77 43
+67 78 48
+67 79 50
+67 80 37
+67 81 40
+67 82 40
+67 83 35
+67 84 22
+67 86 53
+67 87 53
+67 88 28
+67 89 31
+67 90 26
+67 91 24
+67 92 21
+67 93 47
+67 94 44
+67 95 42
+67 96 13
+67 97 19
+67 98 43
+67 99 44
+67 100 47
+67 101 7
+67 102 45
+67 103 30
+67 104 42
+67 106 13
+67 107 23
+67 108 20
+67 109 34
+67 110 17
+67 111 50
+67 112 14
+67 113 45
+67 114 11
+67 115 41
+67 116 66
+67 117 11
+67 118 47
+67 119 49
+67 120 41
+67 121 49
+67 122 50
+67 123 48
+67 124 51
+67 125 26
+67 126 17
+68 0 31
+68 1 57
+68 2 20
+68 3 62
+68 4 61
+68 5 49
+68 6 35
+68 7 52
+68 8 52
+68 9 61
+68 10 49
+68 11 32
+68 13 22
+68 14 9
+68 15 31
+68 16 60
+68 17 50
+68 18 33
+68 19 51
+68 20 90
+68 21 50
+68 22 23
+68 23 51
+68 24 62
+68 25 58
+68 26 65
+68 27 32
+68 28 64
+68 29 47
+68 30 52
+68 31 71
+68 32 35
+68 33 78
+68 34 58
+68 35 20
+68 36 27
+68 37 62
+68 38 56
+68 39 68
+68 40 52
+68 41 52
+68 42 59
+68 43 26
+68 44 33
+68 45 79
+68 46 58
+68 47 23
+68 48 57
+68 49 41
+68 50 34
+68 51 62
+68 52 45
+68 53 53
+68 54 76
+68 55 41
+68 56 47
+68 57 53
+68 58 18
+68 59 37
+68 60 12
+68 61 63
+68 62 36
+68 63 51
+68 64 24
+68 65 30
+68 66 29
+68 67 75
+68 69 49
+68 70 45
+68 71 62
+68 72 43
+68 73 26
+68 74 68
+68 75 29
+68 76 26
+68 77 35
+68 78 46
+68 79 45
+68 80 59
+68 81 50
+68 82 77
+68 83 57
+68 84 32
+68 86 48
+68 87 73
+68 88 20
+68 89 45
+68 90 22
+68 91 34
+68 92 31
+68 93 55
+68 94 36
+68 95 61
+68 96 25
+68 97 33
+68 98 53
+68 99 49
+68 100 52
+68 101 28
+68 102 40
+68 103 26
+68 104 64
+68 106 23
+68 107 33
+68 108 57
+68 109 10
+68 110 27
+68 111 50
+68 112 24
+68 113 55
+68 114 31
+68 115 66
+68 116 61
+68 117 23
+68 118 52
+68 119 44
+68 120 55
+68 121 59
+68 122 55
+68 123 48
+68 124 27
+68 125 59
+68 126 27
+69 0 29
+69 1 8
+69 2 28
+69 3 64
+69 4 19
+69 5 51
+69 6 33
+69 7 54
+69 8 24
+69 9 17
+69 10 17
+69 11 34
+69 13 24
+69 14 28
+69 15 33
+69 16 11
+69 17 17
+69 18 26
+69 19 19
+69 20 51
+69 21 18
+69 22 25
+69 23 18
+69 24 64
+69 25 60
+69 26 29
+69 27 30
+69 28 33
+69 29 49
+69 30 10
+69 31 27
+69 32 37
+69 33 39
+69 34 60
+69 35 18
+69 36 29
+69 37 64
+69 38 58
+69 39 70
+69 40 54
+69 41 20
+69 42 15
+69 43 24
+69 44 35
+69 45 59
+69 46 17
+69 47 21
+69 48 59
+69 49 39
+69 50 27
+69 51 23
+69 52 47
+69 53 9
+69 54 34
+69 55 25
+69 56 27
+69 57 20
+69 58 28
+69 59 30
+69 60 39
+69 61 31
+69 62 33
+69 63 17
+69 64 40
+69 65 15
+69 66 27
+69 67 31
+69 68 27
+69 70 43
+69 71 18
+69 72 45
+69 73 24
+69 74 70
+69 75 31
+69 76 19
+69 77 37
+69 78 4
+69 79 47
+69 80 15
+69 81 4
+69 82 49
+69 83 13
+69 84 30
+69 86 50
+69 87 31
+69 88 22
+69 89 42
+69 90 24
+69 91 18
+69 92 29
+69 93 11
+69 94 38
+69 95 21
+69 96 23
+69 97 35
+69 98 7
+69 99 29
+69 100 3
+69 101 26
+69 102 42
+69 103 24
+69 104 20
+69 106 21
+69 107 17
+69 108 29
+69 109 29
+69 110 20
+69 111 17
+69 112 22
+69 113 9
+69 114 23
+69 115 46
+69 116 63
+69 117 21
+69 118 3
+69 119 46
+69 120 24
+69 121 13
+69 122 6
+69 123 18
+69 124 46
+69 125 15
+69 126 11
+70 0 36
+70 1 17
+70 2 30
+70 3 73
+70 4 28
+70 5 60
+70 6 40
+70 7 63
+70 8 7
+70 9 26
+70 10 15
+70 11 43
+70 13 33
+70 14 30
+70 15 42
+70 16 20
+70 17 7
+70 18 24
+70 19 17
+70 20 60
+70 21 16
+70 22 34
+70 23 20
+70 24 73
+70 25 69
+70 26 38
+70 27 37
+70 28 38
+70 29 58
+70 30 18
+70 31 36
+70 32 46
+70 33 48
+70 34 69
+70 35 27
+70 36 32
+70 37 73
+70 38 67
+70 39 79
+70 40 63
+70 41 18
+70 42 24
+70 43 29
+70 44 44
+70 45 53
+70 46 18
+70 47 23
+70 48 68
+70 49 40
+70 50 25
+70 51 32
+70 52 56
+70 53 18
+70 54 43
+70 55 15
+70 56 21
+70 57 19
+70 58 37
+70 59 28
+70 60 37
+70 61 26
+70 62 31
+70 63 25
+70 64 45
+70 65 19
+70 66 32
+70 67 40
+70 68 25
+70 69 9
+70 71 27
+70 72 54
+70 73 31
+70 74 79
+70 75 40
+70 76 17
+70 77 46
+70 78 13
+70 79 56
+70 80 24
+70 81 5
+70 82 51
+70 83 22
+70 84 39
+70 86 59
+70 87 40
+70 88 31
+70 89 40
+70 90 33
+70 91 27
+70 92 32
+70 93 12
+70 94 47
+70 95 23
+70 96 30
+70 97 44
+70 98 8
+70 99 23
+70 100 12
+70 101 33
+70 102 51
+70 103 26
+70 104 29
+70 106 26
+70 107 26
+70 108 31
+70 109 31
+70 110 18
+70 111 19
+70 112 27
+70 113 10
+70 114 32
+70 115 40
+70 116 72
+70 117 30
+70 118 12
+70 119 55
+70 120 29
+70 121 14
+70 122 15
+70 123 19
+70 124 48
+70 125 24
+70 126 20
+71 0 30
+71 1 46
+71 2 41
+71 3 67
+71 4 24
+71 5 54
+71 6 34
+71 7 57
+71 8 49
+71 9 26
+71 10 46
+71 11 47
+71 13 37
+71 14 41
+71 15 36
+71 16 56
+71 17 47
+71 18 43
+71 19 48
+71 20 41
+71 21 47
+71 22 38
+71 23 48
+71 24 67
+71 25 63
+71 26 16
+71 27 31
+71 28 15
+71 29 52
+71 30 43
+71 31 34
+71 32 46
+71 33 29
+71 34 63
+71 35 30
+71 36 38
+71 37 67
+71 38 61
+71 39 73
+71 40 58
+71 41 49
+71 42 53
+71 43 23
+71 44 38
+71 45 42
+71 46 55
+71 47 34
+71 48 62
+71 49 32
+71 50 38
+71 51 10
+71 52 50
+71 53 47
+71 54 34
+71 55 34
+71 56 28
+71 57 50
+71 58 36
+71 59 47
+71 60 48
+71 61 61
+71 62 41
+71 63 14
+71 64 47
+71 65 27
+71 66 29
+71 67 39
+71 68 41
+71 69 47
+71 70 42
+71 72 48
+71 73 25
+71 74 73
+71 75 40
+71 76 36
+71 77 50
+71 78 51
+71 79 50
+71 80 24
+71 81 43
+71 82 31
+71 83 26
+71 84 37
+71 86 53
+71 87 36
+71 88 35
+71 89 50
+71 90 33
+71 91 31
+71 92 19
+71 93 49
+71 94 51
+71 95 54
+71 96 25
+71 97 39
+71 98 46
+71 99 12
+71 100 42
+71 101 27
+71 102 55
+71 103 37
+71 104 21
+71 106 33
+71 107 30
+71 108 11
+71 109 41
+71 110 37
+71 111 47
+71 112 21
+71 113 48
+71 114 31
+71 115 29
+71 116 66
+71 117 31
+71 118 41
+71 119 49
+71 120 6
+71 121 52
+71 122 44
+71 123 45
+71 124 58
+71 125 17
+71 126 24
+72 0 24
+72 1 38
+72 2 14
+72 3 19
+72 4 49
+72 5 6
+72 6 28
+72 7 9
+72 8 45
+72 9 47
+72 10 47
+72 11 29
+72 13 19
+72 14 14
+72 15 28
+72 16 41
+72 17 45
+72 18 26
+72 19 38
+72 20 81
+72 21 48
+72 22 20
+72 23 40
+72 24 19
+72 25 15
+72 26 59
+72 27 25
+72 28 61
+72 29 4
+72 30 40
+72 31 57
+72 32 32
+72 33 69
+72 34 15
+72 35 13
+72 36 24
+72 37 19
+72 38 13
+72 39 25
+72 40 17
+72 41 50
+72 42 44
+72 43 19
+72 44 30
+72 45 76
+72 46 38
+72 47 20
+72 48 14
+72 49 34
+72 50 27
+72 51 53
+72 52 2
+72 53 39
+72 54 64
+72 55 38
+72 56 44
+72 57 40
+72 58 23
+72 59 30
+72 60 26
+72 61 20
+72 62 29
+72 63 47
+72 64 29
+72 65 28
+72 66 22
+72 67 61
+72 68 14
+72 69 30
+72 70 38
+72 71 48
+72 73 19
+72 74 25
+72 75 26
+72 76 19
+72 77 32
+72 78 34
+72 79 2
+72 80 45
+72 81 34
+72 82 74
+72 83 43
+72 84 25
+72 86 5
+72 87 61
+72 88 17
+72 89 38
+72 90 19
+72 91 13
+72 92 24
+72 93 19
+72 94 33
+72 95 48
+72 96 18
+72 97 30
+72 98 28
+72 99 46
+72 100 33
+72 101 21
+72 102 37
+72 103 10
+72 104 50
+72 106 16
+72 107 12
+72 108 54
+72 109 15
+72 110 20
+72 111 39
+72 112 17
+72 113 39
+72 114 18
+72 115 63
+72 116 18
+72 117 16
+72 118 33
+72 119 1
+72 120 52
+72 121 43
+72 122 22
+72 123 32
+72 124 32
+72 125 45
+72 126 6
+73 0 5
+73 1 42
+73 2 23
+73 3 62
+73 4 58
+73 5 49
+73 6 9
+73 7 52
+73 8 37
+73 9 56
+73 10 45
+73 11 35
+73 13 25
+73 14 29
+73 15 31
+73 16 39
+73 17 37
+73 18 18
+73 19 47
+73 20 90
+73 21 46
+73 22 23
+73 23 46
+73 24 62
+73 25 58
+73 26 65
+73 27 6
+73 28 64
+73 29 47
+73 30 26
+73 31 66
+73 32 34
+73 33 78
+73 34 58
+73 35 5
+73 36 26
+73 37 62
+73 38 56
+73 39 50
+73 40 33
+73 41 48
+73 42 54
+73 43 11
+73 44 33
+73 45 79
+73 46 48
+73 47 22
+73 48 57
+73 49 15
+73 50 13
+73 51 62
+73 52 45
+73 53 48
+73 54 73
+73 55 41
+73 56 47
+73 57 48
+73 58 19
+73 59 22
+73 60 36
+73 61 56
+73 62 17
+73 63 51
+73 64 44
+73 65 43
+73 66 12
+73 67 70
+73 68 29
+73 69 39
+73 70 30
+73 71 57
+73 72 43
+73 74 68
+73 75 28
+73 76 11
+73 77 38
+73 78 43
+73 79 45
+73 80 54
+73 81 35
+73 82 77
+73 83 52
+73 84 17
+73 86 48
+73 87 70
+73 88 23
+73 89 26
+73 90 21
+73 91 19
+73 92 16
+73 93 42
+73 94 39
+73 95 37
+73 96 8
+73 97 14
+73 98 38
+73 99 49
+73 100 42
+73 101 2
+73 102 40
+73 103 25
+73 104 59
+73 106 8
+73 107 18
+73 108 57
+73 109 29
+73 110 12
+73 111 45
+73 112 9
+73 113 40
+73 114 14
+73 115 66
+73 116 61
+73 117 6
+73 118 42
+73 119 44
+73 120 55
+73 121 44
+73 122 45
+73 123 43
+73 124 46
+73 125 54
+73 126 12
+74 0 31
+74 1 68
+74 2 49
+74 3 75
+74 4 74
+74 5 62
+74 6 35
+74 7 65
+74 8 59
+74 9 78
+74 10 67
+74 11 57
+74 13 47
+74 14 51
+74 15 44
+74 16 65
+74 17 59
+74 18 44
+74 19 69
+74 20 103
+74 21 68
+74 22 36
+74 23 72
+74 24 75
+74 25 71
+74 26 78
+74 27 32
+74 28 77
+74 29 60
+74 30 52
+74 31 88
+74 32 56
+74 33 91
+74 34 71
+74 35 31
+74 36 48
+74 37 75
+74 38 69
+74 39 76
+74 40 59
+74 41 70
+74 42 76
+74 43 33
+74 44 46
+74 45 92
+74 46 70
+74 47 44
+74 48 70
+74 49 41
+74 50 26
+74 51 75
+74 52 58
+74 53 70
+74 54 89
+74 55 54
+74 56 60
+74 57 71
+74 58 36
+74 59 13
+74 60 62
+74 61 76
+74 62 41
+74 63 64
+74 64 66
+74 65 69
+74 66 29
+74 67 92
+74 68 51
+74 69 61
+74 70 52
+74 71 76
+74 72 56
+74 73 26
+74 75 50
+74 76 37
+74 77 60
+74 78 59
+74 79 58
+74 80 76
+74 81 57
+74 82 90
+74 83 74
+74 84 37
+74 86 61
+74 87 86
+74 88 45
+74 89 50
+74 90 43
+74 91 41
+74 92 38
+74 93 64
+74 94 59
+74 95 63
+74 96 25
+74 97 40
+74 98 60
+74 99 62
+74 100 64
+74 101 28
+74 102 53
+74 103 47
+74 104 81
+74 106 34
+74 107 40
+74 108 70
+74 109 51
+74 110 38
+74 111 71
+74 112 31
+74 113 62
+74 114 31
+74 115 79
+74 116 74
+74 117 23
+74 118 64
+74 119 57
+74 120 68
+74 121 66
+74 122 67
+74 123 69
+74 124 68
+74 125 76
+74 126 34
+75 0 31
+75 1 42
+75 2 15
+75 3 45
+75 4 46
+75 5 32
+75 6 35
+75 7 35
+75 8 51
+75 9 51
+75 10 40
+75 11 17
+75 13 7
+75 14 15
+75 15 16
+75 16 45
+75 17 41
+75 18 27
+75 19 42
+75 20 75
+75 21 41
+75 22 8
+75 23 42
+75 24 45
+75 25 41
+75 26 50
+75 27 32
+75 28 49
+75 29 30
+75 30 44
+75 31 61
+75 32 6
+75 33 63
+75 34 41
+75 35 31
+75 36 12
+75 37 45
+75 38 39
+75 39 51
+75 40 37
+75 41 43
+75 42 49
+75 43 27
+75 44 16
+75 45 64
+75 46 44
+75 47 8
+75 48 40
+75 49 41
+75 50 28
+75 51 47
+75 52 28
+75 53 43
+75 54 61
+75 55 26
+75 56 32
+75 57 44
+75 58 33
+75 59 31
+75 60 27
+75 61 46
+75 62 34
+75 63 36
+75 64 30
+75 65 21
+75 66 29
+75 67 65
+75 68 15
+75 69 34
+75 70 46
+75 71 48
+75 72 26
+75 73 26
+75 74 51
+75 76 20
+75 77 20
+75 78 31
+75 79 28
+75 80 49
+75 81 38
+75 82 62
+75 83 47
+75 84 37
+75 86 31
+75 87 58
+75 88 5
+75 89 43
+75 90 7
+75 91 25
+75 92 32
+75 93 45
+75 94 21
+75 95 52
+75 96 25
+75 97 18
+75 98 41
+75 99 34
+75 100 37
+75 101 28
+75 102 25
+75 103 11
+75 104 54
+75 106 29
+75 107 34
+75 108 42
+75 109 15
+75 110 21
+75 111 41
+75 112 25
+75 113 43
+75 114 31
+75 115 51
+75 116 44
+75 117 32
+75 118 37
+75 119 27
+75 120 40
+75 121 47
+75 122 40
+75 123 39
+75 124 18
+75 125 48
+75 126 28
+76 0 19
+76 1 48
+76 2 30
+76 3 57
+76 4 56
+76 5 44
+76 6 23
+76 7 47
+76 8 38
+76 9 57
+76 10 46
+76 11 34
+76 13 24
+76 14 30
+76 15 26
+76 16 47
+76 17 38
+76 18 7
+76 19 48
+76 20 85
+76 21 47
+76 22 18
+76 23 51
+76 24 57
+76 25 53
+76 26 60
+76 27 20
+76 28 59
+76 29 42
+76 30 34
+76 31 67
+76 32 35
+76 33 73
+76 34 53
+76 35 18
+76 36 27
+76 37 57
+76 38 51
+76 39 63
+76 40 47
+76 41 49
+76 42 55
+76 43 12
+76 44 28
+76 45 74
+76 46 49
+76 47 23
+76 48 52
+76 49 23
+76 50 8
+76 51 57
+76 52 40
+76 53 49
+76 54 71
+76 55 36
+76 56 42
+76 57 50
+76 58 22
+76 59 11
+76 60 42
+76 61 57
+76 62 14
+76 63 46
+76 64 45
+76 65 50
+76 66 15
+76 67 71
+76 68 30
+76 69 40
+76 70 31
+76 71 58
+76 72 38
+76 73 14
+76 74 63
+76 75 29
+76 77 37
+76 78 41
+76 79 40
+76 80 55
+76 81 36
+76 82 72
+76 83 53
+76 84 25
+76 86 43
+76 87 68
+76 88 22
+76 89 23
+76 90 22
+76 91 18
+76 92 15
+76 93 43
+76 94 38
+76 95 45
+76 96 13
+76 97 28
+76 98 39
+76 99 44
+76 100 43
+76 101 16
+76 102 35
+76 103 26
+76 104 60
+76 106 9
+76 107 17
+76 108 52
+76 109 30
+76 110 1
+76 111 50
+76 112 10
+76 113 41
+76 114 17
+76 115 61
+76 116 56
+76 117 18
+76 118 43
+76 119 39
+76 120 50
+76 121 45
+76 122 46
+76 123 50
+76 124 47
+76 125 55
+76 126 13
+77 0 31
+77 1 61
+77 2 15
+77 3 59
+77 4 58
+77 5 46
+77 6 35
+77 7 49
+77 8 55
+77 9 65
+77 10 53
+77 11 20
+77 13 26
+77 14 13
+77 15 28
+77 16 64
+77 17 54
+77 18 36
+77 19 55
+77 20 87
+77 21 54
+77 22 27
+77 23 55
+77 24 59
+77 25 55
+77 26 62
+77 27 32
+77 28 61
+77 29 44
+77 30 52
+77 31 75
+77 32 39
+77 33 75
+77 34 55
+77 35 23
+77 36 31
+77 37 59
+77 38 53
+77 39 65
+77 40 56
+77 41 56
+77 42 63
+77 43 29
+77 44 30
+77 45 76
+77 46 62
+77 47 27
+77 48 54
+77 49 41
+77 50 37
+77 51 59
+77 52 42
+77 53 57
+77 54 73
+77 55 38
+77 56 44
+77 57 57
+77 58 21
+77 59 40
+77 60 15
+77 61 60
+77 62 39
+77 63 48
+77 64 28
+77 65 34
+77 66 29
+77 67 77
+77 68 4
+77 69 53
+77 70 48
+77 71 60
+77 72 40
+77 73 26
+77 74 65
+77 75 33
+77 76 29
+77 78 50
+77 79 42
+77 80 63
+77 81 53
+77 82 74
+77 83 61
+77 84 35
+77 86 45
+77 87 70
+77 88 24
+77 89 48
+77 90 26
+77 91 37
+77 92 34
+77 93 59
+77 94 40
+77 95 63
+77 96 25
+77 97 37
+77 98 56
+77 99 46
+77 100 56
+77 101 28
+77 102 44
+77 103 11
+77 104 67
+77 106 26
+77 107 36
+77 108 54
+77 109 14
+77 110 30
+77 111 54
+77 112 27
+77 113 58
+77 114 31
+77 115 63
+77 116 58
+77 117 26
+77 118 56
+77 119 41
+77 120 52
+77 121 62
+77 122 59
+77 123 52
+77 124 31
+77 125 60
+77 126 30
+78 0 32
+78 1 11
+78 2 31
+78 3 67
+78 4 22
+78 5 54
+78 6 36
+78 7 57
+78 8 20
+78 9 20
+78 10 20
+78 11 37
+78 13 27
+78 14 31
+78 15 36
+78 16 14
+78 17 20
+78 18 29
+78 19 16
+78 20 54
+78 21 18
+78 22 28
+78 23 21
+78 24 67
+78 25 63
+78 26 32
+78 27 33
+78 28 36
+78 29 52
+78 30 13
+78 31 30
+78 32 40
+78 33 42
+78 34 63
+78 35 21
+78 36 31
+78 37 67
+78 38 61
+78 39 73
+78 40 57
+78 41 20
+78 42 18
+78 43 27
+78 44 38
+78 45 62
+78 46 13
+78 47 24
+78 48 62
+78 49 42
+78 50 30
+78 51 26
+78 52 50
+78 53 12
+78 54 37
+78 55 28
+78 56 30
+78 57 18
+78 58 31
+78 59 33
+78 60 36
+78 61 29
+78 62 36
+78 63 20
+78 64 43
+78 65 18
+78 66 30
+78 67 34
+78 68 24
+78 69 3
+78 70 46
+78 71 21
+78 72 48
+78 73 27
+78 74 73
+78 75 34
+78 76 22
+78 77 40
+78 79 50
+78 80 18
+78 81 7
+78 82 52
+78 83 16
+78 84 33
+78 86 53
+78 87 34
+78 88 25
+78 89 45
+78 90 27
+78 91 21
+78 92 32
+78 93 14
+78 94 41
+78 95 24
+78 96 26
+78 97 38
+78 98 10
+78 99 32
+78 100 6
+78 101 29
+78 102 45
+78 103 27
+78 104 23
+78 106 24
+78 107 20
+78 108 32
+78 109 32
+78 110 23
+78 111 20
+78 112 25
+78 113 12
+78 114 26
+78 115 49
+78 116 66
+78 117 24
+78 118 6
+78 119 49
+78 120 27
+78 121 16
+78 122 9
+78 123 21
+78 124 49
+78 125 18
+78 126 14
+79 0 29
+79 1 53
+79 2 32
+79 3 35
+79 4 63
+79 5 24
+79 6 33
+79 7 27
+79 8 50
+79 9 62
+79 10 52
+79 11 34
+79 13 24
+79 14 32
+79 15 33
+79 16 56
+79 17 50
+79 18 31
+79 19 53
+79 20 92
+79 21 53
+79 22 25
+79 23 45
+79 24 37
+79 25 33
+79 26 67
+79 27 30
+79 28 66
+79 29 22
+79 30 45
+79 31 72
+79 32 37
+79 33 80
+79 34 20
+79 35 18
+79 36 29
+79 37 34
+79 38 31
+79 39 30
+79 40 22
+79 41 55
+79 42 49
+79 43 24
+79 44 35
+79 45 81
+79 46 43
+79 47 25
+79 48 32
+79 49 39
+79 50 32
+79 51 64
+79 52 7
+79 53 54
+79 54 78
+79 55 43
+79 56 49
+79 57 55
+79 58 28
+79 59 35
+79 60 44
+79 61 35
+79 62 34
+79 63 53
+79 64 47
+79 65 33
+79 66 27
+79 67 76
+79 68 32
+79 69 45
+79 70 43
+79 71 63
+79 72 18
+79 73 24
+79 74 43
+79 75 31
+79 76 24
+79 77 37
+79 78 48
+79 80 60
+79 81 42
+79 82 79
+79 83 58
+79 84 30
+79 86 10
+79 87 75
+79 88 22
+79 89 43
+79 90 24
+79 91 18
+79 92 29
+79 93 24
+79 94 38
+79 95 56
+79 96 23
+79 97 35
+79 98 33
+79 99 51
+79 100 41
+79 101 26
+79 102 42
+79 103 28
+79 104 65
+79 106 21
+79 107 17
+79 108 59
+79 109 32
+79 110 25
+79 111 44
+79 112 22
+79 113 47
+79 114 23
+79 115 68
+79 116 23
+79 117 21
+79 118 48
+79 119 19
+79 120 57
+79 121 51
+79 122 37
+79 123 47
+79 124 49
+79 125 60
+79 126 11
+80 0 26
+80 1 49
+80 2 34
+80 3 62
+80 4 4
+80 5 49
+80 6 30
+80 7 52
+80 8 47
+80 9 2
+80 10 44
+80 11 45
+80 13 35
+80 14 39
+80 15 31
+80 16 54
+80 17 45
+80 18 39
+80 19 46
+80 20 36
+80 21 45
+80 22 36
+80 23 46
+80 24 62
+80 25 58
+80 26 14
+80 27 27
+80 28 18
+80 29 47
+80 30 41
+80 31 12
+80 32 44
+80 33 24
+80 34 58
+80 35 26
+80 36 36
+80 37 62
+80 38 56
+80 39 68
+80 40 54
+80 41 47
+80 42 54
+80 43 21
+80 44 33
+80 45 44
+80 46 53
+80 47 32
+80 48 57
+80 49 30
+80 50 34
+80 51 8
+80 52 45
+80 53 48
+80 54 19
+80 55 10
+80 56 12
+80 57 48
+80 58 32
+80 59 43
+80 60 26
+80 61 59
+80 62 38
+80 63 16
+80 64 25
+80 65 25
+80 66 26
+80 67 16
+80 68 39
+80 69 49
+80 70 40
+80 71 3
+80 72 43
+80 73 21
+80 74 68
+80 75 38
+80 76 32
+80 77 48
+80 78 53
+80 79 45
+80 81 45
+80 82 34
+80 83 12
+80 84 34
+80 86 48
+80 87 16
+80 88 33
+80 89 47
+80 90 31
+80 91 29
+80 92 17
+80 93 50
+80 94 49
+80 95 52
+80 96 22
+80 97 35
+80 98 48
+80 99 14
+80 100 45
+80 101 23
+80 102 53
+80 103 35
+80 104 5
+80 106 29
+80 107 28
+80 108 14
+80 109 37
+80 110 33
+80 111 45
+80 112 19
+80 113 50
+80 114 27
+80 115 31
+80 116 61
+80 117 27
+80 118 44
+80 119 44
+80 120 9
+80 121 54
+80 122 47
+80 123 43
+80 124 56
+80 125 14
+80 126 22
+81 0 33
+81 1 12
+81 2 25
+81 3 68
+81 4 23
+81 5 55
+81 6 37
+81 7 58
+81 8 20
+81 9 21
+81 10 21
+81 11 38
+81 13 28
+81 14 25
+81 15 37
+81 16 15
+81 17 13
+81 18 30
+81 19 19
+81 20 55
+81 21 18
+81 22 29
+81 23 15
+81 24 68
+81 25 64
+81 26 33
+81 27 34
+81 28 37
+81 29 53
+81 30 14
+81 31 31
+81 32 41
+81 33 43
+81 34 64
+81 35 22
+81 36 33
+81 37 68
+81 38 62
+81 39 74
+81 40 58
+81 41 20
+81 42 19
+81 43 28
+81 44 39
+81 45 63
+81 46 13
+81 47 18
+81 48 63
+81 49 43
+81 50 31
+81 51 27
+81 52 51
+81 53 13
+81 54 38
+81 55 29
+81 56 31
+81 57 21
+81 58 32
+81 59 34
+81 60 37
+81 61 32
+81 62 37
+81 63 21
+81 64 40
+81 65 19
+81 66 31
+81 67 35
+81 68 25
+81 69 4
+81 70 47
+81 71 22
+81 72 49
+81 73 28
+81 74 74
+81 75 35
+81 76 23
+81 77 41
+81 78 8
+81 79 51
+81 80 19
+81 82 53
+81 83 17
+81 84 34
+81 86 54
+81 87 35
+81 88 26
+81 89 46
+81 90 28
+81 91 22
+81 92 33
+81 93 15
+81 94 42
+81 95 18
+81 96 27
+81 97 39
+81 98 3
+81 99 33
+81 100 7
+81 101 30
+81 102 46
+81 103 21
+81 104 24
+81 106 25
+81 107 21
+81 108 33
+81 109 26
+81 110 24
+81 111 14
+81 112 26
+81 113 5
+81 114 27
+81 115 50
+81 116 67
+81 117 25
+81 118 7
+81 119 50
+81 120 28
+81 121 9
+81 122 10
+81 123 14
+81 124 43
+81 125 19
+81 126 15
+82 0 25
+82 1 15
+82 2 37
+82 3 69
+82 4 17
+82 5 56
+82 6 29
+82 7 59
+82 8 32
+82 9 18
+82 10 25
+82 11 41
+82 13 31
+82 14 37
+82 15 38
+82 16 27
+82 17 25
+82 18 34
+82 19 27
+82 20 43
+82 21 26
+82 22 32
+82 23 27
+82 24 69
+82 25 65
+82 26 18
+82 27 26
+82 28 17
+82 29 54
+82 30 22
+82 31 24
+82 32 44
+82 33 31
+82 34 65
+82 35 25
+82 36 36
+82 37 69
+82 38 63
+82 39 70
+82 40 53
+82 41 28
+82 42 22
+82 43 25
+82 44 40
+82 45 11
+82 46 25
+82 47 30
+82 48 64
+82 49 34
+82 50 33
+82 51 15
+82 52 52
+82 53 16
+82 54 32
+82 55 9
+82 56 9
+82 57 29
+82 58 31
+82 59 38
+82 60 38
+82 61 40
+82 62 37
+82 63 13
+82 64 37
+82 65 24
+82 66 32
+82 67 15
+82 68 35
+82 69 16
+82 70 44
+82 71 16
+82 72 50
+82 73 20
+82 74 75
+82 75 38
+82 76 27
+82 77 44
+82 78 20
+82 79 52
+82 80 16
+82 81 12
+82 83 20
+82 84 37
+82 86 55
+82 87 29
+82 88 29
+82 89 46
+82 90 31
+82 91 25
+82 92 21
+82 93 18
+82 94 45
+82 95 30
+82 96 28
+82 97 34
+82 98 15
+82 99 11
+82 100 11
+82 101 22
+82 102 49
+82 103 33
+82 104 21
+82 106 28
+82 107 24
+82 108 14
+82 109 38
+82 110 28
+82 111 26
+82 112 23
+82 113 17
+82 114 26
+82 115 1
+82 116 68
+82 117 26
+82 118 10
+82 119 51
+82 120 8
+82 121 21
+82 122 13
+82 123 26
+82 124 55
+82 125 20
+82 126 18
+83 0 16
+83 1 51
+83 2 34
+83 3 64
+83 4 6
+83 5 51
+83 6 20
+83 7 54
+83 8 48
+83 9 4
+83 10 46
+83 11 46
+83 13 36
+83 14 40
+83 15 33
+83 16 50
+83 17 47
+83 18 29
+83 19 48
+83 20 38
+83 21 47
+83 22 28
+83 23 48
+83 24 64
+83 25 60
+83 26 16
+83 27 17
+83 28 20
+83 29 49
+83 30 37
+83 31 14
+83 32 45
+83 33 26
+83 34 60
+83 35 16
+83 36 37
+83 37 64
+83 38 58
+83 39 61
+83 40 44
+83 41 49
+83 42 56
+83 43 22
+83 44 35
+83 45 46
+83 46 55
+83 47 33
+83 48 59
+83 49 26
+83 50 24
+83 51 10
+83 52 47
+83 53 50
+83 54 21
+83 55 12
+83 56 14
+83 57 50
+83 58 21
+83 59 33
+83 60 28
+83 61 61
+83 62 26
+83 63 4
+83 64 27
+83 65 27
+83 66 14
+83 67 18
+83 68 40
+83 69 50
+83 70 41
+83 71 5
+83 72 45
+83 73 11
+83 74 70
+83 75 39
+83 76 22
+83 77 49
+83 78 51
+83 79 47
+83 80 2
+83 81 46
+83 82 36
+83 84 22
+83 86 50
+83 87 18
+83 88 34
+83 89 35
+83 90 32
+83 91 30
+83 92 19
+83 93 52
+83 94 50
+83 95 48
+83 96 10
+83 97 25
+83 98 49
+83 99 16
+83 100 47
+83 101 13
+83 102 45
+83 103 36
+83 104 7
+83 106 19
+83 107 29
+83 108 16
+83 109 39
+83 110 23
+83 111 47
+83 112 20
+83 113 51
+83 114 16
+83 115 33
+83 116 63
+83 117 17
+83 118 46
+83 119 46
+83 120 11
+83 121 55
+83 122 49
+83 123 45
+83 124 57
+83 125 2
+83 126 23
+84 0 7
+84 1 40
+84 2 22
+84 3 45
+84 4 44
+84 5 32
+84 6 11
+84 7 35
+84 8 32
+84 9 49
+84 10 40
+84 11 24
+84 13 14
+84 14 22
+84 15 14
+84 16 37
+84 17 32
+84 18 20
+84 19 42
+84 20 73
+84 21 41
+84 22 6
+84 23 44
+84 24 45
+84 25 41
+84 26 48
+84 27 8
+84 28 47
+84 29 30
+84 30 24
+84 31 59
+84 32 27
+84 33 61
+84 34 41
+84 35 7
+84 36 18
+84 37 45
+84 38 39
+84 39 51
+84 40 35
+84 41 43
+84 42 47
+84 43 6
+84 44 16
+84 45 62
+84 46 42
+84 47 15
+84 48 40
+84 49 13
+84 50 15
+84 51 45
+84 52 28
+84 53 41
+84 54 59
+84 55 24
+84 56 30
+84 57 44
+84 58 7
+84 59 19
+84 60 34
+84 61 46
+84 62 4
+84 63 34
+84 64 37
+84 65 41
+84 66 5
+84 67 63
+84 68 22
+84 69 32
+84 70 25
+84 71 46
+84 72 26
+84 73 2
+84 74 51
+84 75 21
+84 76 13
+84 77 27
+84 78 29
+84 79 28
+84 80 47
+84 81 30
+84 82 60
+84 83 45
+84 86 31
+84 87 56
+84 88 12
+84 89 13
+84 90 14
+84 91 8
+84 92 5
+84 93 37
+84 94 28
+84 95 35
+84 96 1
+84 97 16
+84 98 33
+84 99 32
+84 100 35
+84 101 4
+84 102 23
+84 103 18
+84 104 52
+84 106 4
+84 107 7
+84 108 40
+84 109 22
+84 110 13
+84 111 43
+84 112 5
+84 113 35
+84 114 2
+84 115 49
+84 116 44
+84 117 8
+84 118 35
+84 119 27
+84 120 38
+84 121 39
+84 122 38
+84 123 41
+84 124 39
+84 125 46
+84 126 8
+85 0 26
+85 1 26
+85 2 13
+85 3 8
+85 4 37
+85 5 5
+85 6 30
+85 7 4
+85 8 33
+85 9 35
+85 10 35
+85 11 31
+85 13 21
+85 14 13
+85 15 30
+85 16 29
+85 17 33
+85 18 28
+85 19 26
+85 20 69
+85 21 36
+85 22 22
+85 23 32
+85 24 20
+85 25 14
+85 26 47
+85 27 27
+85 28 51
+85 29 3
+85 30 28
+85 31 45
+85 32 34
+85 33 57
+85 34 10
+85 35 15
+85 36 26
+85 37 7
+85 38 14
+85 39 16
+85 40 15
+85 41 38
+85 42 33
+85 43 21
+85 44 32
+85 45 77
+85 46 34
+85 47 22
+85 48 13
+85 49 36
+85 50 29
+85 51 41
+85 52 4
+85 53 27
+85 54 52
+85 55 40
+85 56 45
+85 57 28
+85 58 25
+85 59 19
+85 60 25
+85 61 8
+85 62 31
+85 63 35
+85 64 28
+85 65 24
+85 66 24
+85 67 49
+85 68 13
+85 69 18
+85 70 26
+85 71 36
+85 72 15
+85 73 21
+85 74 6
+85 75 28
+85 76 21
+85 77 34
+85 78 22
+85 79 3
+85 80 33
+85 81 22
+85 82 67
+85 83 31
+85 84 27
+85 86 7
+85 87 49
+85 88 19
+85 89 40
+85 90 21
+85 91 15
+85 92 26
+85 93 15
+85 94 29
+85 95 36
+85 96 20
+85 97 32
+85 98 24
+85 99 47
+85 100 21
+85 101 23
+85 102 39
+85 103 9
+85 104 38
+85 105 14
+85 106 18
+85 107 14
+85 108 47
+85 109 14
+85 110 22
+85 111 31
+85 112 19
+85 113 27
+85 114 20
+85 115 64
+85 116 20
+85 117 18
+85 118 21
+85 119 2
+85 120 42
+85 121 31
+85 122 10
+85 123 20
+85 124 31
+85 125 33
+85 126 8
+86 0 19
+86 1 49
+86 2 22
+86 3 34
+86 4 53
+86 5 41
+86 6 23
+86 7 35
+86 8 40
+86 9 58
+86 10 48
+86 11 24
+86 13 14
+86 14 22
+86 15 23
+86 16 52
+86 17 40
+86 18 21
+86 19 50
+86 20 82
+86 21 49
+86 22 15
+86 23 53
+86 24 54
+86 25 50
+86 26 57
+86 27 20
+86 28 56
+86 29 39
+86 30 40
+86 31 68
+86 32 27
+86 33 70
+86 34 19
+86 35 8
+86 36 19
+86 37 33
+86 38 48
+86 39 29
+86 40 37
+86 41 51
+86 42 56
+86 43 14
+86 44 25
+86 45 71
+86 46 51
+86 47 15
+86 48 49
+86 49 29
+86 50 22
+86 51 54
+86 52 37
+86 53 50
+86 54 68
+86 55 33
+86 56 39
+86 57 52
+86 58 18
+86 59 25
+86 60 34
+86 61 34
+86 62 24
+86 63 43
+86 64 37
+86 65 42
+86 66 17
+86 67 72
+86 68 22
+86 69 41
+86 70 33
+86 71 55
+86 72 35
+86 73 14
+86 74 51
+86 75 21
+86 76 14
+86 77 27
+86 78 38
+86 79 37
+86 80 56
+86 81 38
+86 82 69
+86 83 54
+86 84 20
+86 87 65
+86 88 12
+86 89 33
+86 90 14
+86 91 8
+86 92 19
+86 93 41
+86 94 28
+86 95 51
+86 96 13
+86 97 25
+86 98 41
+86 99 41
+86 100 44
+86 101 16
+86 102 32
+86 103 18
+86 104 61
+86 106 11
+86 107 7
+86 108 49
+86 109 22
+86 110 15
+86 111 52
+86 112 12
+86 113 43
+86 114 13
+86 115 58
+86 116 53
+86 117 11
+86 118 44
+86 119 36
+86 120 47
+86 121 47
+86 122 36
+86 123 46
+86 124 39
+86 125 55
+86 126 1
+87 0 28
+87 1 45
+87 2 34
+87 3 46
+87 4 9
+87 5 33
+87 6 32
+87 7 36
+87 8 47
+87 9 3
+87 10 37
+87 11 47
+87 13 33
+87 14 34
+87 15 15
+87 16 51
+87 17 38
+87 18 41
+87 19 39
+87 20 20
+87 21 38
+87 22 21
+87 23 39
+87 24 46
+87 25 42
+87 26 18
+87 27 29
+87 28 17
+87 29 31
+87 30 45
+87 31 13
+87 32 47
+87 33 8
+87 34 42
+87 35 28
+87 36 33
+87 37 46
+87 38 40
+87 39 52
+87 40 44
+87 41 40
+87 42 47
+87 43 21
+87 44 17
+87 45 34
+87 46 46
+87 47 27
+87 48 41
+87 49 34
+87 50 36
+87 51 1
+87 52 29
+87 53 41
+87 54 3
+87 55 11
+87 56 11
+87 57 41
+87 58 33
+87 59 45
+87 60 27
+87 61 47
+87 62 39
+87 63 12
+87 64 26
+87 65 18
+87 66 27
+87 67 18
+87 68 34
+87 69 47
+87 70 40
+87 71 2
+87 72 27
+87 73 23
+87 74 52
+87 75 42
+87 76 34
+87 77 50
+87 78 44
+87 79 29
+87 80 7
+87 81 45
+87 82 33
+87 83 13
+87 84 35
+87 86 32
+87 88 35
+87 89 48
+87 90 35
+87 91 33
+87 92 21
+87 93 43
+87 94 44
+87 95 49
+87 96 23
+87 97 27
+87 98 43
+87 99 13
+87 100 44
+87 101 25
+87 102 38
+87 103 30
+87 104 6
+87 106 31
+87 107 32
+87 108 13
+87 109 35
+87 110 35
+87 111 38
+87 112 23
+87 113 47
+87 114 29
+87 115 21
+87 116 45
+87 117 29
+87 118 43
+87 119 28
+87 120 8
+87 121 49
+87 122 46
+87 123 36
+87 124 52
+87 125 15
+87 126 26
+88 0 26
+88 1 37
+88 2 10
+88 3 42
+88 4 41
+88 5 29
+88 6 30
+88 7 32
+88 8 46
+88 9 46
+88 10 46
+88 11 12
+88 13 2
+88 14 10
+88 15 11
+88 16 40
+88 17 46
+88 18 36
+88 19 42
+88 20 70
+88 21 44
+88 22 3
+88 23 47
+88 24 42
+88 25 38
+88 26 45
+88 27 27
+88 28 44
+88 29 27
+88 30 39
+88 31 56
+88 32 15
+88 33 58
+88 34 38
+88 35 26
+88 36 7
+88 37 42
+88 38 36
+88 39 48
+88 40 32
+88 41 46
+88 42 44
+88 43 22
+88 44 13
+88 45 59
+88 46 39
+88 47 3
+88 48 37
+88 49 36
+88 50 34
+88 51 42
+88 52 25
+88 53 38
+88 54 56
+88 55 21
+88 56 27
+88 57 44
+88 58 28
+88 59 40
+88 60 22
+88 61 43
+88 62 36
+88 63 31
+88 64 25
+88 65 30
+88 66 24
+88 67 60
+88 68 10
+88 69 29
+88 70 41
+88 71 43
+88 72 23
+88 73 21
+88 74 48
+88 75 9
+88 76 29
+88 77 15
+88 78 26
+88 79 25
+88 80 44
+88 81 33
+88 82 57
+88 83 42
+88 84 32
+88 86 28
+88 87 53
+88 89 45
+88 90 2
+88 91 20
+88 92 27
+88 93 40
+88 94 16
+88 95 50
+88 96 20
+88 97 13
+88 98 36
+88 99 29
+88 100 32
+88 101 23
+88 102 20
+88 103 6
+88 104 49
+88 106 29
+88 107 29
+88 108 37
+88 109 10
+88 110 30
+88 111 46
+88 112 20
+88 113 38
+88 114 26
+88 115 46
+88 116 41
+88 117 27
+88 118 32
+88 119 24
+88 120 35
+88 121 42
+88 122 35
+88 123 47
+88 124 27
+88 125 43
+88 126 23
+89 0 24
+89 1 55
+89 2 37
+89 3 61
+89 4 60
+89 5 48
+89 6 28
+89 7 51
+89 8 45
+89 9 64
+89 10 53
+89 11 43
+89 13 33
+89 14 37
+89 15 30
+89 16 58
+89 17 45
+89 18 31
+89 19 55
+89 20 89
+89 21 54
+89 22 22
+89 23 58
+89 24 61
+89 25 57
+89 26 64
+89 27 25
+89 28 63
+89 29 46
+89 30 45
+89 31 74
+89 32 42
+89 33 77
+89 34 57
+89 35 18
+89 36 34
+89 37 61
+89 38 55
+89 39 67
+89 40 52
+89 41 56
+89 42 62
+89 43 19
+89 44 32
+89 45 78
+89 46 56
+89 47 30
+89 48 56
+89 49 34
+89 50 12
+89 51 61
+89 52 44
+89 53 56
+89 54 75
+89 55 40
+89 56 46
+89 57 57
+89 58 16
+89 59 6
+89 60 49
+89 61 62
+89 62 34
+89 63 50
+89 64 52
+89 65 57
+89 66 9
+89 67 78
+89 68 37
+89 69 47
+89 70 38
+89 71 62
+89 72 42
+89 73 19
+89 74 67
+89 75 36
+89 76 24
+89 77 46
+89 78 45
+89 79 44
+89 80 62
+89 81 43
+89 82 76
+89 83 60
+89 84 30
+89 86 47
+89 87 72
+89 88 31
+89 90 29
+89 91 27
+89 92 24
+89 93 50
+89 94 45
+89 95 56
+89 96 18
+89 97 33
+89 98 46
+89 99 48
+89 100 50
+89 101 21
+89 102 39
+89 103 33
+89 104 67
+89 106 21
+89 107 26
+89 108 56
+89 109 37
+89 110 22
+89 111 57
+89 112 17
+89 113 48
+89 114 11
+89 115 65
+89 116 60
+89 117 16
+89 118 50
+89 119 43
+89 120 54
+89 121 52
+89 122 53
+89 123 57
+89 124 54
+89 125 62
+89 126 20
+90 0 24
+90 1 49
+90 2 8
+90 3 52
+90 4 53
+90 5 39
+90 6 28
+90 7 42
+90 8 56
+90 9 58
+90 10 47
+90 11 24
+90 13 14
+90 14 8
+90 15 23
+90 16 52
+90 17 48
+90 18 34
+90 19 49
+90 20 82
+90 21 48
+90 22 15
+90 23 49
+90 24 52
+90 25 48
+90 26 57
+90 27 25
+90 28 56
+90 29 37
+90 30 45
+90 31 68
+90 32 13
+90 33 70
+90 34 48
+90 35 24
+90 36 5
+90 37 52
+90 38 46
+90 39 58
+90 40 44
+90 41 50
+90 42 56
+90 43 30
+90 44 23
+90 45 71
+90 46 51
+90 47 1
+90 48 47
+90 49 34
+90 50 32
+90 51 54
+90 52 35
+90 53 50
+90 54 68
+90 55 33
+90 56 39
+90 57 51
+90 58 26
+90 59 38
+90 60 20
+90 61 53
+90 62 34
+90 63 43
+90 64 23
+90 65 28
+90 66 22
+90 67 72
+90 68 8
+90 69 41
+90 70 49
+90 71 55
+90 72 33
+90 73 19
+90 74 58
+90 75 7
+90 76 27
+90 77 27
+90 78 38
+90 79 35
+90 80 56
+90 81 45
+90 82 69
+90 83 54
+90 84 30
+90 86 38
+90 87 65
+90 88 12
+90 89 43
+90 91 32
+90 92 35
+90 93 52
+90 94 28
+90 95 56
+90 96 18
+90 97 25
+90 98 48
+90 99 41
+90 100 44
+90 101 21
+90 102 32
+90 103 4
+90 104 61
+90 106 27
+90 107 37
+90 108 49
+90 109 8
+90 110 28
+90 111 48
+90 112 28
+90 113 50
+90 114 24
+90 115 58
+90 116 51
+90 117 25
+90 118 44
+90 119 34
+90 120 47
+90 121 54
+90 122 47
+90 123 46
+90 124 25
+90 125 55
+90 126 31
+91 0 30
+91 1 41
+91 2 14
+91 3 46
+91 4 45
+91 5 33
+91 6 34
+91 7 36
+91 8 50
+91 9 50
+91 10 50
+91 11 16
+91 13 6
+91 14 14
+91 15 15
+91 16 44
+91 17 50
+91 18 40
+91 19 46
+91 20 74
+91 21 48
+91 22 7
+91 23 51
+91 24 46
+91 25 42
+91 26 49
+91 27 31
+91 28 48
+91 29 31
+91 30 43
+91 31 60
+91 32 19
+91 33 62
+91 34 42
+91 35 30
+91 36 11
+91 37 46
+91 38 40
+91 39 52
+91 40 36
+91 41 50
+91 42 48
+91 43 26
+91 44 17
+91 45 63
+91 46 43
+91 47 7
+91 48 41
+91 49 40
+91 50 38
+91 51 46
+91 52 29
+91 53 42
+91 54 60
+91 55 25
+91 56 31
+91 57 48
+91 58 32
+91 59 44
+91 60 26
+91 61 47
+91 62 40
+91 63 35
+91 64 29
+91 65 34
+91 66 28
+91 67 64
+91 68 14
+91 69 33
+91 70 45
+91 71 47
+91 72 27
+91 73 25
+91 74 52
+91 75 13
+91 76 33
+91 77 19
+91 78 30
+91 79 29
+91 80 48
+91 81 37
+91 82 61
+91 83 46
+91 84 36
+91 86 32
+91 87 57
+91 88 4
+91 89 49
+91 90 6
+91 92 31
+91 93 44
+91 94 20
+91 95 54
+91 96 24
+91 97 17
+91 98 40
+91 99 33
+91 100 36
+91 101 27
+91 102 24
+91 103 10
+91 104 53
+91 106 33
+91 107 33
+91 108 41
+91 109 14
+91 110 34
+91 111 50
+91 112 24
+91 113 42
+91 114 30
+91 115 50
+91 116 45
+91 117 31
+91 118 36
+91 119 28
+91 120 39
+91 121 46
+91 122 39
+91 123 51
+91 124 31
+91 125 47
+91 126 27
+92 0 11
+92 1 40
+92 2 22
+92 3 58
+92 4 51
+92 5 45
+92 6 15
+92 7 48
+92 8 30
+92 9 49
+92 10 38
+92 11 28
+92 13 18
+92 14 22
+92 15 27
+92 16 37
+92 17 30
+92 18 24
+92 19 40
+92 20 83
+92 21 39
+92 22 19
+92 23 43
+92 24 58
+92 25 54
+92 26 61
+92 27 12
+92 28 60
+92 29 43
+92 30 24
+92 31 59
+92 32 27
+92 33 71
+92 34 54
+92 35 11
+92 36 19
+92 37 58
+92 38 52
+92 39 56
+92 40 39
+92 41 41
+92 42 47
+92 43 4
+92 44 29
+92 45 75
+92 46 41
+92 47 15
+92 48 53
+92 49 13
+92 50 19
+92 51 55
+92 52 41
+92 53 41
+92 54 66
+92 55 37
+92 56 43
+92 57 42
+92 58 22
+92 59 28
+92 60 34
+92 61 49
+92 62 23
+92 63 47
+92 64 37
+92 65 41
+92 66 18
+92 67 63
+92 68 22
+92 69 32
+92 70 23
+92 71 50
+92 72 39
+92 73 6
+92 74 64
+92 75 21
+92 76 17
+92 77 31
+92 78 36
+92 79 41
+92 80 47
+92 81 28
+92 82 73
+92 83 45
+92 84 23
+92 86 44
+92 87 63
+92 88 16
+92 89 32
+92 90 14
+92 91 12
+92 93 35
+92 94 32
+92 95 35
+92 96 14
+92 97 20
+92 98 31
+92 99 45
+92 100 35
+92 101 8
+92 102 36
+92 103 18
+92 104 52
+92 106 14
+92 107 11
+92 108 53
+92 109 22
+92 110 18
+92 111 42
+92 112 2
+92 113 33
+92 114 17
+92 115 62
+92 116 57
+92 117 12
+92 118 35
+92 119 40
+92 120 51
+92 121 37
+92 122 38
+92 123 41
+92 124 39
+92 125 47
+92 126 5
+93 0 47
+93 1 30
+93 2 31
+93 3 84
+93 4 41
+93 5 71
+93 6 51
+93 7 74
+93 8 26
+93 9 39
+93 10 28
+93 11 54
+93 13 44
+93 14 31
+93 15 53
+93 16 33
+93 17 29
+93 18 37
+93 19 30
+93 20 73
+93 21 29
+93 22 45
+93 23 21
+93 24 84
+93 25 80
+93 26 51
+93 27 48
+93 28 55
+93 29 69
+93 30 21
+93 31 49
+93 32 57
+93 33 61
+93 34 80
+93 35 40
+93 36 45
+93 37 84
+93 38 78
+93 39 90
+93 40 74
+93 41 31
+93 42 25
+93 43 42
+93 44 55
+93 45 81
+93 46 19
+93 47 24
+93 48 79
+93 49 53
+93 50 38
+93 51 45
+93 52 67
+93 53 31
+93 54 56
+93 55 47
+93 56 49
+93 57 32
+93 58 49
+93 59 41
+93 60 43
+93 61 43
+93 62 44
+93 63 39
+93 64 46
+93 65 9
+93 66 45
+93 67 53
+93 68 31
+93 69 22
+93 70 61
+93 71 40
+93 72 65
+93 73 42
+93 74 90
+93 75 51
+93 76 30
+93 77 57
+93 78 26
+93 79 67
+93 80 37
+93 81 18
+93 82 71
+93 83 35
+93 84 52
+93 86 70
+93 87 53
+93 88 42
+93 89 53
+93 90 44
+93 91 40
+93 92 45
+93 94 58
+93 95 32
+93 96 41
+93 97 55
+93 98 9
+93 99 51
+93 100 17
+93 101 44
+93 102 62
+93 103 27
+93 104 42
+93 106 39
+93 107 39
+93 108 51
+93 109 32
+93 110 31
+93 111 20
+93 112 40
+93 113 23
+93 114 45
+93 115 68
+93 116 83
+93 117 43
+93 118 25
+93 119 66
+93 120 46
+93 121 27
+93 122 28
+93 123 27
+93 124 49
+93 125 37
+93 126 33
+94 0 28
+94 1 60
+94 2 12
+94 3 65
+94 4 64
+94 5 52
+94 6 32
+94 7 55
+94 8 60
+94 9 64
+94 10 52
+94 11 35
+94 13 25
+94 14 12
+94 15 34
+94 16 62
+94 17 53
+94 18 41
+94 19 54
+94 20 93
+94 21 53
+94 22 26
+94 23 54
+94 24 65
+94 25 61
+94 26 68
+94 27 29
+94 28 67
+94 29 50
+94 30 49
+94 31 74
+94 32 38
+94 33 81
+94 34 61
+94 35 28
+94 36 30
+94 37 65
+94 38 59
+94 39 71
+94 40 55
+94 41 55
+94 42 62
+94 43 34
+94 44 36
+94 45 82
+94 46 61
+94 47 26
+94 48 60
+94 49 38
+94 50 36
+94 51 65
+94 52 48
+94 53 56
+94 54 79
+94 55 44
+94 56 50
+94 57 56
+94 58 30
+94 59 45
+94 60 24
+94 61 66
+94 62 38
+94 63 54
+94 64 27
+94 65 33
+94 66 26
+94 67 78
+94 68 12
+94 69 52
+94 70 53
+94 71 65
+94 72 46
+94 73 23
+94 74 71
+94 75 32
+94 76 34
+94 77 38
+94 78 49
+94 79 48
+94 80 62
+94 81 56
+94 82 80
+94 83 60
+94 84 34
+94 86 51
+94 87 76
+94 88 23
+94 89 47
+94 90 25
+94 91 42
+94 92 39
+94 93 58
+94 95 60
+94 96 22
+94 97 36
+94 98 58
+94 99 52
+94 100 55
+94 101 25
+94 102 43
+94 103 8
+94 104 67
+94 106 31
+94 107 41
+94 108 60
+94 109 13
+94 110 35
+94 111 53
+94 112 32
+94 113 61
+94 114 28
+94 115 69
+94 116 64
+94 117 29
+94 118 55
+94 119 47
+94 120 58
+94 121 64
+94 122 58
+94 123 51
+94 124 30
+94 125 62
+94 126 35
+95 0 33
+95 1 19
+95 2 19
+95 3 71
+95 4 23
+95 5 58
+95 6 37
+95 7 61
+95 8 18
+95 9 21
+95 10 12
+95 11 42
+95 13 32
+95 14 19
+95 15 40
+95 16 2
+95 17 21
+95 18 21
+95 19 14
+95 20 55
+95 21 13
+95 22 32
+95 23 9
+95 24 71
+95 25 67
+95 26 33
+95 27 34
+95 28 37
+95 29 56
+95 30 13
+95 31 31
+95 32 39
+95 33 43
+95 34 67
+95 35 32
+95 36 24
+95 37 71
+95 38 65
+95 39 77
+95 40 61
+95 41 15
+95 42 17
+95 43 26
+95 44 42
+95 45 63
+95 46 11
+95 47 12
+95 48 66
+95 49 37
+95 50 22
+95 51 27
+95 52 54
+95 53 13
+95 54 38
+95 55 29
+95 56 31
+95 57 11
+95 58 36
+95 59 25
+95 60 31
+95 61 22
+95 62 28
+95 63 21
+95 64 34
+95 65 6
+95 66 29
+95 67 35
+95 68 19
+95 69 16
+95 70 40
+95 71 22
+95 72 52
+95 73 28
+95 74 77
+95 75 33
+95 76 14
+95 77 45
+95 78 20
+95 79 54
+95 80 19
+95 81 20
+95 82 53
+95 83 17
+95 84 39
+95 86 57
+95 87 35
+95 88 30
+95 89 37
+95 90 26
+95 91 32
+95 92 29
+95 93 13
+95 94 46
+95 96 27
+95 97 42
+95 98 1
+95 99 33
+95 100 19
+95 101 30
+95 102 49
+95 103 15
+95 104 24
+95 106 23
+95 107 31
+95 108 33
+95 109 20
+95 110 15
+95 111 8
+95 112 24
+95 113 17
+95 114 31
+95 115 50
+95 116 70
+95 117 32
+95 118 19
+95 119 53
+95 120 28
+95 121 21
+95 122 19
+95 123 17
+95 124 37
+95 125 19
+95 126 27
+96 0 6
+96 1 43
+96 2 24
+96 3 57
+96 4 56
+96 5 44
+96 6 10
+96 7 47
+96 8 38
+96 9 57
+96 10 46
+96 11 36
+96 13 26
+96 14 30
+96 15 26
+96 16 40
+96 17 38
+96 18 19
+96 19 48
+96 20 85
+96 21 47
+96 22 18
+96 23 47
+96 24 57
+96 25 53
+96 26 60
+96 27 7
+96 28 59
+96 29 42
+96 30 27
+96 31 67
+96 32 35
+96 33 73
+96 34 53
+96 35 6
+96 36 27
+96 37 57
+96 38 51
+96 39 51
+96 40 34
+96 41 49
+96 42 55
+96 43 12
+96 44 28
+96 45 74
+96 46 49
+96 47 23
+96 48 52
+96 49 16
+96 50 14
+96 51 57
+96 52 40
+96 53 49
+96 54 71
+96 55 36
+96 56 42
+96 57 49
+96 58 11
+96 59 23
+96 60 37
+96 61 57
+96 62 16
+96 63 46
+96 64 45
+96 65 44
+96 66 4
+96 67 71
+96 68 30
+96 69 40
+96 70 31
+96 71 58
+96 72 38
+96 73 1
+96 74 63
+96 75 29
+96 76 12
+96 77 39
+96 78 41
+96 79 40
+96 80 55
+96 81 36
+96 82 72
+96 83 53
+96 84 12
+96 86 43
+96 87 68
+96 88 24
+96 89 25
+96 90 22
+96 91 20
+96 92 17
+96 93 43
+96 94 40
+96 95 38
+96 97 15
+96 98 39
+96 99 44
+96 100 43
+96 101 3
+96 102 35
+96 103 26
+96 104 60
+96 106 9
+96 107 19
+96 108 52
+96 109 30
+96 110 13
+96 111 46
+96 112 10
+96 113 41
+96 114 6
+96 115 61
+96 116 56
+96 117 7
+96 118 43
+96 119 39
+96 120 50
+96 121 45
+96 122 46
+96 123 44
+96 124 47
+96 125 55
+96 126 13
+97 0 25
+97 1 48
+97 2 9
+97 3 52
+97 4 52
+97 5 40
+97 6 29
+97 7 42
+97 8 57
+97 9 57
+97 10 57
+97 11 23
+97 13 13
+97 14 20
+97 15 22
+97 16 51
+97 17 57
+97 18 38
+97 19 53
+97 20 81
+97 21 55
+97 22 14
+97 23 58
+97 24 53
+97 25 49
+97 26 56
+97 27 26
+97 28 55
+97 29 38
+97 30 46
+97 31 67
+97 32 26
+97 33 69
+97 34 48
+97 35 25
+97 36 18
+97 37 53
+97 38 47
+97 39 36
+97 40 19
+97 41 57
+97 42 55
+97 43 31
+97 44 24
+97 45 70
+97 46 50
+97 47 13
+97 48 48
+97 49 35
+97 50 33
+97 51 53
+97 52 36
+97 53 49
+97 54 67
+97 55 32
+97 56 38
+97 57 55
+97 58 28
+97 59 42
+97 60 22
+97 61 54
+97 62 35
+97 63 42
+97 64 35
+97 65 41
+97 66 23
+97 67 71
+97 68 20
+97 69 40
+97 70 50
+97 71 54
+97 72 34
+97 73 20
+97 74 59
+97 75 20
+97 76 31
+97 77 26
+97 78 37
+97 79 36
+97 80 55
+97 81 44
+97 82 68
+97 83 53
+97 84 31
+97 86 39
+97 87 64
+97 88 11
+97 89 44
+97 90 13
+97 91 7
+97 92 36
+97 93 51
+97 94 27
+97 95 57
+97 96 19
+97 98 47
+97 99 40
+97 100 43
+97 101 22
+97 102 31
+97 103 16
+97 104 60
+97 106 28
+97 107 38
+97 108 48
+97 109 21
+97 110 32
+97 111 57
+97 112 29
+97 113 49
+97 114 25
+97 115 57
+97 116 52
+97 117 26
+97 118 43
+97 119 35
+97 120 46
+97 121 53
+97 122 46
+97 123 58
+97 124 38
+97 125 54
+97 126 32
+98 0 38
+98 1 28
+98 2 22
+98 3 75
+98 4 36
+98 5 62
+98 6 42
+98 7 65
+98 8 17
+98 9 34
+98 10 22
+98 11 45
+98 13 35
+98 14 22
+98 15 44
+98 16 25
+98 17 24
+98 18 31
+98 19 24
+98 20 68
+98 21 23
+98 22 36
+98 23 12
+98 24 75
+98 25 71
+98 26 46
+98 27 39
+98 28 50
+98 29 60
+98 30 12
+98 31 44
+98 32 48
+98 33 56
+98 34 71
+98 35 38
+98 36 39
+98 37 75
+98 38 69
+98 39 81
+98 40 65
+98 41 25
+98 42 16
+98 43 36
+98 44 46
+98 45 76
+98 46 10
+98 47 15
+98 48 70
+98 49 47
+98 50 32
+98 51 40
+98 52 58
+98 53 26
+98 54 51
+98 55 42
+98 56 44
+98 57 26
+98 58 40
+98 59 35
+98 60 34
+98 61 37
+98 62 38
+98 63 34
+98 64 37
+98 65 25
+98 66 36
+98 67 48
+98 68 22
+98 69 30
+98 70 55
+98 71 35
+98 72 56
+98 73 33
+98 74 81
+98 75 42
+98 76 24
+98 77 48
+98 78 34
+98 79 58
+98 80 32
+98 81 26
+98 82 66
+98 83 30
+98 84 44
+98 86 61
+98 87 48
+98 88 33
+98 89 47
+98 90 35
+98 91 42
+98 92 39
+98 93 16
+98 94 49
+98 95 23
+98 96 32
+98 97 46
+98 99 46
+98 100 33
+98 101 35
+98 102 53
+98 103 18
+98 104 37
+98 106 33
+98 107 41
+98 108 46
+98 109 23
+98 110 25
+98 111 11
+98 112 34
+98 113 30
+98 114 38
+98 115 63
+98 116 74
+98 117 39
+98 118 33
+98 119 57
+98 120 41
+98 121 34
+98 122 23
+98 123 29
+98 124 40
+98 125 32
+98 126 37
+99 0 35
+99 1 50
+99 2 52
+99 3 70
+99 4 12
+99 5 57
+99 6 39
+99 7 60
+99 8 60
+99 9 27
+99 10 49
+99 11 58
+99 13 48
+99 14 52
+99 15 39
+99 16 62
+99 17 50
+99 18 48
+99 19 51
+99 20 44
+99 21 50
+99 22 45
+99 23 51
+99 24 70
+99 25 66
+99 26 27
+99 27 36
+99 28 26
+99 29 55
+99 30 54
+99 31 37
+99 32 57
+99 33 32
+99 34 66
+99 35 35
+99 36 49
+99 37 70
+99 38 64
+99 39 76
+99 40 63
+99 41 52
+99 42 57
+99 43 34
+99 44 41
+99 45 30
+99 46 58
+99 47 45
+99 48 65
+99 49 43
+99 50 43
+99 51 13
+99 52 53
+99 53 51
+99 54 27
+99 55 35
+99 56 25
+99 57 53
+99 58 40
+99 59 52
+99 60 51
+99 61 64
+99 62 45
+99 63 2
+99 64 50
+99 65 30
+99 66 33
+99 67 31
+99 68 52
+99 69 51
+99 70 53
+99 71 14
+99 72 51
+99 73 30
+99 74 76
+99 75 51
+99 76 41
+99 77 61
+99 78 55
+99 79 53
+99 80 27
+99 81 47
+99 82 35
+99 83 30
+99 84 41
+99 86 56
+99 87 24
+99 88 46
+99 89 54
+99 90 44
+99 91 42
+99 92 30
+99 93 53
+99 94 62
+99 95 61
+99 96 29
+99 97 44
+99 98 50
+99 100 46
+99 101 32
+99 102 62
+99 103 48
+99 104 30
+99 106 38
+99 107 41
+99 108 15
+99 109 52
+99 110 42
+99 111 50
+99 112 32
+99 113 52
+99 114 35
+99 115 17
+99 116 69
+99 117 36
+99 118 45
+99 119 52
+99 120 17
+99 121 56
+99 122 48
+99 123 48
+99 124 69
+99 125 21
+99 126 35
+100 0 34
+100 1 13
+100 2 26
+100 3 69
+100 4 24
+100 5 56
+100 6 38
+100 7 59
+100 8 21
+100 9 22
+100 10 14
+100 11 39
+100 13 29
+100 14 26
+100 15 38
+100 16 16
+100 17 14
+100 18 23
+100 19 16
+100 20 56
+100 21 15
+100 22 30
+100 23 16
+100 24 69
+100 25 65
+100 26 34
+100 27 35
+100 28 38
+100 29 54
+100 30 15
+100 31 32
+100 32 42
+100 33 44
+100 34 65
+100 35 23
+100 36 31
+100 37 69
+100 38 63
+100 39 75
+100 40 59
+100 41 17
+100 42 20
+100 43 28
+100 44 40
+100 45 64
+100 46 14
+100 47 19
+100 48 64
+100 49 39
+100 50 24
+100 51 28
+100 52 52
+100 53 14
+100 54 39
+100 55 30
+100 56 32
+100 57 18
+100 58 33
+100 59 27
+100 60 36
+100 61 29
+100 62 30
+100 63 22
+100 64 41
+100 65 18
+100 66 31
+100 67 36
+100 68 24
+100 69 5
+100 70 47
+100 71 23
+100 72 50
+100 73 29
+100 74 75
+100 75 36
+100 76 16
+100 77 42
+100 78 9
+100 79 52
+100 80 20
+100 81 1
+100 82 54
+100 83 18
+100 84 35
+100 86 55
+100 87 36
+100 88 27
+100 89 39
+100 90 29
+100 91 23
+100 92 31
+100 93 16
+100 94 43
+100 95 19
+100 96 28
+100 97 40
+100 98 4
+100 99 34
+100 101 31
+100 102 47
+100 103 22
+100 104 25
+100 106 25
+100 107 22
+100 108 34
+100 109 27
+100 110 17
+100 111 15
+100 112 26
+100 113 6
+100 114 28
+100 115 51
+100 116 68
+100 117 26
+100 118 8
+100 119 51
+100 120 29
+100 121 10
+100 122 11
+100 123 15
+100 124 44
+100 125 20
+100 126 16
+101 0 14
+101 1 40
+101 2 21
+101 3 60
+101 4 56
+101 5 47
+101 6 18
+101 7 50
+101 8 35
+101 9 54
+101 10 43
+101 11 33
+101 13 23
+101 14 27
+101 15 29
+101 16 37
+101 17 35
+101 18 16
+101 19 45
+101 20 88
+101 21 44
+101 22 21
+101 23 44
+101 24 60
+101 25 56
+101 26 63
+101 27 4
+101 28 62
+101 29 45
+101 30 24
+101 31 64
+101 32 32
+101 33 76
+101 34 56
+101 35 3
+101 36 24
+101 37 60
+101 38 54
+101 39 48
+101 40 31
+101 41 46
+101 42 52
+101 43 9
+101 44 31
+101 45 77
+101 46 46
+101 47 20
+101 48 55
+101 49 13
+101 50 11
+101 51 60
+101 52 43
+101 53 46
+101 54 71
+101 55 39
+101 56 45
+101 57 46
+101 58 18
+101 59 20
+101 60 34
+101 61 54
+101 62 15
+101 63 49
+101 64 42
+101 65 41
+101 66 11
+101 67 68
+101 68 27
+101 69 37
+101 70 28
+101 71 55
+101 72 41
+101 73 9
+101 74 66
+101 75 26
+101 76 9
+101 77 36
+101 78 41
+101 79 43
+101 80 52
+101 81 33
+101 82 75
+101 83 50
+101 84 15
+101 86 46
+101 87 68
+101 88 21
+101 89 24
+101 90 19
+101 91 17
+101 92 14
+101 93 40
+101 94 37
+101 95 35
+101 96 8
+101 97 12
+101 98 36
+101 99 47
+101 100 40
+101 102 38
+101 103 23
+101 104 57
+101 106 6
+101 107 16
+101 108 55
+101 109 27
+101 110 10
+101 111 43
+101 112 7
+101 113 38
+101 114 13
+101 115 64
+101 116 59
+101 117 6
+101 118 40
+101 119 42
+101 120 53
+101 121 42
+101 122 43
+101 123 41
+101 124 44
+101 125 52
+101 126 10
+102 0 28
+102 1 17
+102 2 12
+102 3 48
+102 4 28
+102 5 35
+102 6 32
+102 7 38
+102 8 26
+102 9 26
+102 10 26
+102 11 27
+102 13 17
+102 14 16
+102 15 26
+102 16 20
+102 17 26
+102 18 35
+102 19 22
+102 20 60
+102 21 24
+102 22 18
+102 23 27
+102 24 48
+102 25 44
+102 26 38
+102 27 29
+102 28 42
+102 29 33
+102 30 19
+102 31 36
+102 32 9
+102 33 48
+102 34 44
+102 35 27
+102 36 13
+102 37 48
+102 38 42
+102 39 54
+102 40 46
+102 41 26
+102 42 24
+102 43 33
+102 44 19
+102 45 68
+102 46 19
+102 47 9
+102 48 43
+102 49 38
+102 50 36
+102 51 32
+102 52 31
+102 53 18
+102 54 43
+102 55 34
+102 56 36
+102 57 24
+102 58 31
+102 59 39
+102 60 25
+102 61 35
+102 62 38
+102 63 26
+102 64 31
+102 65 24
+102 66 26
+102 67 40
+102 68 16
+102 69 9
+102 70 52
+102 71 27
+102 72 29
+102 73 23
+102 74 54
+102 75 10
+102 76 28
+102 77 30
+102 78 6
+102 79 31
+102 80 24
+102 81 13
+102 82 58
+102 83 22
+102 84 34
+102 86 34
+102 87 40
+102 88 15
+102 89 47
+102 90 8
+102 91 27
+102 92 38
+102 93 20
+102 94 6
+102 95 30
+102 96 22
+102 97 28
+102 98 16
+102 99 38
+102 100 12
+102 101 25
+102 103 12
+102 104 29
+102 106 30
+102 107 26
+102 108 38
+102 109 16
+102 110 29
+102 111 26
+102 112 31
+102 113 18
+102 114 28
+102 115 55
+102 116 47
+102 117 29
+102 118 12
+102 119 30
+102 120 33
+102 121 22
+102 122 15
+102 123 27
+102 124 21
+102 125 24
+102 126 20
+103 0 20
+103 1 52
+103 2 4
+103 3 57
+103 4 56
+103 5 44
+103 6 24
+103 7 47
+103 8 52
+103 9 56
+103 10 44
+103 11 27
+103 13 17
+103 14 4
+103 15 26
+103 16 54
+103 17 45
+103 18 33
+103 19 46
+103 20 85
+103 21 45
+103 22 18
+103 23 46
+103 24 57
+103 25 53
+103 26 60
+103 27 21
+103 28 59
+103 29 42
+103 30 41
+103 31 66
+103 32 30
+103 33 73
+103 34 53
+103 35 20
+103 36 22
+103 37 57
+103 38 51
+103 39 63
+103 40 47
+103 41 47
+103 42 54
+103 43 26
+103 44 28
+103 45 74
+103 46 53
+103 47 18
+103 48 52
+103 49 30
+103 50 28
+103 51 57
+103 52 40
+103 53 48
+103 54 71
+103 55 36
+103 56 42
+103 57 48
+103 58 22
+103 59 37
+103 60 16
+103 61 58
+103 62 30
+103 63 46
+103 64 19
+103 65 25
+103 66 18
+103 67 70
+103 68 4
+103 69 44
+103 70 45
+103 71 57
+103 72 38
+103 73 15
+103 74 63
+103 75 24
+103 76 26
+103 77 30
+103 78 41
+103 79 40
+103 80 54
+103 81 48
+103 82 72
+103 83 52
+103 84 26
+103 86 43
+103 87 68
+103 88 15
+103 89 39
+103 90 17
+103 91 34
+103 92 31
+103 93 50
+103 94 31
+103 95 52
+103 96 14
+103 97 28
+103 98 50
+103 99 44
+103 100 47
+103 101 17
+103 102 35
+103 104 59
+103 106 23
+103 107 33
+103 108 52
+103 109 5
+103 110 27
+103 111 45
+103 112 24
+103 113 53
+103 114 20
+103 115 61
+103 116 56
+103 117 21
+103 118 47
+103 119 39
+103 120 50
+103 121 56
+103 122 50
+103 123 43
+103 124 22
+103 125 54
+103 126 27
+104 0 28
+104 1 47
+104 2 35
+104 3 61
+104 4 3
+104 5 48
+104 6 32
+104 7 51
+104 8 47
+104 9 18
+104 10 39
+104 11 45
+104 13 35
+104 14 39
+104 15 30
+104 16 53
+104 17 40
+104 18 41
+104 19 41
+104 20 35
+104 21 40
+104 22 36
+104 23 41
+104 24 61
+104 25 57
+104 26 14
+104 27 29
+104 28 19
+104 29 46
+104 30 41
+104 31 13
+104 32 44
+104 33 23
+104 34 57
+104 35 28
+104 36 36
+104 37 61
+104 38 55
+104 39 67
+104 40 56
+104 41 42
+104 42 49
+104 43 21
+104 44 32
+104 45 39
+104 46 48
+104 47 32
+104 48 56
+104 49 30
+104 50 36
+104 51 3
+104 52 44
+104 53 43
+104 54 18
+104 55 26
+104 56 7
+104 57 43
+104 58 33
+104 59 45
+104 60 27
+104 61 54
+104 62 40
+104 63 11
+104 64 26
+104 65 20
+104 66 33
+104 67 18
+104 68 39
+104 69 49
+104 70 40
+104 71 4
+104 72 42
+104 73 23
+104 74 67
+104 75 38
+104 76 34
+104 77 48
+104 78 53
+104 79 44
+104 80 17
+104 81 45
+104 82 35
+104 83 28
+104 84 40
+104 86 47
+104 87 15
+104 88 33
+104 89 49
+104 90 31
+104 91 29
+104 92 17
+104 93 45
+104 94 49
+104 95 51
+104 96 29
+104 97 37
+104 98 45
+104 99 9
+104 100 46
+104 101 25
+104 102 53
+104 103 35
+104 106 31
+104 107 28
+104 108 15
+104 109 38
+104 110 35
+104 111 40
+104 112 19
+104 113 49
+104 114 29
+104 115 26
+104 116 60
+104 117 29
+104 118 45
+104 119 43
+104 120 10
+104 121 51
+104 122 48
+104 123 38
+104 124 56
+104 125 21
+104 126 22
+105 0 32
+105 1 46
+105 2 22
+105 3 11
+105 4 57
+105 5 14
+105 6 36
+105 7 8
+105 8 53
+105 9 55
+105 10 55
+105 11 37
+105 13 27
+105 14 22
+105 15 36
+105 16 49
+105 17 53
+105 18 34
+105 19 46
+105 20 89
+105 21 56
+105 22 28
+105 23 48
+105 24 27
+105 25 14
+105 26 67
+105 27 33
+105 28 69
+105 29 12
+105 30 48
+105 31 65
+105 32 40
+105 33 77
+105 34 14
+105 35 21
+105 36 32
+105 37 27
+105 38 21
+105 39 2
+105 40 18
+105 41 58
+105 42 52
+105 43 27
+105 44 38
+105 45 84
+105 46 46
+105 47 28
+105 48 2
+105 49 42
+105 50 35
+105 51 61
+105 52 10
+105 53 47
+105 54 72
+105 55 46
+105 56 52
+105 57 48
+105 58 31
+105 59 38
+105 60 34
+105 61 28
+105 62 37
+105 63 55
+105 64 37
+105 65 36
+105 66 30
+105 67 69
+105 68 22
+105 69 38
+105 70 46
+105 71 56
+105 72 8
+105 73 27
+105 74 28
+105 75 34
+105 76 27
+105 77 40
+105 78 42
+105 79 10
+105 80 53
+105 81 42
+105 82 82
+105 83 51
+105 84 33
+105 86 13
+105 87 69
+105 88 25
+105 89 46
+105 90 27
+105 91 21
+105 92 32
+105 93 27
+105 94 15
+105 95 56
+105 96 26
+105 97 38
+105 98 36
+105 99 54
+105 100 41
+105 101 29
+105 102 45
+105 103 18
+105 104 58
+105 106 24
+105 107 20
+105 108 62
+105 109 23
+105 110 28
+105 111 47
+105 112 25
+105 113 47
+105 114 26
+105 115 71
+105 116 26
+105 117 24
+105 118 41
+105 119 9
+105 120 60
+105 121 51
+105 122 30
+105 123 40
+105 124 40
+105 125 53
+105 126 14
+106 0 10
+106 1 39
+106 2 21
+106 3 57
+106 4 50
+106 5 44
+106 6 14
+106 7 47
+106 8 29
+106 9 48
+106 10 37
+106 11 27
+106 13 17
+106 14 21
+106 15 26
+106 16 42
+106 17 29
+106 18 23
+106 19 39
+106 20 82
+106 21 38
+106 22 18
+106 23 42
+106 24 57
+106 25 53
+106 26 60
+106 27 11
+106 28 59
+106 29 42
+106 30 31
+106 31 58
+106 32 26
+106 33 70
+106 34 53
+106 35 10
+106 36 18
+106 37 57
+106 38 51
+106 39 55
+106 40 38
+106 41 40
+106 42 46
+106 43 3
+106 44 28
+106 45 74
+106 46 40
+106 47 14
+106 48 52
+106 49 20
+106 50 18
+106 51 54
+106 52 40
+106 53 40
+106 54 65
+106 55 36
+106 56 42
+106 57 41
+106 58 21
+106 59 27
+106 60 33
+106 61 48
+106 62 22
+106 63 46
+106 64 36
+106 65 41
+106 66 17
+106 67 62
+106 68 21
+106 69 31
+106 70 22
+106 71 49
+106 72 38
+106 73 5
+106 74 63
+106 75 20
+106 76 16
+106 77 30
+106 78 35
+106 79 40
+106 80 46
+106 81 27
+106 82 72
+106 83 44
+106 84 22
+106 86 43
+106 87 62
+106 88 15
+106 89 31
+106 90 13
+106 91 11
+106 92 8
+106 93 34
+106 94 31
+106 95 42
+106 96 13
+106 97 19
+106 98 30
+106 99 44
+106 100 34
+106 101 7
+106 102 35
+106 103 17
+106 104 51
+106 107 10
+106 108 52
+106 109 21
+106 110 17
+106 111 41
+106 112 1
+106 113 32
+106 114 16
+106 115 61
+106 116 56
+106 117 11
+106 118 34
+106 119 39
+106 120 50
+106 121 36
+106 122 37
+106 123 41
+106 124 38
+106 125 46
+106 126 4
+107 0 12
+107 1 42
+107 2 15
+107 3 47
+107 4 46
+107 5 34
+107 6 16
+107 7 37
+107 8 33
+107 9 51
+107 10 41
+107 11 17
+107 13 7
+107 14 15
+107 15 16
+107 16 45
+107 17 33
+107 18 14
+107 19 43
+107 20 75
+107 21 42
+107 22 8
+107 23 46
+107 24 47
+107 25 43
+107 26 50
+107 27 13
+107 28 49
+107 29 32
+107 30 33
+107 31 61
+107 32 20
+107 33 63
+107 34 43
+107 35 1
+107 36 12
+107 37 47
+107 38 41
+107 39 53
+107 40 37
+107 41 44
+107 42 49
+107 43 7
+107 44 18
+107 45 64
+107 46 44
+107 47 8
+107 48 42
+107 49 22
+107 50 15
+107 51 47
+107 52 30
+107 53 43
+107 54 61
+107 55 26
+107 56 32
+107 57 45
+107 58 11
+107 59 18
+107 60 27
+107 61 48
+107 62 17
+107 63 36
+107 64 30
+107 65 35
+107 66 10
+107 67 65
+107 68 15
+107 69 34
+107 70 26
+107 71 48
+107 72 28
+107 73 7
+107 74 53
+107 75 14
+107 76 7
+107 77 20
+107 78 31
+107 79 30
+107 80 49
+107 81 31
+107 82 62
+107 83 47
+107 84 13
+107 86 33
+107 87 58
+107 88 5
+107 89 26
+107 90 7
+107 91 1
+107 92 12
+107 93 38
+107 94 21
+107 95 44
+107 96 6
+107 97 18
+107 98 34
+107 99 34
+107 100 37
+107 101 9
+107 102 25
+107 103 11
+107 104 54
+107 106 4
+107 108 42
+107 109 15
+107 110 8
+107 111 45
+107 112 5
+107 113 36
+107 114 6
+107 115 51
+107 116 46
+107 117 4
+107 118 37
+107 119 29
+107 120 40
+107 121 40
+107 122 40
+107 123 45
+107 124 32
+107 125 48
+107 126 8
+108 0 20
+108 1 35
+108 2 38
+108 3 71
+108 4 21
+108 5 58
+108 6 24
+108 7 61
+108 8 52
+108 9 19
+108 10 45
+108 11 50
+108 13 40
+108 14 44
+108 15 40
+108 16 47
+108 17 45
+108 18 33
+108 19 47
+108 20 53
+108 21 46
+108 22 32
+108 23 47
+108 24 71
+108 25 67
+108 26 31
+108 27 21
+108 28 30
+108 29 56
+108 30 41
+108 31 29
+108 32 49
+108 33 41
+108 34 67
+108 35 20
+108 36 41
+108 37 71
+108 38 65
+108 39 65
+108 40 48
+108 41 48
+108 42 42
+108 43 26
+108 44 42
+108 45 31
+108 46 45
+108 47 37
+108 48 66
+108 49 30
+108 50 28
+108 51 14
+108 52 54
+108 53 36
+108 54 36
+108 55 27
+108 56 22
+108 57 49
+108 58 25
+108 59 37
+108 60 43
+108 61 60
+108 62 30
+108 63 19
+108 64 42
+108 65 31
+108 66 18
+108 67 33
+108 68 44
+108 69 36
+108 70 45
+108 71 15
+108 72 52
+108 73 15
+108 74 77
+108 75 43
+108 76 26
+108 77 53
+108 78 40
+108 79 54
+108 80 17
+108 81 32
+108 82 20
+108 83 15
+108 84 26
+108 86 57
+108 87 33
+108 88 38
+108 89 39
+108 90 36
+108 91 34
+108 92 31
+108 93 38
+108 94 54
+108 95 50
+108 96 14
+108 97 29
+108 98 35
+108 99 24
+108 100 31
+108 101 17
+108 102 49
+108 103 40
+108 104 22
+108 106 23
+108 107 33
+108 109 44
+108 110 27
+108 111 46
+108 112 24
+108 113 37
+108 114 20
+108 115 21
+108 116 70
+108 117 21
+108 118 30
+108 119 53
+108 120 21
+108 121 41
+108 122 33
+108 123 46
+108 124 61
+108 125 6
+108 126 27
+109 0 32
+109 1 47
+109 2 20
+109 3 52
+109 4 51
+109 5 39
+109 6 36
+109 7 42
+109 8 53
+109 9 56
+109 10 54
+109 11 22
+109 13 12
+109 14 14
+109 15 21
+109 16 50
+109 17 53
+109 18 34
+109 19 52
+109 20 80
+109 21 54
+109 22 13
+109 23 56
+109 24 52
+109 25 48
+109 26 55
+109 27 33
+109 28 54
+109 29 37
+109 30 49
+109 31 66
+109 32 25
+109 33 68
+109 34 48
+109 35 21
+109 36 17
+109 37 52
+109 38 46
+109 39 58
+109 40 42
+109 41 56
+109 42 54
+109 43 27
+109 44 23
+109 45 69
+109 46 49
+109 47 13
+109 48 47
+109 49 42
+109 50 35
+109 51 52
+109 52 35
+109 53 48
+109 54 66
+109 55 31
+109 56 37
+109 57 54
+109 58 19
+109 59 38
+109 60 13
+109 61 53
+109 62 37
+109 63 41
+109 64 29
+109 65 35
+109 66 30
+109 67 70
+109 68 5
+109 69 39
+109 70 46
+109 71 53
+109 72 33
+109 73 27
+109 74 58
+109 75 19
+109 76 27
+109 77 25
+109 78 36
+109 79 35
+109 80 54
+109 81 43
+109 82 67
+109 83 52
+109 84 33
+109 86 38
+109 87 63
+109 88 10
+109 89 46
+109 90 12
+109 91 30
+109 92 32
+109 93 50
+109 94 26
+109 95 60
+109 96 26
+109 97 23
+109 98 46
+109 99 39
+109 100 42
+109 101 29
+109 102 30
+109 103 16
+109 104 59
+109 106 24
+109 107 34
+109 108 47
+109 110 28
+109 111 55
+109 112 25
+109 113 48
+109 114 32
+109 115 56
+109 116 51
+109 117 24
+109 118 42
+109 119 34
+109 120 45
+109 121 52
+109 122 45
+109 123 53
+109 124 32
+109 125 53
+109 126 28
+110 0 18
+110 1 47
+110 2 29
+110 3 63
+110 4 58
+110 5 50
+110 6 22
+110 7 53
+110 8 37
+110 9 56
+110 10 45
+110 11 33
+110 13 23
+110 14 29
+110 15 32
+110 16 46
+110 17 37
+110 18 30
+110 19 47
+110 20 90
+110 21 46
+110 22 24
+110 23 50
+110 24 63
+110 25 59
+110 26 66
+110 27 19
+110 28 65
+110 29 48
+110 30 33
+110 31 66
+110 32 34
+110 33 78
+110 34 59
+110 35 17
+110 36 26
+110 37 63
+110 38 57
+110 39 63
+110 40 46
+110 41 48
+110 42 54
+110 43 11
+110 44 34
+110 45 80
+110 46 48
+110 47 22
+110 48 58
+110 49 22
+110 50 26
+110 51 62
+110 52 46
+110 53 48
+110 54 73
+110 55 42
+110 56 48
+110 57 49
+110 58 21
+110 59 28
+110 60 41
+110 61 56
+110 62 13
+110 63 52
+110 64 44
+110 65 49
+110 66 14
+110 67 70
+110 68 29
+110 69 39
+110 70 30
+110 71 57
+110 72 44
+110 73 13
+110 74 69
+110 75 28
+110 76 23
+110 77 36
+110 78 43
+110 79 46
+110 80 54
+110 81 35
+110 82 78
+110 83 52
+110 84 24
+110 86 49
+110 87 70
+110 88 21
+110 89 22
+110 90 21
+110 91 17
+110 92 14
+110 93 42
+110 94 37
+110 95 44
+110 96 12
+110 97 27
+110 98 38
+110 99 50
+110 100 42
+110 101 15
+110 102 41
+110 103 25
+110 104 59
+110 106 8
+110 107 16
+110 108 58
+110 109 29
+110 111 49
+110 112 9
+110 113 40
+110 114 16
+110 115 67
+110 116 62
+110 117 19
+110 118 42
+110 119 45
+110 120 56
+110 121 44
+110 122 45
+110 123 49
+110 124 46
+110 125 54
+110 126 12
+111 0 27
+111 1 22
+111 2 11
+111 3 64
+111 4 28
+111 5 51
+111 6 31
+111 7 54
+111 8 30
+111 9 26
+111 10 14
+111 11 34
+111 13 24
+111 14 11
+111 15 33
+111 16 28
+111 17 13
+111 18 21
+111 19 16
+111 20 60
+111 21 15
+111 22 25
+111 23 1
+111 24 64
+111 25 60
+111 26 38
+111 27 28
+111 28 42
+111 29 49
+111 30 19
+111 31 36
+111 32 37
+111 33 48
+111 34 60
+111 35 27
+111 36 29
+111 37 64
+111 38 58
+111 39 70
+111 40 54
+111 41 17
+111 42 24
+111 43 26
+111 44 35
+111 45 68
+111 46 23
+111 47 4
+111 48 59
+111 49 37
+111 50 22
+111 51 32
+111 52 47
+111 53 18
+111 54 43
+111 55 34
+111 56 36
+111 57 18
+111 58 29
+111 59 25
+111 60 23
+111 61 29
+111 62 28
+111 63 26
+111 64 26
+111 65 14
+111 66 25
+111 67 40
+111 68 11
+111 69 27
+111 70 45
+111 71 27
+111 72 45
+111 73 22
+111 74 70
+111 75 31
+111 76 14
+111 77 37
+111 78 28
+111 79 47
+111 80 24
+111 81 23
+111 82 58
+111 83 22
+111 84 33
+111 86 50
+111 87 40
+111 88 22
+111 89 37
+111 90 24
+111 91 32
+111 92 29
+111 93 5
+111 94 38
+111 95 26
+111 96 21
+111 97 35
+111 98 14
+111 99 38
+111 100 22
+111 101 24
+111 102 42
+111 103 7
+111 104 29
+111 106 23
+111 107 31
+111 108 38
+111 109 12
+111 110 15
+111 112 24
+111 113 24
+111 114 27
+111 115 55
+111 116 63
+111 117 28
+111 118 30
+111 119 46
+111 120 33
+111 121 26
+111 122 18
+111 123 32
+111 124 29
+111 125 24
+111 126 27
+112 0 9
+112 1 38
+112 2 20
+112 3 56
+112 4 49
+112 5 43
+112 6 13
+112 7 46
+112 8 28
+112 9 47
+112 10 36
+112 11 26
+112 13 16
+112 14 20
+112 15 25
+112 16 41
+112 17 28
+112 18 22
+112 19 38
+112 20 81
+112 21 37
+112 22 17
+112 23 41
+112 24 56
+112 25 52
+112 26 59
+112 27 10
+112 28 58
+112 29 41
+112 30 30
+112 31 57
+112 32 25
+112 33 69
+112 34 52
+112 35 9
+112 36 17
+112 37 56
+112 38 50
+112 39 54
+112 40 37
+112 41 39
+112 42 45
+112 43 2
+112 44 27
+112 45 73
+112 46 39
+112 47 13
+112 48 51
+112 49 19
+112 50 17
+112 51 53
+112 52 39
+112 53 39
+112 54 64
+112 55 35
+112 56 41
+112 57 40
+112 58 20
+112 59 26
+112 60 32
+112 61 47
+112 62 21
+112 63 45
+112 64 35
+112 65 40
+112 66 16
+112 67 61
+112 68 20
+112 69 30
+112 70 21
+112 71 48
+112 72 37
+112 73 4
+112 74 62
+112 75 19
+112 76 15
+112 77 29
+112 78 34
+112 79 39
+112 80 45
+112 81 26
+112 82 71
+112 83 43
+112 84 21
+112 86 42
+112 87 61
+112 88 14
+112 89 30
+112 90 12
+112 91 10
+112 92 7
+112 93 33
+112 94 30
+112 95 41
+112 96 12
+112 97 18
+112 98 29
+112 99 43
+112 100 33
+112 101 6
+112 102 34
+112 103 16
+112 104 50
+112 106 12
+112 107 9
+112 108 51
+112 109 20
+112 110 16
+112 111 40
+112 113 31
+112 114 15
+112 115 60
+112 116 55
+112 117 10
+112 118 33
+112 119 38
+112 120 49
+112 121 35
+112 122 36
+112 123 40
+112 124 37
+112 125 45
+112 126 3
+113 0 36
+113 1 20
+113 2 29
+113 3 82
+113 4 26
+113 5 69
+113 6 40
+113 7 72
+113 8 20
+113 9 24
+113 10 25
+113 11 52
+113 13 42
+113 14 29
+113 15 51
+113 16 15
+113 17 31
+113 18 34
+113 19 14
+113 20 58
+113 21 13
+113 22 43
+113 23 19
+113 24 82
+113 25 78
+113 26 36
+113 27 37
+113 28 40
+113 29 67
+113 30 10
+113 31 34
+113 32 44
+113 33 46
+113 34 78
+113 35 36
+113 36 29
+113 37 82
+113 38 76
+113 39 81
+113 40 64
+113 41 15
+113 42 22
+113 43 39
+113 44 53
+113 45 66
+113 46 13
+113 47 22
+113 48 77
+113 49 46
+113 50 35
+113 51 30
+113 52 65
+113 53 16
+113 54 41
+113 55 32
+113 56 34
+113 57 16
+113 58 40
+113 59 38
+113 60 34
+113 61 27
+113 62 41
+113 63 24
+113 64 44
+113 65 16
+113 66 34
+113 67 38
+113 68 22
+113 69 21
+113 70 45
+113 71 25
+113 72 63
+113 73 31
+113 74 88
+113 75 38
+113 76 27
+113 77 55
+113 78 25
+113 79 65
+113 80 22
+113 81 24
+113 82 56
+113 83 20
+113 84 42
+113 86 68
+113 87 38
+113 88 40
+113 89 50
+113 90 31
+113 91 39
+113 92 39
+113 93 23
+113 94 56
+113 95 13
+113 96 30
+113 97 45
+113 98 14
+113 99 36
+113 100 24
+113 101 33
+113 102 60
+113 103 25
+113 104 27
+113 106 36
+113 107 38
+113 108 36
+113 109 30
+113 110 28
+113 111 18
+113 112 37
+113 114 36
+113 115 53
+113 116 81
+113 117 37
+113 118 24
+113 119 64
+113 120 31
+113 121 4
+113 122 22
+113 123 27
+113 124 47
+113 125 22
+113 126 32
+114 0 18
+114 1 49
+114 2 31
+114 3 64
+114 4 60
+114 5 51
+114 6 19
+114 7 54
+114 8 39
+114 9 58
+114 10 47
+114 11 37
+114 13 27
+114 14 31
+114 15 33
+114 16 52
+114 17 39
+114 18 20
+114 19 49
+114 20 92
+114 21 48
+114 22 25
+114 23 52
+114 24 64
+114 25 60
+114 26 67
+114 27 19
+114 28 66
+114 29 49
+114 30 39
+114 31 68
+114 32 36
+114 33 80
+114 34 60
+114 35 7
+114 36 28
+114 37 64
+114 38 58
+114 39 63
+114 40 46
+114 41 50
+114 42 56
+114 43 13
+114 44 35
+114 45 81
+114 46 50
+114 47 24
+114 48 59
+114 49 28
+114 50 21
+114 51 64
+114 52 47
+114 53 50
+114 54 75
+114 55 43
+114 56 49
+114 57 51
+114 58 5
+114 59 24
+114 60 43
+114 61 58
+114 62 23
+114 63 53
+114 64 46
+114 65 51
+114 66 16
+114 67 72
+114 68 31
+114 69 41
+114 70 32
+114 71 59
+114 72 45
+114 73 13
+114 74 70
+114 75 30
+114 76 13
+114 77 40
+114 78 45
+114 79 47
+114 80 56
+114 81 37
+114 82 79
+114 83 54
+114 84 19
+114 86 50
+114 87 72
+114 88 25
+114 89 32
+114 90 23
+114 91 21
+114 92 18
+114 93 44
+114 94 41
+114 95 50
+114 96 12
+114 97 27
+114 98 40
+114 99 51
+114 100 44
+114 101 15
+114 102 42
+114 103 27
+114 104 61
+114 106 10
+114 107 20
+114 108 59
+114 109 31
+114 110 11
+114 111 51
+114 112 11
+114 113 42
+114 115 68
+114 116 63
+114 117 10
+114 118 44
+114 119 46
+114 120 57
+114 121 46
+114 122 47
+114 123 51
+114 124 48
+114 125 56
+114 126 14
+115 0 24
+115 1 53
+115 2 42
+115 3 72
+115 4 16
+115 5 59
+115 6 28
+115 7 62
+115 8 56
+115 9 31
+115 10 55
+115 11 54
+115 13 44
+115 14 48
+115 15 41
+115 16 58
+115 17 56
+115 18 37
+115 19 57
+115 20 46
+115 21 56
+115 22 42
+115 23 57
+115 24 72
+115 25 68
+115 26 36
+115 27 25
+115 28 20
+115 29 57
+115 30 45
+115 31 26
+115 32 53
+115 33 34
+115 34 68
+115 35 24
+115 36 45
+115 37 72
+115 38 66
+115 39 69
+115 40 52
+115 41 58
+115 42 60
+115 43 30
+115 44 43
+115 45 13
+115 46 63
+115 47 41
+115 48 67
+115 49 34
+115 50 32
+115 51 19
+115 52 55
+115 53 54
+115 54 31
+115 55 39
+115 56 8
+115 57 59
+115 58 30
+115 59 41
+115 60 40
+115 61 70
+115 62 36
+115 63 12
+115 64 39
+115 65 36
+115 66 31
+115 67 14
+115 68 48
+115 69 54
+115 70 49
+115 71 20
+115 72 53
+115 73 19
+115 74 78
+115 75 47
+115 76 30
+115 77 57
+115 78 58
+115 79 55
+115 80 33
+115 81 50
+115 82 38
+115 83 33
+115 84 36
+115 86 58
+115 87 28
+115 88 42
+115 89 45
+115 90 40
+115 91 38
+115 92 35
+115 93 56
+115 94 58
+115 95 56
+115 96 27
+115 97 33
+115 98 53
+115 99 10
+115 100 49
+115 101 21
+115 102 59
+115 103 44
+115 104 34
+115 106 27
+115 107 37
+115 108 18
+115 109 48
+115 110 31
+115 111 56
+115 112 28
+115 113 55
+115 114 25
+115 116 71
+115 117 25
+115 118 48
+115 119 54
+115 120 26
+115 121 59
+115 122 51
+115 123 54
+115 124 65
+115 125 24
+115 126 31
+116 0 48
+116 1 31
+116 2 32
+116 3 31
+116 4 42
+116 5 40
+116 6 52
+116 7 32
+116 8 27
+116 9 40
+116 10 29
+116 11 55
+116 13 45
+116 14 32
+116 15 54
+116 16 34
+116 17 30
+116 18 38
+116 19 31
+116 20 74
+116 21 30
+116 22 46
+116 23 22
+116 24 66
+116 25 49
+116 26 52
+116 27 49
+116 28 56
+116 29 38
+116 30 22
+116 31 50
+116 32 58
+116 33 62
+116 34 16
+116 35 41
+116 36 46
+116 37 30
+116 38 60
+116 39 26
+116 40 34
+116 41 32
+116 42 26
+116 43 43
+116 44 56
+116 45 82
+116 46 20
+116 47 25
+116 48 48
+116 49 54
+116 50 39
+116 51 46
+116 52 36
+116 53 32
+116 54 57
+116 55 48
+116 56 50
+116 57 33
+116 58 50
+116 59 42
+116 60 44
+116 61 31
+116 62 45
+116 63 40
+116 64 47
+116 65 10
+116 66 46
+116 67 54
+116 68 32
+116 69 23
+116 70 49
+116 71 41
+116 72 47
+116 73 43
+116 74 48
+116 75 52
+116 76 31
+116 77 58
+116 78 27
+116 79 49
+116 80 38
+116 81 19
+116 82 72
+116 83 36
+116 84 53
+116 86 39
+116 87 54
+116 88 43
+116 89 54
+116 90 45
+116 91 41
+116 92 46
+116 93 1
+116 94 39
+116 95 33
+116 96 42
+116 97 56
+116 98 10
+116 99 52
+116 100 18
+116 101 45
+116 102 63
+116 103 28
+116 104 43
+116 106 40
+116 107 40
+116 108 52
+116 109 33
+116 110 32
+116 111 21
+116 112 41
+116 113 24
+116 114 46
+116 115 69
+116 117 44
+116 118 26
+116 119 48
+116 120 47
+116 121 28
+116 122 29
+116 123 28
+116 124 50
+116 125 38
+116 126 34
+117 0 8
+117 1 45
+117 2 26
+117 3 59
+117 4 58
+117 5 46
+117 6 12
+117 7 49
+117 8 40
+117 9 59
+117 10 48
+117 11 38
+117 13 28
+117 14 32
+117 15 28
+117 16 42
+117 17 40
+117 18 21
+117 19 50
+117 20 87
+117 21 49
+117 22 20
+117 23 49
+117 24 59
+117 25 55
+117 26 62
+117 27 9
+117 28 61
+117 29 44
+117 30 29
+117 31 69
+117 32 37
+117 33 75
+117 34 55
+117 35 8
+117 36 29
+117 37 59
+117 38 53
+117 39 53
+117 40 36
+117 41 51
+117 42 57
+117 43 14
+117 44 30
+117 45 76
+117 46 51
+117 47 25
+117 48 54
+117 49 18
+117 50 16
+117 51 59
+117 52 42
+117 53 51
+117 54 73
+117 55 38
+117 56 44
+117 57 51
+117 58 13
+117 59 25
+117 60 39
+117 61 59
+117 62 18
+117 63 48
+117 64 47
+117 65 46
+117 66 6
+117 67 73
+117 68 32
+117 69 42
+117 70 33
+117 71 60
+117 72 40
+117 73 3
+117 74 65
+117 75 31
+117 76 14
+117 77 41
+117 78 43
+117 79 42
+117 80 57
+117 81 38
+117 82 74
+117 83 55
+117 84 14
+117 86 45
+117 87 70
+117 88 26
+117 89 27
+117 90 24
+117 91 22
+117 92 15
+117 93 45
+117 94 42
+117 95 40
+117 96 2
+117 97 17
+117 98 41
+117 99 46
+117 100 45
+117 101 5
+117 102 37
+117 103 28
+117 104 62
+117 106 11
+117 107 21
+117 108 54
+117 109 32
+117 110 15
+117 111 48
+117 112 12
+117 113 43
+117 114 8
+117 115 63
+117 116 58
+117 118 45
+117 119 41
+117 120 52
+117 121 47
+117 122 48
+117 123 46
+117 124 49
+117 125 57
+117 126 15
+118 0 26
+118 1 5
+118 2 27
+118 3 61
+118 4 16
+118 5 48
+118 6 30
+118 7 51
+118 8 22
+118 9 14
+118 10 15
+118 11 31
+118 13 21
+118 14 27
+118 15 30
+118 16 17
+118 17 15
+118 18 24
+118 19 17
+118 20 48
+118 21 16
+118 22 22
+118 23 17
+118 24 61
+118 25 57
+118 26 26
+118 27 27
+118 28 30
+118 29 46
+118 30 12
+118 31 24
+118 32 34
+118 33 36
+118 34 57
+118 35 15
+118 36 26
+118 37 61
+118 38 55
+118 39 67
+118 40 51
+118 41 18
+118 42 12
+118 43 21
+118 44 32
+118 45 56
+118 46 15
+118 47 20
+118 48 56
+118 49 36
+118 50 25
+118 51 20
+118 52 44
+118 53 6
+118 54 31
+118 55 22
+118 56 24
+118 57 19
+118 58 25
+118 59 28
+118 60 37
+118 61 30
+118 62 31
+118 63 14
+118 64 37
+118 65 14
+118 66 24
+118 67 28
+118 68 25
+118 69 6
+118 70 40
+118 71 15
+118 72 42
+118 73 21
+118 74 67
+118 75 28
+118 76 17
+118 77 34
+118 78 10
+118 79 44
+118 80 12
+118 81 2
+118 82 46
+118 83 10
+118 84 27
+118 86 47
+118 87 28
+118 88 19
+118 89 40
+118 90 21
+118 91 15
+118 92 26
+118 93 8
+118 94 35
+118 95 20
+118 96 20
+118 97 32
+118 98 5
+118 99 26
+118 100 1
+118 101 23
+118 102 39
+118 103 23
+118 104 17
+118 106 18
+118 107 14
+118 108 26
+118 109 28
+118 110 18
+118 111 16
+118 112 19
+118 113 7
+118 114 20
+118 115 43
+118 116 60
+118 117 18
+118 119 43
+118 120 21
+118 121 11
+118 122 3
+118 123 16
+118 124 45
+118 125 12
+118 126 8
+119 0 26
+119 1 47
+119 2 13
+119 3 18
+119 4 58
+119 5 5
+119 6 30
+119 7 8
+119 8 47
+119 9 56
+119 10 49
+119 11 31
+119 13 21
+119 14 13
+119 15 30
+119 16 50
+119 17 47
+119 18 28
+119 19 47
+119 20 89
+119 21 50
+119 22 22
+119 23 42
+119 24 18
+119 25 14
+119 26 64
+119 27 27
+119 28 63
+119 29 3
+119 30 42
+119 31 66
+119 32 34
+119 33 77
+119 34 14
+119 35 15
+119 36 26
+119 37 28
+119 38 12
+119 39 24
+119 40 19
+119 41 52
+119 42 46
+119 43 21
+119 44 32
+119 45 78
+119 46 40
+119 47 22
+119 48 13
+119 49 36
+119 50 29
+119 51 61
+119 52 4
+119 53 48
+119 54 73
+119 55 40
+119 56 46
+119 57 49
+119 58 25
+119 59 32
+119 60 25
+119 61 29
+119 62 31
+119 63 50
+119 64 28
+119 65 30
+119 66 24
+119 67 70
+119 68 13
+119 69 39
+119 70 40
+119 71 57
+119 72 15
+119 73 21
+119 74 24
+119 75 28
+119 76 21
+119 77 34
+119 78 43
+119 79 1
+119 80 54
+119 81 39
+119 82 76
+119 83 52
+119 84 27
+119 86 7
+119 87 70
+119 88 19
+119 89 40
+119 90 21
+119 91 15
+119 92 26
+119 93 21
+119 94 35
+119 95 53
+119 96 20
+119 97 32
+119 98 30
+119 99 48
+119 100 38
+119 101 23
+119 102 39
+119 103 9
+119 104 59
+119 106 18
+119 107 14
+119 108 56
+119 109 14
+119 110 22
+119 111 41
+119 112 19
+119 113 44
+119 114 20
+119 115 65
+119 116 20
+119 117 18
+119 118 42
+119 120 54
+119 121 48
+119 122 31
+119 123 41
+119 124 31
+119 125 54
+119 126 8
+120 0 24
+120 1 41
+120 2 35
+120 3 61
+120 4 18
+120 5 48
+120 6 28
+120 7 51
+120 8 43
+120 9 23
+120 10 43
+120 11 41
+120 13 31
+120 14 35
+120 15 30
+120 16 50
+120 17 43
+120 18 37
+120 19 45
+120 20 35
+120 21 44
+120 22 32
+120 23 45
+120 24 61
+120 25 57
+120 26 10
+120 27 25
+120 28 9
+120 29 46
+120 30 37
+120 31 28
+120 32 40
+120 33 23
+120 34 57
+120 35 24
+120 36 32
+120 37 61
+120 38 55
+120 39 67
+120 40 52
+120 41 46
+120 42 48
+120 43 17
+120 44 32
+120 45 36
+120 46 51
+120 47 28
+120 48 56
+120 49 26
+120 50 32
+120 51 7
+120 52 44
+120 53 42
+120 54 28
+120 55 31
+120 56 22
+120 57 47
+120 58 31
+120 59 41
+120 60 42
+120 61 58
+120 62 36
+120 63 8
+120 64 41
+120 65 24
+120 66 24
+120 67 33
+120 68 35
+120 69 42
+120 70 36
+120 71 8
+120 72 42
+120 73 19
+120 74 67
+120 75 34
+120 76 30
+120 77 44
+120 78 46
+120 79 44
+120 80 21
+120 81 38
+120 82 26
+120 83 21
+120 84 32
+120 86 47
+120 87 30
+120 88 29
+120 89 45
+120 90 27
+120 91 25
+120 92 13
+120 93 44
+120 94 45
+120 95 48
+120 96 20
+120 97 33
+120 98 41
+120 99 6
+120 100 37
+120 101 21
+120 102 49
+120 103 31
+120 104 15
+120 106 27
+120 107 24
+120 108 6
+120 109 35
+120 110 31
+120 111 44
+120 112 15
+120 113 43
+120 114 26
+120 115 23
+120 116 60
+120 117 25
+120 118 36
+120 119 43
+120 121 47
+120 122 39
+120 123 42
+120 124 52
+120 125 12
+120 126 18
+121 0 32
+121 1 16
+121 2 26
+121 3 79
+121 4 22
+121 5 66
+121 6 36
+121 7 69
+121 8 16
+121 9 20
+121 10 21
+121 11 49
+121 13 39
+121 14 26
+121 15 48
+121 16 19
+121 17 27
+121 18 30
+121 19 10
+121 20 54
+121 21 22
+121 22 40
+121 23 16
+121 24 79
+121 25 75
+121 26 32
+121 27 33
+121 28 36
+121 29 64
+121 30 6
+121 31 30
+121 32 40
+121 33 42
+121 34 75
+121 35 32
+121 36 25
+121 37 79
+121 38 73
+121 39 77
+121 40 60
+121 41 24
+121 42 18
+121 43 35
+121 44 50
+121 45 62
+121 46 9
+121 47 19
+121 48 74
+121 49 42
+121 50 31
+121 51 26
+121 52 62
+121 53 12
+121 54 37
+121 55 28
+121 56 30
+121 57 12
+121 58 36
+121 59 34
+121 60 30
+121 61 23
+121 62 37
+121 63 20
+121 64 41
+121 65 23
+121 66 30
+121 67 34
+121 68 18
+121 69 17
+121 70 41
+121 71 21
+121 72 60
+121 73 27
+121 74 85
+121 75 34
+121 76 23
+121 77 52
+121 78 21
+121 79 62
+121 80 18
+121 81 20
+121 82 52
+121 83 16
+121 84 38
+121 86 65
+121 87 34
+121 88 37
+121 89 46
+121 90 27
+121 91 35
+121 92 35
+121 93 20
+121 94 53
+121 95 17
+121 96 26
+121 97 41
+121 98 14
+121 99 32
+121 100 20
+121 101 29
+121 102 57
+121 103 22
+121 104 23
+121 106 32
+121 107 34
+121 108 32
+121 109 27
+121 110 24
+121 111 15
+121 112 33
+121 113 18
+121 114 32
+121 115 49
+121 116 78
+121 117 33
+121 118 20
+121 119 61
+121 120 27
+121 122 18
+121 123 23
+121 124 44
+121 125 18
+121 126 28
+122 0 38
+122 1 22
+122 2 32
+122 3 85
+122 4 28
+122 5 72
+122 6 42
+122 7 75
+122 8 31
+122 9 26
+122 10 29
+122 11 55
+122 13 45
+122 14 32
+122 15 54
+122 16 28
+122 17 33
+122 18 38
+122 19 16
+122 20 60
+122 21 30
+122 22 46
+122 23 22
+122 24 85
+122 25 81
+122 26 38
+122 27 39
+122 28 42
+122 29 70
+122 30 26
+122 31 36
+122 32 46
+122 33 48
+122 34 81
+122 35 38
+122 36 31
+122 37 85
+122 38 79
+122 39 83
+122 40 66
+122 41 32
+122 42 24
+122 43 43
+122 44 56
+122 45 68
+122 46 24
+122 47 25
+122 48 80
+122 49 48
+122 50 39
+122 51 32
+122 52 68
+122 53 18
+122 54 43
+122 55 34
+122 56 36
+122 57 18
+122 58 42
+122 59 42
+122 60 36
+122 61 29
+122 62 45
+122 63 26
+122 64 47
+122 65 14
+122 66 36
+122 67 40
+122 68 24
+122 69 27
+122 70 47
+122 71 27
+122 72 66
+122 73 33
+122 74 91
+122 75 40
+122 76 31
+122 77 58
+122 78 28
+122 79 68
+122 80 24
+122 81 23
+122 82 58
+122 83 22
+122 84 44
+122 86 71
+122 87 40
+122 88 43
+122 89 54
+122 90 33
+122 91 45
+122 92 41
+122 93 5
+122 94 59
+122 95 26
+122 96 32
+122 97 47
+122 98 14
+122 99 38
+122 100 22
+122 101 35
+122 102 63
+122 103 28
+122 104 29
+122 106 40
+122 107 44
+122 108 38
+122 109 33
+122 110 32
+122 111 21
+122 112 41
+122 113 24
+122 114 38
+122 115 55
+122 116 84
+122 117 39
+122 118 30
+122 119 67
+122 120 33
+122 121 28
+122 123 32
+122 124 50
+122 125 24
+122 126 38
+123 0 42
+123 1 24
+123 2 35
+123 3 80
+123 4 32
+123 5 67
+123 6 46
+123 7 70
+123 8 34
+123 9 30
+123 10 33
+123 11 50
+123 13 40
+123 14 35
+123 15 49
+123 16 27
+123 17 33
+123 18 42
+123 19 20
+123 20 64
+123 21 19
+123 22 41
+123 23 25
+123 24 80
+123 25 76
+123 26 42
+123 27 43
+123 28 46
+123 29 65
+123 30 26
+123 31 40
+123 32 50
+123 33 52
+123 34 76
+123 35 34
+123 36 35
+123 37 80
+123 38 74
+123 39 86
+123 40 70
+123 41 21
+123 42 28
+123 43 40
+123 44 51
+123 45 72
+123 46 27
+123 47 28
+123 48 75
+123 49 52
+123 50 43
+123 51 36
+123 52 63
+123 53 22
+123 54 47
+123 55 38
+123 56 40
+123 57 22
+123 58 44
+123 59 46
+123 60 40
+123 61 33
+123 62 49
+123 63 30
+123 64 50
+123 65 15
+123 66 40
+123 67 44
+123 68 28
+123 69 16
+123 70 51
+123 71 31
+123 72 61
+123 73 37
+123 74 86
+123 75 44
+123 76 35
+123 77 53
+123 78 20
+123 79 63
+123 80 28
+123 81 20
+123 82 62
+123 83 26
+123 84 46
+123 86 66
+123 87 44
+123 88 38
+123 89 58
+123 90 37
+123 91 34
+123 92 45
+123 93 27
+123 94 54
+123 95 30
+123 96 36
+123 97 51
+123 98 23
+123 99 42
+123 100 19
+123 101 39
+123 102 58
+123 103 31
+123 104 33
+123 106 37
+123 107 33
+123 108 42
+123 109 36
+123 110 36
+123 111 24
+123 112 38
+123 113 25
+123 114 39
+123 115 59
+123 116 79
+123 117 37
+123 118 19
+123 119 62
+123 120 37
+123 121 29
+123 122 22
+123 124 53
+123 125 28
+123 126 27
+124 0 29
+124 1 30
+124 2 19
+124 3 57
+124 4 36
+124 5 44
+124 6 33
+124 7 47
+124 8 38
+124 9 34
+124 10 22
+124 11 29
+124 13 19
+124 14 19
+124 15 28
+124 16 36
+124 17 23
+124 18 31
+124 19 24
+124 20 68
+124 21 23
+124 22 20
+124 23 24
+124 24 57
+124 25 53
+124 26 46
+124 27 30
+124 28 50
+124 29 42
+124 30 34
+124 31 44
+124 32 18
+124 33 56
+124 34 53
+124 35 28
+124 36 24
+124 37 57
+124 38 51
+124 39 63
+124 40 49
+124 41 25
+124 42 32
+124 43 22
+124 44 28
+124 45 76
+124 46 31
+124 47 12
+124 48 52
+124 49 33
+124 50 32
+124 51 40
+124 52 40
+124 53 26
+124 54 51
+124 55 38
+124 56 44
+124 57 26
+124 58 32
+124 59 35
+124 60 31
+124 61 37
+124 62 24
+124 63 34
+124 64 34
+124 65 3
+124 66 25
+124 67 48
+124 68 19
+124 69 37
+124 70 41
+124 71 35
+124 72 38
+124 73 24
+124 74 63
+124 75 12
+124 76 24
+124 77 32
+124 78 36
+124 79 40
+124 80 32
+124 81 41
+124 82 66
+124 83 30
+124 84 35
+124 86 43
+124 87 48
+124 88 17
+124 89 33
+124 90 19
+124 91 28
+124 92 25
+124 93 28
+124 94 33
+124 95 34
+124 96 23
+124 97 30
+124 98 28
+124 99 46
+124 100 40
+124 101 26
+124 102 37
+124 103 15
+124 104 37
+124 106 19
+124 107 27
+124 108 46
+124 109 20
+124 110 11
+124 111 23
+124 112 20
+124 113 32
+124 114 27
+124 115 63
+124 116 56
+124 117 30
+124 118 40
+124 119 39
+124 120 41
+124 121 34
+124 122 32
+124 123 21
+124 125 32
+124 126 23
+125 0 14
+125 1 51
+125 2 32
+125 3 65
+125 4 30
+125 5 52
+125 6 18
+125 7 55
+125 8 46
+125 9 45
+125 10 54
+125 11 44
+125 13 34
+125 14 38
+125 15 34
+125 16 48
+125 17 46
+125 18 27
+125 19 56
+125 20 60
+125 21 55
+125 22 26
+125 23 55
+125 24 65
+125 25 61
+125 26 45
+125 27 15
+125 28 34
+125 29 50
+125 30 35
+125 31 55
+125 32 43
+125 33 48
+125 34 61
+125 35 14
+125 36 35
+125 37 65
+125 38 59
+125 39 59
+125 40 42
+125 41 57
+125 42 63
+125 43 20
+125 44 36
+125 45 48
+125 46 57
+125 47 31
+125 48 60
+125 49 24
+125 50 22
+125 51 31
+125 52 48
+125 53 57
+125 54 45
+125 55 44
+125 56 16
+125 57 57
+125 58 19
+125 59 31
+125 60 45
+125 61 65
+125 62 24
+125 63 20
+125 64 53
+125 65 48
+125 66 12
+125 67 49
+125 68 38
+125 69 48
+125 70 39
+125 71 32
+125 72 46
+125 73 9
+125 74 71
+125 75 37
+125 76 20
+125 77 47
+125 78 49
+125 79 48
+125 80 43
+125 81 44
+125 82 46
+125 83 41
+125 84 20
+125 86 51
+125 87 42
+125 88 32
+125 89 33
+125 90 30
+125 91 28
+125 92 25
+125 93 51
+125 94 48
+125 95 46
+125 96 8
+125 97 23
+125 98 47
+125 99 18
+125 100 51
+125 101 11
+125 102 43
+125 103 34
+125 104 48
+125 106 17
+125 107 27
+125 108 26
+125 109 38
+125 110 21
+125 111 54
+125 112 18
+125 113 49
+125 114 14
+125 115 35
+125 116 64
+125 117 15
+125 118 51
+125 119 47
+125 120 35
+125 121 53
+125 122 54
+125 123 52
+125 124 55
+125 126 21
+126 0 18
+126 1 48
+126 2 21
+126 3 53
+126 4 52
+126 5 40
+126 6 22
+126 7 43
+126 8 39
+126 9 57
+126 10 47
+126 11 23
+126 13 13
+126 14 21
+126 15 22
+126 16 51
+126 17 39
+126 18 20
+126 19 49
+126 20 81
+126 21 48
+126 22 14
+126 23 52
+126 24 53
+126 25 49
+126 26 56
+126 27 19
+126 28 55
+126 29 38
+126 30 39
+126 31 67
+126 32 26
+126 33 69
+126 34 49
+126 35 7
+126 36 18
+126 37 53
+126 38 47
+126 39 59
+126 40 43
+126 41 50
+126 42 55
+126 43 13
+126 44 24
+126 45 70
+126 46 50
+126 47 14
+126 48 48
+126 49 28
+126 50 21
+126 51 53
+126 52 36
+126 53 49
+126 54 67
+126 55 32
+126 56 38
+126 57 51
+126 58 17
+126 59 24
+126 60 33
+126 61 54
+126 62 23
+126 63 42
+126 64 36
+126 65 41
+126 66 16
+126 67 71
+126 68 21
+126 69 40
+126 70 32
+126 71 54
+126 72 34
+126 73 13
+126 74 59
+126 75 20
+126 76 13
+126 77 26
+126 78 37
+126 79 36
+126 80 55
+126 81 37
+126 82 68
+126 83 53
+126 84 19
+126 86 39
+126 87 64
+126 88 11
+126 89 32
+126 90 13
+126 91 7
+126 92 18
+126 93 44
+126 94 27
+126 95 50
+126 96 12
+126 97 24
+126 98 40
+126 99 40
+126 100 43
+126 101 15
+126 102 31
+126 103 17
+126 104 60
+126 106 10
+126 107 6
+126 108 48
+126 109 21
+126 110 14
+126 111 51
+126 112 11
+126 113 42
+126 114 12
+126 115 57
+126 116 52
+126 117 10
+126 118 43
+126 119 35
+126 120 46
+126 121 46
+126 122 46
+126 123 51
+126 124 38
+126 125 54
@@ -0,0 +1,504 @@
+0 6 4
+0 117 1
+1 17 11
+1 30 7
+1 41 19
+1 111 11
+2 60 13
+2 96 10
+3 39 9
+3 40 7
+3 74 17
+4 87 12
+5 7 3
+5 48 8
+5 74 19
+5 103 4
+6 27 1
+6 89 17
+6 97 20
+6 106 19
+7 3 10
+7 34 6
+7 52 4
+8 81 20
+8 123 16
+9 4 12
+9 31 10
+9 55 8
+9 71 1
+9 83 10
+9 104 3
+9 120 15
+10 21 1
+10 23 7
+10 65 17
+10 76 2
+10 113 17
+10 121 12
+11 15 8
+11 60 13
+11 77 3
+11 90 18
+11 109 20
+11 112 8
+12 39 6
+12 79 10
+12 86 11
+13 22 1
+13 36 16
+13 94 14
+14 64 15
+14 109 1
+14 124 18
+15 44 2
+15 47 12
+15 55 10
+15 97 12
+16 10 14
+16 57 9
+16 65 4
+16 111 6
+17 10 8
+17 30 11
+17 61 19
+17 93 5
+17 122 18
+18 49 18
+18 50 1
+18 59 4
+18 101 20
+18 110 17
+19 1 6
+19 53 2
+19 57 2
+19 68 8
+19 98 4
+19 111 5
+19 122 11
+20 26 7
+20 43 1
+20 56 9
+20 80 14
+21 19 1
+21 41 2
+21 46 8
+21 65 3
+21 111 5
+22 15 8
+22 36 12
+22 88 14
+22 102 17
+23 47 3
+23 76 13
+23 93 4
+23 122 17
+24 101 10
+24 107 17
+25 5 2
+25 7 6
+26 92 3
+26 99 11
+26 104 5
+27 50 7
+27 58 16
+27 96 9
+27 97 8
+28 33 14
+28 54 19
+28 108 13
+29 5 2
+29 25 11
+29 52 1
+30 1 16
+30 81 14
+30 95 11
+30 123 17
+31 9 11
+31 51 13
+31 64 13
+31 67 5
+31 71 6
+31 83 17
+32 103 9
+32 124 12
+33 15 7
+33 20 12
+33 63 4
+33 67 15
+33 104 14
+34 37 14
+34 39 10
+34 40 18
+35 76 6
+35 84 12
+35 106 3
+35 117 3
+36 13 18
+36 75 15
+36 90 2
+37 3 1
+37 34 18
+37 61 1
+37 86 16
+38 24 6
+38 52 6
+39 7 6
+39 29 12
+39 94 13
+40 39 17
+41 19 14
+41 30 17
+41 57 17
+41 78 14
+42 122 15
+43 70 19
+43 73 2
+43 76 20
+43 92 5
+44 13 16
+44 22 4
+44 36 19
+44 72 10
+45 31 13
+46 8 7
+46 10 12
+46 21 15
+46 23 9
+46 113 20
+46 122 13
+47 14 9
+47 103 3
+48 3 9
+48 25 12
+48 29 14
+49 18 13
+49 27 17
+49 30 11
+49 43 9
+49 58 20
+50 22 10
+50 76 13
+50 96 12
+50 110 18
+50 112 5
+51 65 17
+51 71 1
+51 80 14
+51 108 20
+52 40 15
+52 72 11
+52 86 3
+52 116 16
+53 30 20
+53 42 6
+53 83 4
+53 122 6
+54 33 5
+54 51 4
+54 56 8
+54 99 16
+54 115 18
+54 125 16
+55 56 6
+55 120 14
+56 28 18
+56 99 2
+56 108 10
+57 1 8
+57 10 11
+57 36 13
+57 42 13
+57 61 11
+57 69 15
+57 78 10
+57 95 8
+57 113 6
+58 35 2
+58 62 19
+58 91 18
+58 126 9
+59 50 13
+59 117 10
+60 2 8
+60 58 6
+61 65 16
+61 69 10
+61 70 18
+61 98 19
+61 122 2
+61 123 12
+62 43 11
+62 49 9
+62 66 1
+62 73 10
+62 89 9
+62 92 1
+62 107 3
+62 112 12
+62 114 18
+62 117 16
+63 4 10
+64 15 7
+64 60 1
+64 90 12
+64 109 12
+65 10 19
+65 17 20
+65 111 20
+65 123 18
+66 0 20
+66 76 18
+66 114 2
+67 73 5
+67 108 20
+67 114 11
+68 14 9
+68 60 12
+69 16 11
+69 30 10
+69 78 4
+69 100 3
+69 118 3
+70 8 7
+70 17 7
+70 46 18
+70 55 15
+70 65 20
+70 81 5
+70 98 10
+71 51 10
+71 108 11
+71 120 6
+72 37 19
+72 52 2
+72 119 1
+73 0 5
+73 101 2
+74 59 13
+75 32 6
+75 44 16
+75 76 20
+75 88 5
+76 18 7
+76 110 1
+76 117 18
+77 11 20
+77 14 15
+77 60 15
+77 68 4
+77 103 11
+78 19 16
+78 21 18
+78 46 13
+78 69 3
+78 98 20
+79 34 20
+79 52 7
+80 4 4
+80 9 2
+80 26 14
+80 67 16
+80 71 12
+80 104 9
+81 16 17
+81 17 13
+81 69 4
+81 98 3
+81 100 11
+81 113 5
+81 118 14
+81 123 14
+82 45 11
+82 55 9
+82 67 20
+82 80 16
+82 115 1
+82 118 10
+82 120 8
+83 55 18
+83 63 4
+83 80 2
+83 125 2
+84 22 6
+84 27 9
+84 43 6
+84 62 4
+84 66 11
+84 89 15
+84 92 8
+84 96 1
+84 106 4
+84 114 2
+85 3 8
+85 5 7
+85 7 4
+85 29 3
+85 37 7
+85 74 6
+85 105 14
+85 119 2
+86 34 19
+86 126 1
+87 9 3
+87 51 1
+87 54 3
+87 80 7
+88 11 12
+88 13 2
+88 90 2
+88 97 13
+88 103 20
+89 50 12
+89 59 6
+89 66 9
+90 36 5
+90 47 1
+90 75 7
+90 103 14
+90 109 8
+91 13 13
+91 88 4
+91 97 17
+91 103 11
+92 6 16
+92 13 19
+92 49 13
+92 101 20
+92 112 2
+93 65 9
+93 98 9
+93 100 17
+94 14 19
+94 103 8
+95 10 12
+95 16 2
+95 41 18
+95 46 17
+95 53 13
+95 69 16
+95 98 1
+95 123 17
+96 66 4
+96 73 1
+96 84 12
+96 106 15
+97 2 9
+97 40 19
+97 47 13
+97 88 19
+97 91 7
+98 30 12
+98 42 16
+98 46 10
+98 93 20
+98 111 11
+99 51 13
+99 63 2
+99 108 15
+99 115 17
+99 120 17
+100 10 14
+100 69 16
+100 81 1
+101 27 4
+101 35 3
+101 43 14
+101 49 13
+101 62 15
+101 66 11
+102 2 12
+102 32 9
+102 44 19
+102 75 10
+102 78 6
+102 90 8
+102 94 6
+103 2 4
+103 14 4
+103 68 4
+104 4 3
+104 26 14
+104 31 13
+104 51 3
+104 56 7
+105 7 14
+105 39 2
+105 48 2
+105 72 8
+106 110 18
+106 112 1
+107 35 1
+107 76 15
+107 91 1
+107 114 6
+107 126 19
+108 51 14
+108 82 20
+108 83 15
+108 96 16
+108 125 6
+109 60 13
+109 68 5
+109 88 10
+110 62 13
+110 96 12
+110 106 8
+111 10 14
+111 17 13
+111 23 1
+111 30 19
+112 43 2
+112 90 12
+112 126 3
+113 21 13
+113 95 13
+113 121 4
+114 6 19
+114 58 5
+114 110 11
+115 4 16
+115 28 20
+115 45 13
+115 51 19
+115 56 8
+115 67 14
+116 34 16
+116 93 1
+117 76 14
+117 92 15
+117 96 2
+118 1 5
+118 53 6
+118 65 14
+118 100 1
+118 122 3
+118 126 8
+119 25 17
+119 29 3
+119 38 12
+119 72 17
+119 79 1
+120 26 10
+120 28 9
+120 51 7
+120 99 6
+120 108 6
+121 19 10
+121 30 6
+121 46 9
+121 69 17
+122 19 16
+122 93 5
+123 21 19
+123 65 15
+123 69 16
+124 47 12
+124 65 3
+124 75 12
+124 110 11
+125 56 16
+125 96 8
+125 99 19
+126 107 6
+126 117 14
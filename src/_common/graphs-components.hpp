@@ -0,0 +1,107 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+namespace utilz {
+namespace graphs {
+namespace components {
+
+// Finds strongly connected components of a graph with `vc` vertexes, where
+// `edge(v, w)` returns `true` if there is an edge from `v` to `w`.
+//
+// Returns a number of components and a component index of every vertex.
+// Components are indexed in topological order of the condensation graph,
+// i.e. there are no edges from a component to any of the preceding ones.
+//
+// The implementation is an iterative version of the Tarjan's algorithm (which
+// finds components in reverse topological order).
+//
+template<typename S, typename F>
+std::tuple<S, std::vector<S>>
+strongly_connected_components(
+  S vc,
+  F edge)
+{
+  const auto undefined = (std::numeric_limits<S>::max)();
+
+  std::vector<S> index(vc, undefined);
+  std::vector<S> lowlink(vc, undefined);
+  std::vector<S> cursor(vc, S(0));
+  std::vector<S> component(vc, undefined);
+
+  std::vector<bool> stacked(vc, false);
+
+  std::vector<S> stack;
+  std::vector<S> calls;
+
+  stack.reserve(vc);
+  calls.reserve(vc);
+
+  auto counter = S(0);
+  auto count   = S(0);
+
+  auto visit = [&](S v) -> void {
+    index[v]   = counter;
+    lowlink[v] = counter;
+
+    ++counter;
+
+    stack.push_back(v);
+    stacked[v] = true;
+
+    calls.push_back(v);
+  };
+
+  for (auto s = S(0); s < vc; ++s) {
+    if (index[s] != undefined)
+      continue;
+
+    visit(s);
+    while (!calls.empty()) {
+      const auto v = calls.back();
+      if (cursor[v] < vc) {
+        const auto w = cursor[v]++;
+        if (w == v || !edge(v, w))
+          continue;
+
+        if (index[w] == undefined)
+          visit(w);
+        else if (stacked[w])
+          lowlink[v] = (std::min)(lowlink[v], index[w]);
+
+        continue;
+      }
+
+      calls.pop_back();
+      if (!calls.empty())
+        lowlink[calls.back()] = (std::min)(lowlink[calls.back()], lowlink[v]);
+
+      if (lowlink[v] == index[v]) {
+        S w;
+        do {
+          w = stack.back();
+          stack.pop_back();
+
+          stacked[w]   = false;
+          component[w] = count;
+        } while (w != v);
+
+        ++count;
+      }
+    }
+  }
+
+  // Reverse the order of components to make it topological
+  //
+  for (auto& c : component)
+    c = count - S(1) - c;
+
+  return std::make_tuple(count, component);
+};
+
+} // namespace components
+} // namespace graphs
+} // namespace utilz
@@ -0,0 +1,320 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace utilz {
+namespace graphs {
+
+// ---
+// Forward declarations
+//
+
+template<typename I, typename W>
+class edges_container;
+
+//
+// Forward declarations
+// ---
+
+// Edges of a graph stored as structure of arrays. Vertexes are stored as 32-bit
+// integers while all of them fit, the container switches to `I` (once) when
+// the first vertex which doesn't fit is inserted.
+//
+// Iteration yields `std::tuple<I, I, W>` values, which makes the container
+// a drop-in replacement for a vector of tuples in read-only loops.
+//
+template<typename I, typename W>
+class edges_container
+{
+public:
+  using index_type  = I;
+  using weight_type = W;
+  using value_type  = std::tuple<I, I, W>;
+
+  class iterator
+  {
+  private:
+    const edges_container* m_edges;
+    size_t                 m_x;
+
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = std::tuple<I, I, W>;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = void;
+    using reference         = value_type;
+
+    iterator(const edges_container* edges, size_t x)
+      : m_edges(edges)
+      , m_x(x)
+    {
+    }
+
+    value_type
+    operator*() const
+    {
+      return this->m_edges->at(this->m_x);
+    };
+
+    iterator&
+    operator++()
+    {
+      ++this->m_x;
+      return *this;
+    };
+
+    iterator
+    operator++(int)
+    {
+      auto x = *this;
+      ++this->m_x;
+      return x;
+    };
+
+    bool
+    operator==(const iterator& o) const
+    {
+      return this->m_x == o.m_x;
+    };
+
+    bool
+    operator!=(const iterator& o) const
+    {
+      return this->m_x != o.m_x;
+    };
+  };
+
+private:
+  using narrow_type = std::uint32_t;
+
+  bool m_narrow;
+
+  std::vector<narrow_type> m_narrow_from;
+  std::vector<narrow_type> m_narrow_to;
+  std::vector<I>           m_wide_from;
+  std::vector<I>           m_wide_to;
+  std::vector<W>           m_weights;
+
+  static bool
+  fits(I v) noexcept
+  {
+    using unsigned_type = std::make_unsigned_t<I>;
+    return static_cast<unsigned_type>(v) <= static_cast<unsigned_type>((std::numeric_limits<narrow_type>::max)());
+  };
+
+  void
+  widen()
+  {
+    this->m_wide_from.assign(this->m_narrow_from.begin(), this->m_narrow_from.end());
+    this->m_wide_to.assign(this->m_narrow_to.begin(), this->m_narrow_to.end());
+
+    this->m_wide_from.reserve(this->m_weights.capacity());
+    this->m_wide_to.reserve(this->m_weights.capacity());
+
+    this->m_narrow_from = std::vector<narrow_type>();
+    this->m_narrow_to   = std::vector<narrow_type>();
+
+    this->m_narrow = false;
+  };
+
+public:
+  edges_container()
+    : m_narrow(sizeof(I) > sizeof(narrow_type))
+  {
+  }
+
+  // Returns `true` if vertexes are stored as 32-bit integers
+  //
+  bool
+  narrow() const noexcept
+  {
+    return this->m_narrow;
+  };
+
+  size_t
+  size() const noexcept
+  {
+    return this->m_weights.size();
+  };
+
+  bool
+  empty() const noexcept
+  {
+    return this->m_weights.empty();
+  };
+
+  void
+  reserve(size_t count)
+  {
+    if (this->m_narrow) {
+      this->m_narrow_from.reserve(count);
+      this->m_narrow_to.reserve(count);
+    } else {
+      this->m_wide_from.reserve(count);
+      this->m_wide_to.reserve(count);
+    }
+    this->m_weights.reserve(count);
+  };
+
+  void
+  push_back(I f, I t, W w)
+  {
+    if (this->m_narrow && !(fits(f) && fits(t)))
+      this->widen();
+
+    if (this->m_narrow) {
+      this->m_narrow_from.push_back(narrow_type(f));
+      this->m_narrow_to.push_back(narrow_type(t));
+    } else {
+      this->m_wide_from.push_back(f);
+      this->m_wide_to.push_back(t);
+    }
+    this->m_weights.push_back(w);
+  };
+
+  void
+  push_back(const std::tuple<I, I, W>& edge)
+  {
+    this->push_back(std::get<0>(edge), std::get<1>(edge), std::get<2>(edge));
+  };
+
+  I
+  from(size_t x) const noexcept
+  {
+    return this->m_narrow ? I(this->m_narrow_from[x]) : this->m_wide_from[x];
+  };
+
+  I
+  to(size_t x) const noexcept
+  {
+    return this->m_narrow ? I(this->m_narrow_to[x]) : this->m_wide_to[x];
+  };
+
+  W
+  weight(size_t x) const noexcept
+  {
+    return this->m_weights[x];
+  };
+
+  std::tuple<I, I, W>
+  at(size_t x) const noexcept
+  {
+    return std::make_tuple(this->from(x), this->to(x), this->weight(x));
+  };
+
+  // Replaces vertexes of `x` edge. The new vertexes have to fit into the
+  // storage (i.e. it can be used to relabel vertexes into a smaller range)
+  //
+  void
+  set(size_t x, I f, I t) noexcept
+  {
+    if (this->m_narrow) {
+      this->m_narrow_from[x] = narrow_type(f);
+      this->m_narrow_to[x]   = narrow_type(t);
+    } else {
+      this->m_wide_from[x] = f;
+      this->m_wide_to[x]   = t;
+    }
+  };
+
+  // Resizes the container to `count` edges, which are stored as 32-bit
+  // vertexes if `narrow` is `true` (the edges are expected to be filled with
+  // `assign`, i.e. from several threads)
+  //
+  void
+  resize(size_t count, bool narrow)
+  {
+    this->m_narrow = narrow && sizeof(I) > sizeof(narrow_type);
+    if (this->m_narrow) {
+      this->m_wide_from = std::vector<I>();
+      this->m_wide_to   = std::vector<I>();
+
+      this->m_narrow_from.resize(count);
+      this->m_narrow_to.resize(count);
+    } else {
+      this->m_narrow_from = std::vector<narrow_type>();
+      this->m_narrow_to   = std::vector<narrow_type>();
+
+      this->m_wide_from.resize(count);
+      this->m_wide_to.resize(count);
+    }
+    this->m_weights.resize(count);
+  };
+
+  // Copies all of `edges` into the container starting from `x` edge. The
+  // container has to be wide if `edges` is wide
+  //
+  void
+  assign(size_t x, const edges_container& edges)
+  {
+    if (this->m_narrow) {
+      std::copy(edges.m_narrow_from.begin(), edges.m_narrow_from.end(), this->m_narrow_from.begin() + x);
+      std::copy(edges.m_narrow_to.begin(), edges.m_narrow_to.end(), this->m_narrow_to.begin() + x);
+    } else if (edges.m_narrow) {
+      std::copy(edges.m_narrow_from.begin(), edges.m_narrow_from.end(), this->m_wide_from.begin() + x);
+      std::copy(edges.m_narrow_to.begin(), edges.m_narrow_to.end(), this->m_wide_to.begin() + x);
+    } else {
+      std::copy(edges.m_wide_from.begin(), edges.m_wide_from.end(), this->m_wide_from.begin() + x);
+      std::copy(edges.m_wide_to.begin(), edges.m_wide_to.end(), this->m_wide_to.begin() + x);
+    }
+    std::copy(edges.m_weights.begin(), edges.m_weights.end(), this->m_weights.begin() + x);
+  };
+
+  // Switches the storage back to 32-bit vertexes (if all of them fit)
+  //
+  void
+  shrink_to_fit()
+  {
+    if (this->m_narrow || sizeof(I) <= sizeof(narrow_type))
+      return;
+
+    for (auto x = size_t(0); x < this->size(); ++x)
+      if (!(fits(this->m_wide_from[x]) && fits(this->m_wide_to[x])))
+        return;
+
+    this->m_narrow_from.assign(this->m_wide_from.begin(), this->m_wide_from.end());
+    this->m_narrow_to.assign(this->m_wide_to.begin(), this->m_wide_to.end());
+
+    this->m_wide_from = std::vector<I>();
+    this->m_wide_to   = std::vector<I>();
+
+    this->m_narrow = true;
+  };
+
+  // Calls `fn(f, t, w)` for every edge, the storage is dispatched only once
+  //
+  template<typename F>
+  void
+  for_each(F fn) const
+  {
+    const auto count = this->size();
+    if (this->m_narrow) {
+      for (auto x = size_t(0); x < count; ++x)
+        fn(I(this->m_narrow_from[x]), I(this->m_narrow_to[x]), this->m_weights[x]);
+    } else {
+      for (auto x = size_t(0); x < count; ++x)
+        fn(this->m_wide_from[x], this->m_wide_to[x], this->m_weights[x]);
+    }
+  };
+
+  iterator
+  begin() const
+  {
+    return iterator(this, size_t(0));
+  };
+
+  iterator
+  end() const
+  {
+    return iterator(this, this->size());
+  };
+};
+
+} // namespace graphs
+} // namespace utilz
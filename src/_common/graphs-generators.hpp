@@ -29,6 +29,10 @@ struct complete_graph_tag
 {
 };
 
+struct community_graph_tag
+{
+};
+
 utilz::matrices::square_matrix<bool>
 random_graph(
   typename utilz::matrices::traits::matrix_traits<utilz::matrices::square_matrix<bool>>::size_type v,
@@ -273,6 +277,138 @@ random_graph(
   return std::move(adjacency_matrix);
 };
 
+// Generates a random weakly connected graph with `v` vertexes and `e` edges
+// split into `c` communities, where vertex `i` belongs to community `i % c`.
+// Most of the edges (`intra_percent`) are placed inside of the communities
+// and the rest connect random vertexes of different communities.
+//
+// The generator is seeded explicitly to make it possible to produce the
+// same graph in different processes (i.e. to compare different algorithms).
+//
+utilz::matrices::square_matrix<bool>
+random_graph(
+  typename utilz::matrices::traits::matrix_traits<utilz::matrices::square_matrix<bool>>::size_type v,
+  typename utilz::matrices::traits::matrix_traits<utilz::matrices::square_matrix<bool>>::size_type e,
+  typename utilz::matrices::traits::matrix_traits<utilz::matrices::square_matrix<bool>>::size_type c,
+  std::mt19937_64::result_type                                                                      seed,
+  community_graph_tag,
+  int                                                                                               intra_percent = 90)
+{
+  using size_type  = typename utilz::matrices::traits::matrix_traits<utilz::matrices::square_matrix<bool>>::size_type;
+
+  static_assert(std::is_unsigned<size_type>::value, "erro: matrix `set_size` operation has to use unsigned integral type");
+
+  if (c <= 0 || c > v)
+    throw std::logic_error(
+      "erro: community count can't be zero or exceed vertex count.");
+
+  if (e < v - size_type(1))
+    throw std::logic_error(
+      "erro: edge count in community graph can't be less than: `(v - 1)`, where `v` is a vertex count.");
+
+  if (e >= (v * (v - size_type(1))))
+    throw std::logic_error(
+      "erro: edge count in community graph can't exceed: `((v) * (v - 1))`, where `v` is a vertex count.");
+
+  if (intra_percent < 0 || intra_percent > 100)
+    throw std::logic_error(
+      "erro: percent of edges inside of the communities has to be in range [0, 100].");
+
+  // Initialise vertex and community distributions, community members
+  // are addressed by local index, i.e. vertex `k * c + q` is a member `k`
+  // of community `q`
+  //
+  std::mt19937_64                          distribution_engine(seed);
+  std::uniform_int_distribution<size_type> distribution(size_type(0), v - size_type(1));
+  std::uniform_int_distribution<size_type> community_distribution(size_type(0), c - size_type(1));
+  std::uniform_int_distribution<int>       percent_distribution(0, 99);
+
+  auto community_size = [v, c](size_type q) -> size_type {
+    return v / c + (q < v % c ? size_type(1) : size_type(0));
+  };
+
+  // Initialise adjacency matrix
+  //
+  utilz::matrices::square_matrix<bool> adjacency_matrix(v);
+
+  // Connect all vertexes inside of the communities (each member is connected
+  // to some random previous member) and then connect communities in a chain
+  //
+  for (auto i = c; i < v; ++i) {
+    auto j = (distribution(distribution_engine) % (i / c)) * c + i % c;
+
+    adjacency_matrix.at(i, j) = true;
+  }
+  for (auto q = size_type(1); q < c; ++q)
+    adjacency_matrix.at(q, q - size_type(1)) = true;
+
+  // Pick two random vertexes (either from the same community or from the
+  // whole graph) and create an edge between them. Repeat until required number
+  // of edges.
+  //
+  for (auto i = size_type(0), j = size_type(0), cnt = v - size_type(1), a = size_type(0), z = size_type(0); cnt < e;) {
+    if (percent_distribution(distribution_engine) < intra_percent) {
+      auto q = community_distribution(distribution_engine);
+      auto s = community_size(q);
+
+      i = (distribution(distribution_engine) % s) * c + q;
+      j = (distribution(distribution_engine) % s) * c + q;
+    } else {
+      i = distribution(distribution_engine);
+      j = distribution(distribution_engine);
+    }
+
+    // Don't create self-cycles
+    //
+    if (i == j)
+      continue;
+
+    if (!adjacency_matrix.at(i, j)) {
+      adjacency_matrix.at(i, j) = true;
+    } else if (a != e) {
+      ++a;
+      continue;
+    } else {
+      // If output has i -> j edge and we have tried to much to create
+      // an edge (i.e. number of failed attempts is equal to required number of edges)
+      // we simply perform a direct search to insert an edge
+      //
+      bool found = false;
+      while (z < v && !found) {
+        for (auto _j = size_type(0); _j < v && !found; ++_j) {
+          // Ensure we aren't creating self-cycles
+          //
+          if (z == _j)
+            continue;
+
+          if (!adjacency_matrix.at(z, _j)) {
+            adjacency_matrix.at(z, _j) = true;
+
+            found = true;
+          }
+        }
+
+        // Rows without free slots are never visited again
+        //
+        if (!found)
+          ++z;
+      }
+
+      a = size_type(0);
+
+      if (!found)
+        throw std::logic_error(
+          "erro: unable to create a edge between two vertexes without breaking the constrains, blame random or relax the parameters");
+    }
+
+    // Indicate that we have created an edge between `i` -> `j`
+    //
+    ++cnt;
+  };
+
+  return adjacency_matrix;
+};
+
 } // namespace generators
 } // namespace graphs
 } // namespace utilz
@@ -0,0 +1,323 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <istream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "graphs-edges.hpp"
+#include "graphs-io.hpp"
+
+namespace utilz {
+namespace graphs {
+namespace io {
+
+// ---
+// Forward declarations
+//
+
+namespace impl {
+
+template<typename T>
+class bounded_queue;
+
+} // namespace impl
+
+//
+// Forward declarations
+// ---
+
+namespace impl {
+
+// A queue of limited capacity, which blocks producers while it is full and
+// consumers while it is empty (until it is closed)
+//
+template<typename T>
+class bounded_queue
+{
+private:
+  std::deque<T>           m_items;
+  size_t                  m_capacity;
+  std::mutex              m_mutex;
+  std::condition_variable m_not_empty;
+  std::condition_variable m_not_full;
+  bool                    m_closed;
+
+public:
+  explicit bounded_queue(size_t capacity)
+    : m_capacity(capacity)
+    , m_closed(false)
+  {
+  }
+
+  void
+  push(T item)
+  {
+    {
+      std::unique_lock<std::mutex> lock(this->m_mutex);
+
+      this->m_not_full.wait(lock, [this] { return this->m_items.size() < this->m_capacity; });
+      this->m_items.push_back(std::move(item));
+    }
+    this->m_not_empty.notify_one();
+  };
+
+  // Returns `false` if the queue is closed and there are no more items
+  //
+  bool
+  pop(T& item)
+  {
+    {
+      std::unique_lock<std::mutex> lock(this->m_mutex);
+
+      this->m_not_empty.wait(lock, [this] { return this->m_closed || !this->m_items.empty(); });
+      if (this->m_items.empty())
+        return false;
+
+      item = std::move(this->m_items.front());
+      this->m_items.pop_front();
+    }
+    this->m_not_full.notify_one();
+    return true;
+  };
+
+  void
+  close()
+  {
+    {
+      std::lock_guard<std::mutex> lock(this->m_mutex);
+      this->m_closed = true;
+    }
+    this->m_not_empty.notify_all();
+  };
+};
+
+// Edges of chunks are moved into the result, which is sized once (see
+// `scan_graph_pipelined`). The result has to be wide if any of the chunks is
+// wide (`edges_container` only)
+//
+template<typename I, typename W>
+bool
+narrow_edges(const std::vector<std::tuple<I, I, W>>& edges)
+{
+  return false;
+};
+
+template<typename I, typename W>
+bool
+narrow_edges(const edges_container<I, W>& edges)
+{
+  return edges.narrow();
+};
+
+template<typename I, typename W>
+void
+resize_edges(std::vector<std::tuple<I, I, W>>& edges, size_t count, bool narrow)
+{
+  edges.resize(count);
+};
+
+template<typename I, typename W>
+void
+resize_edges(edges_container<I, W>& edges, size_t count, bool narrow)
+{
+  edges.resize(count, narrow);
+};
+
+template<typename I, typename W>
+void
+move_edges(std::vector<std::tuple<I, I, W>>& edges, size_t x, std::vector<std::tuple<I, I, W>>& chunk)
+{
+  std::move(chunk.begin(), chunk.end(), edges.begin() + x);
+};
+
+template<typename I, typename W>
+void
+move_edges(edges_container<I, W>& edges, size_t x, edges_container<I, W>& chunk)
+{
+  edges.assign(x, chunk);
+};
+
+template<graph_format F, typename I, typename W, typename E>
+std::tuple<I, E>
+scan_graph_pipelined(
+  std::istream& is,
+  size_t        threads,
+  size_t        chunk_size)
+{
+  struct result
+  {
+    E                  edges;
+    I                  vmax  = I(0);
+    std::exception_ptr error = nullptr;
+  };
+
+  struct chunk
+  {
+    std::string text;
+    result*     target = nullptr;
+  };
+
+  // The preamble (if the format has one) is scanned by the calling thread
+  // before the edges
+  //
+  auto [expected_vc, expected_ec] = scan_graph_preamble<F, I>(is);
+
+  // Results are stored in the order of chunks, `std::deque` doesn't invalidate
+  // references to its elements on `emplace_back`, which allows workers to fill
+  // results while new chunks are being read
+  //
+  std::deque<result>   results;
+  bounded_queue<chunk> queue(threads * size_t(2));
+
+  std::vector<std::thread> workers;
+  for (auto t = size_t(0); t < threads; ++t)
+    workers.emplace_back([&queue]() -> void {
+      chunk c;
+      while (queue.pop(c)) {
+        try {
+          std::istringstream cs(std::move(c.text));
+
+          io::graph_edge<F, I, W> edge;
+          while (cs >> edge) {
+            c.target->edges.push_back(std::make_tuple(edge.from(), edge.to(), edge.weight()));
+
+            c.target->vmax = std::max({ c.target->vmax, edge.from(), edge.to() });
+          }
+
+          if (!cs.eof())
+            throw std::logic_error("erro: can't scan 'graph_edge' because of invalid format or IO problem");
+        } catch (...) {
+          c.target->error = std::current_exception();
+        }
+      }
+    });
+
+  // Read the stream in chunks of complete lines (a partial line at the end of
+  // a chunk is carried over to the next one)
+  //
+  std::string carry;
+  std::string buffer(chunk_size, '\0');
+
+  auto push = [&queue, &results](std::string text) -> void {
+    results.emplace_back();
+
+    chunk c;
+    c.text   = std::move(text);
+    c.target = &results.back();
+
+    queue.push(std::move(c));
+  };
+
+  while (is) {
+    is.read(buffer.data(), std::streamsize(buffer.size()));
+    carry.append(buffer.data(), size_t(is.gcount()));
+
+    auto last = carry.rfind('\n');
+    if (last == std::string::npos)
+      continue;
+
+    std::string rest = carry.substr(last + 1);
+
+    carry.resize(last + 1);
+    push(std::move(carry));
+
+    carry = std::move(rest);
+  }
+  if (!carry.empty())
+    push(std::move(carry));
+
+  queue.close();
+  for (auto& worker : workers)
+    worker.join();
+
+  if (!is.eof())
+    throw std::logic_error("erro: can't scan 'graph_edge' because of invalid format or IO problem");
+
+  // The result is sized once from the numbers of edges of chunks, then every
+  // chunk is moved into its place in parallel and released right after
+  //
+  std::vector<size_t> offsets;
+  offsets.reserve(results.size());
+
+  auto total  = size_t(0);
+  auto vmax   = I(0);
+  auto narrow = true;
+  for (auto& r : results) {
+    if (r.error)
+      std::rethrow_exception(r.error);
+
+    offsets.push_back(total);
+
+    total += r.edges.size();
+    vmax   = std::max(vmax, r.vmax);
+    narrow = narrow && narrow_edges(r.edges);
+  }
+
+  const auto vc = check_graph_counts(expected_vc, expected_ec, vmax + I(1), total);
+
+  if (results.size() == size_t(1))
+    return std::make_tuple(vc, std::move(results.front().edges));
+
+  E edges;
+  resize_edges(edges, total, narrow);
+
+  const auto count = results.size();
+
+  std::vector<std::thread> movers;
+  for (auto t = size_t(0); t < (std::min)(threads, count); ++t)
+    movers.emplace_back([&edges, &results, &offsets, t, threads, count]() -> void {
+      for (auto x = t; x < count; x += threads) {
+        move_edges(edges, offsets[x], results[x].edges);
+
+        results[x].edges = E();
+      }
+    });
+
+  for (auto& mover : movers)
+    mover.join();
+
+  return std::make_tuple(vc, std::move(edges));
+};
+
+} // namespace impl
+
+// Scans a graph using a pipeline: the calling thread reads the stream in
+// chunks of complete lines, while `threads` workers parse them in parallel
+// (edges keep the order in which they appear in the stream). The binary
+// format isn't line based and it is always scanned by the calling thread.
+//
+template<typename I, typename W, typename E = std::vector<std::tuple<I, I, W>>>
+std::tuple<I, E>
+scan_graph_pipelined(
+  graph_format  format,
+  std::istream& is,
+  size_t        threads    = size_t(0),
+  size_t        chunk_size = size_t(4) * size_t(1024) * size_t(1024))
+{
+  if (threads == size_t(0))
+    threads = (std::max)(size_t(1), size_t(std::thread::hardware_concurrency()));
+
+  switch (format) {
+    case graph_format::graph_fmt_edgelist:
+      return impl::scan_graph_pipelined<graph_format::graph_fmt_edgelist, I, W, E>(is, threads, chunk_size);
+    case graph_format::graph_fmt_weightlist:
+      return impl::scan_graph_pipelined<graph_format::graph_fmt_weightlist, I, W, E>(is, threads, chunk_size);
+    case graph_format::graph_fmt_dimacs:
+      return impl::scan_graph_pipelined<graph_format::graph_fmt_dimacs, I, W, E>(is, threads, chunk_size);
+    default:
+      return scan_graph<I, W, E>(format, is);
+  }
+};
+
+} // namespace io
+} // namespace graphs
+} // namespace utilz
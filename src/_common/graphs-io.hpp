@@ -1,10 +1,12 @@
 #pragma once
 
+#include <cctype>
 #include <functional>
 #include <istream>
 #include <memory>
 #include <ostream>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
 #include <algorithm>
 
@@ -149,121 +151,121 @@ class graph_preamble;
 template<typename TIndex, typename TWeight>
 class graph_edge;
 
-template<graph_format F, typename I, typename W>
-std::tuple<I, std::vector<std::tuple<I, I, W>>>
+template<graph_format F, typename I, typename W, typename E = std::vector<std::tuple<I, I, W>>>
+std::tuple<I, E>
 scan_graph_edges(
   std::istream& is,
   I expected_vc,
   I expected_ec);
 
-template<graph_format F, typename I, typename W>
-std::tuple<I, std::vector<std::tuple<I, I, W>>>
+template<graph_format F, typename I, typename W, typename E = std::vector<std::tuple<I, I, W>>>
+std::tuple<I, E>
 scan_graph(
   std::istream& is,
   std::integral_constant<graph_preamble_format, graph_preamble_format::graph_preamble_fmt_none>);
 
-template<graph_format F, typename I, typename W>
-std::tuple<I, std::vector<std::tuple<I, I, W>>>
+template<graph_format F, typename I, typename W, typename E = std::vector<std::tuple<I, I, W>>>
+std::tuple<I, E>
 scan_graph(
   std::istream& is,
   std::integral_constant<graph_preamble_format, graph_preamble_format::graph_preamble_fmt_vertex_count>);
 
-template<graph_format F, typename I, typename W>
-std::tuple<I, std::vector<std::tuple<I, I, W>>>
+template<graph_format F, typename I, typename W, typename E = std::vector<std::tuple<I, I, W>>>
+std::tuple<I, E>
 scan_graph(
   std::istream& is,
   std::integral_constant<graph_preamble_format, graph_preamble_format::graph_preamble_fmt_edge_count>);
 
-template<graph_format F, typename I, typename W>
-std::tuple<I, std::vector<std::tuple<I, I, W>>>
+template<graph_format F, typename I, typename W, typename E = std::vector<std::tuple<I, I, W>>>
+std::tuple<I, E>
 scan_graph(
   std::istream& is,
   std::integral_constant<graph_preamble_format, graph_preamble_format::graph_preamble_fmt_full>);
 
-template<graph_format F, typename I, typename W>
-std::tuple<I, std::vector<std::tuple<I, I, W>>>
+template<graph_format F, typename I, typename W, typename E = std::vector<std::tuple<I, I, W>>>
+std::tuple<I, E>
 scan_graph(
   std::istream& is);
 
-template<graph_format F, typename I, typename W>
+template<graph_format F, typename I, typename W, typename E>
 void
 print_graph_edges(
-  std::ostream&                     os,
-  I                                 vc,
-  std::vector<std::tuple<I, I, W>>& edges);
+  std::ostream& os,
+  I             vc,
+  E&            edges);
 
-template<graph_format F, typename I, typename W>
+template<graph_format F, typename I, typename W, typename E>
 void
 print_graph(
-  std::ostream&                     os,
-  std::vector<std::tuple<I, I, W>>& edges,
+  std::ostream& os,
+  E&            edges,
   std::integral_constant<graph_preamble_format, graph_preamble_format::graph_preamble_fmt_full>);
 
-template<graph_format F, typename I, typename W>
+template<graph_format F, typename I, typename W, typename E>
 void
 print_graph(
-  std::ostream&                     os,
-  std::vector<std::tuple<I, I, W>>& edges,
+  std::ostream& os,
+  E&            edges,
   std::integral_constant<graph_preamble_format, graph_preamble_format::graph_preamble_fmt_vertex_count>);
 
-template<graph_format F, typename I, typename W>
+template<graph_format F, typename I, typename W, typename E>
 void
 print_graph(
-  std::ostream&                     os,
-  std::vector<std::tuple<I, I, W>>& edges,
+  std::ostream& os,
+  E&            edges,
   std::integral_constant<graph_preamble_format, graph_preamble_format::graph_preamble_fmt_edge_count>);
 
-template<graph_format F, typename I, typename W>
+template<graph_format F, typename I, typename W, typename E>
 void
 print_graph(
-  std::ostream&                     os,
-  std::vector<std::tuple<I, I, W>>& edges,
+  std::ostream& os,
+  E&            edges,
   std::integral_constant<graph_preamble_format, graph_preamble_format::graph_preamble_fmt_none>);
 
-template<graph_format F, typename I, typename W>
+template<graph_format F, typename I, typename W, typename E>
 void
 print_graph(
-  std::ostream&                     os,
-  std::vector<std::tuple<I, I, W>>& edges);
+  std::ostream& os,
+  E&            edges);
 
-template<graph_format F, typename I, typename W>
+template<graph_format F, typename I, typename W, typename E>
 void
 print_graph(
-  std::ostream&                     os,
-  I                                 vc,
-  std::vector<std::tuple<I, I, W>>& edges,
+  std::ostream& os,
+  I             vc,
+  E&            edges,
   std::integral_constant<graph_preamble_format, graph_preamble_format::graph_preamble_fmt_full>);
 
-template<graph_format F, typename I, typename W>
+template<graph_format F, typename I, typename W, typename E>
 void
 print_graph(
-  std::ostream&                     os,
-  I                                 vc,
-  std::vector<std::tuple<I, I, W>>& edges,
+  std::ostream& os,
+  I             vc,
+  E&            edges,
   std::integral_constant<graph_preamble_format, graph_preamble_format::graph_preamble_fmt_vertex_count>);
 
-template<graph_format F, typename I, typename W>
+template<graph_format F, typename I, typename W, typename E>
 void
 print_graph(
-  std::ostream&                     os,
-  I                                 vc,
-  std::vector<std::tuple<I, I, W>>& edges,
+  std::ostream& os,
+  I             vc,
+  E&            edges,
   std::integral_constant<graph_preamble_format, graph_preamble_format::graph_preamble_fmt_edge_count>);
 
-template<graph_format F, typename I, typename W>
+template<graph_format F, typename I, typename W, typename E>
 void
 print_graph(
-  std::ostream&                     os,
-  I                                 vc,
-  std::vector<std::tuple<I, I, W>>& edges,
+  std::ostream& os,
+  I             vc,
+  E&            edges,
   std::integral_constant<graph_preamble_format, graph_preamble_format::graph_preamble_fmt_none>);
 
-template<graph_format F, typename I, typename W>
+template<graph_format F, typename I, typename W, typename E>
 void
 print_graph(
-  std::ostream&                     os,
-  I                                 vc,
-  std::vector<std::tuple<I, I, W>>& edges);
+  std::ostream& os,
+  I             vc,
+  E&            edges);
 
 } // namespace impl
 
@@ -431,6 +433,35 @@ template<typename TIndex>
 std::istream&
 operator>>(std::istream& is, graph_preamble<graph_format::graph_fmt_dimacs, TIndex>& preamble)
 {
+  // Comment lines are skipped up to the problem line ('p' [type] vc ec). The
+  // problem line is optional, so any other line is left in the stream and the
+  // preamble doesn't declare counts
+  //
+  std::string v;
+  while (is.peek() == 'c')
+    std::getline(is, v);
+
+  if (is.peek() != 'p')
+    return is;
+
+  std::getline(is, v);
+
+  std::stringstream ss(v.substr(1));
+
+  // The problem type (ex. 'sp' in the original format) is optional
+  //
+  if (!std::isdigit((ss >> std::ws).peek())) {
+    std::string type;
+    ss >> type;
+  }
+
+  TIndex vc, ec;
+  if (ss >> vc >> ec) {
+    preamble = graph_preamble<graph_format::graph_fmt_dimacs, TIndex>(vc, ec);
+    return is;
+  }
+
+  is.setstate(std::ios::failbit);
   return is;
 };
 
@@ -622,33 +653,40 @@ parse_graph_format(
   return false;
 };
 
-template<typename I, typename W>
-std::tuple<I, std::vector<std::tuple<I, I, W>>>
+// Scans a graph into `E` edges container, which has to support `reserve`
+// and `push_back` of `std::tuple<I, I, W>` values (ex. `std::vector` or
+// `edges_container`)
+//
+template<typename I, typename W, typename E = std::vector<std::tuple<I, I, W>>>
+std::tuple<I, E>
 scan_graph(
   graph_format  format,
   std::istream& is)
 {
   switch (format) {
     case graph_format::graph_fmt_edgelist:
-      return impl::scan_graph<graph_format::graph_fmt_edgelist, I, W>(is);
+      return impl::scan_graph<graph_format::graph_fmt_edgelist, I, W, E>(is);
     case graph_format::graph_fmt_weightlist:
-      return impl::scan_graph<graph_format::graph_fmt_weightlist, I, W>(is);
+      return impl::scan_graph<graph_format::graph_fmt_weightlist, I, W, E>(is);
     case graph_format::graph_fmt_dimacs:
-      return impl::scan_graph<graph_format::graph_fmt_dimacs, I, W>(is);
+      return impl::scan_graph<graph_format::graph_fmt_dimacs, I, W, E>(is);
     case graph_format::graph_fmt_binary:
-      return impl::scan_graph<graph_format::graph_fmt_binary, I, W>(is);
+      return impl::scan_graph<graph_format::graph_fmt_binary, I, W, E>(is);
     default:
       throw std::logic_error("erro: The format is not supported");
   }
 };
 
-template<typename I, typename W>
+template<typename E>
 void
 print_graph(
-  graph_format                      format,
-  std::ostream&                     os,
-  std::vector<std::tuple<I, I, W>>& edges)
+  graph_format  format,
+  std::ostream& os,
+  E&            edges)
 {
+  using I = std::tuple_element_t<0, typename E::value_type>;
+  using W = std::tuple_element_t<2, typename E::value_type>;
+
   switch (format) {
     case graph_format::graph_fmt_edgelist:
       impl::print_graph<graph_format::graph_fmt_edgelist, I, W>(os, edges);
@@ -671,14 +709,16 @@ print_graph(
   os.flush();
 };
 
-template<typename I, typename W>
+template<typename I, typename E>
 void
 print_graph(
-  graph_format                      format,
-  std::ostream&                     os,
-  I                                 vc,
-  std::vector<std::tuple<I, I, W>>& edges)
+  graph_format  format,
+  std::ostream& os,
+  I             vc,
+  E&            edges)
 {
+  using W = std::tuple_element_t<2, typename E::value_type>;
+
   switch (format) {
     case graph_format::graph_fmt_edgelist:
       impl::print_graph<graph_format::graph_fmt_edgelist, I, W>(os, vc, edges);
@@ -778,8 +818,35 @@ public:
   }
 };
 
-template<graph_format F, typename I, typename W>
-std::tuple<I, std::vector<std::tuple<I, I, W>>>
+// Throws if the number of edges doesn't match the one declared in the
+// preamble or if edges refer to vertexes beyond the declared number of
+// vertexes (zero means the preamble doesn't declare it). Returns the number
+// of vertexes of the graph, which includes isolated vertexes declared in the
+// preamble (i.e. vertexes after the last one referred by edges)
+//
+template<typename I>
+I
+check_graph_counts(
+  I      expected_vc,
+  I      expected_ec,
+  I      vc,
+  size_t ec)
+{
+  if (expected_vc != I(0) && expected_vc < vc)
+    throw std::logic_error(
+      "erro: the expected number of vertices (" + std::to_string(expected_vc)
+        + ") is less than the number scanned ones (" + std::to_string(vc) + ")");
+
+  if (expected_ec != I(0) && size_t(expected_ec) != ec)
+    throw std::logic_error(
+      "erro: the expected number of edges (" + std::to_string(expected_ec)
+        + ") don't match the number scanned ones (" + std::to_string(ec) + ")");
+
+  return expected_vc != I(0) ? expected_vc : vc;
+};
+
+template<graph_format F, typename I, typename W, typename E>
+std::tuple<I, E>
 scan_graph_edges(
   std::istream& is,
   I expected_vc,
@@ -787,7 +854,7 @@ scan_graph_edges(
 {
   I vmax = I(0), vc = I(0);
 
-  std::vector<std::tuple<I, I, W>> edges;
+  E edges;
   if (expected_ec != I(0))
     edges.reserve(expected_ec);
 
@@ -799,15 +866,7 @@ scan_graph_edges(
   }
   vc = vmax + I(1);
 
-  if (expected_vc != I(0) && expected_vc != vc)
-    throw std::logic_error(
-      "erro: the expected number of vertices (" + std::to_string(expected_vc)
-        + ") don't match the number scanned ones (" + std::to_string(vc) + ")");
-
-  if (expected_ec != I(0) && expected_ec != vc)
-    throw std::logic_error(
-      "erro: the expected number of edges (" + std::to_string(expected_ec)
-        + ") don't match the number scanned ones (" + std::to_string(edges.size()) + ")");
+  vc = check_graph_counts(expected_vc, expected_ec, vc, size_t(edges.size()));
 
   if (is.eof())
     return std::make_tuple(vc, edges);
@@ -815,18 +874,21 @@ scan_graph_edges(
   throw std::logic_error("erro: can't scan 'graph_edge' because of invalid format or IO problem");
 };
 
-template<graph_format F, typename I, typename W>
-std::tuple<I, std::vector<std::tuple<I, I, W>>>
-scan_graph(
+// Scans the preamble of the graph and returns the expected number of vertexes
+// and edges (zero if the preamble doesn't declare it)
+//
+template<graph_format F, typename I>
+std::tuple<I, I>
+scan_graph_preamble(
   std::istream& is,
   std::integral_constant<graph_preamble_format, graph_preamble_format::graph_preamble_fmt_none>)
 {
-  return scan_graph_edges<F, I, W>(is, I(0), I(0));
+  return std::make_tuple(I(0), I(0));
 };
 
-template<graph_format F, typename I, typename W>
-std::tuple<I, std::vector<std::tuple<I, I, W>>>
-scan_graph(
+template<graph_format F, typename I>
+std::tuple<I, I>
+scan_graph_preamble(
   std::istream& is,
   std::integral_constant<graph_preamble_format, graph_preamble_format::graph_preamble_fmt_vertex_count>)
 {
@@ -834,12 +896,12 @@ scan_graph(
   if (!(is >> preamble))
     throw std::logic_error("erro: can't scan 'graph_preamble' because of invalid format or IO problem");
 
-  return scan_graph_edges<F, I, W>(is, preamble.vertex_count(), I(0));
+  return std::make_tuple(preamble.vertex_count(), I(0));
 };
 
-template<graph_format F, typename I, typename W>
-std::tuple<I, std::vector<std::tuple<I, I, W>>>
-scan_graph(
+template<graph_format F, typename I>
+std::tuple<I, I>
+scan_graph_preamble(
   std::istream& is,
   std::integral_constant<graph_preamble_format, graph_preamble_format::graph_preamble_fmt_edge_count>)
 {
@@ -847,12 +909,12 @@ scan_graph(
   if (!(is >> preamble))
     throw std::logic_error("erro: can't scan 'graph_preamble' because of invalid format or IO problem");
 
-  return scan_graph_edges<F, I, W>(is, I(0), preamble.edge_count());
+  return std::make_tuple(I(0), preamble.edge_count());
 };
 
-template<graph_format F, typename I, typename W>
-std::tuple<I, std::vector<std::tuple<I, I, W>>>
-scan_graph(
+template<graph_format F, typename I>
+std::tuple<I, I>
+scan_graph_preamble(
   std::istream& is,
   std::integral_constant<graph_preamble_format, graph_preamble_format::graph_preamble_fmt_full>)
 {
@@ -860,25 +922,35 @@ scan_graph(
   if (!(is >> preamble))
     throw std::logic_error("erro: can't scan 'graph_preamble' because of invalid format or IO problem");
 
-  return scan_graph_edges<F, I, W>(is, preamble.vertex_count(), preamble.edge_count());
+  return std::make_tuple(preamble.vertex_count(), preamble.edge_count());
 };
 
-template<graph_format F, typename I, typename W>
-std::tuple<I, std::vector<std::tuple<I, I, W>>>
-scan_graph(
+template<graph_format F, typename I>
+std::tuple<I, I>
+scan_graph_preamble(
   std::istream& is)
 {
-  return scan_graph<F, I, W>(
+  return scan_graph_preamble<F, I>(
     is,
     typename graph_traits<F>::preamble_format());
 };
 
-template<graph_format F, typename I, typename W>
+template<graph_format F, typename I, typename W, typename E>
+std::tuple<I, E>
+scan_graph(
+  std::istream& is)
+{
+  auto [expected_vc, expected_ec] = scan_graph_preamble<F, I>(is);
+
+  return scan_graph_edges<F, I, W, E>(is, expected_vc, expected_ec);
+};
+
+template<graph_format F, typename I, typename W, typename E>
 void
 print_graph_edges(
-  std::ostream&                     os,
-  I                                 expected_vc,
-  std::vector<std::tuple<I, I, W>>& edges)
+  std::ostream& os,
+  I             expected_vc,
+  E&            edges)
 {
   I vmax = I(0), vc = I(0);
 
@@ -893,17 +965,20 @@ print_graph_edges(
   }
   vc = vmax + I(1);
 
-  if (expected_vc != I(0) && expected_vc != vc)
+  // Isolated vertexes (after the last one referred by edges) aren't printed,
+  // but they are still counted in the preamble
+  //
+  if (expected_vc != I(0) && expected_vc < vc)
     throw std::logic_error(
       "erro: the expected number of vertices (" + std::to_string(expected_vc)
-        + ") don't match the number printed ones (" + std::to_string(vc) + ")");
+        + ") is less than the number printed ones (" + std::to_string(vc) + ")");
 };
 
-template<graph_format F, typename I, typename W>
+template<graph_format F, typename I, typename W, typename E>
 void
 print_graph(
-  std::ostream&                     os,
-  std::vector<std::tuple<I, I, W>>& edges,
+  std::ostream& os,
+  E&            edges,
   std::integral_constant<graph_preamble_format, graph_preamble_format::graph_preamble_fmt_full>)
 {
   I vc = I(0), vmax = I(0);
@@ -919,122 +994,122 @@ print_graph(
   if (!(os << preamble))
     throw std::logic_error("erro: can't print 'graph_preamble' because of IO problem");
 
-  print_graph_edges<F, I, W>(os, I(0), edges);
+  print_graph_edges<F, I, W, E>(os, I(0), edges);
 };
 
-template<graph_format F, typename I, typename W>
+template<graph_format F, typename I, typename W, typename E>
 void
 print_graph(
-  std::ostream&                     os,
-  std::vector<std::tuple<I, I, W>>& edges,
+  std::ostream& os,
+  E&            edges,
   std::integral_constant<graph_preamble_format, graph_preamble_format::graph_preamble_fmt_vertex_count>)
 {
-  print_graph<F, I, W>(
+  print_graph<F, I, W, E>(
     os,
     edges,
     graph_preamble_format::graph_preamble_fmt_full);
 };
 
-template<graph_format F, typename I, typename W>
+template<graph_format F, typename I, typename W, typename E>
 void
 print_graph(
-  std::ostream&                     os,
-  std::vector<std::tuple<I, I, W>>& edges,
+  std::ostream& os,
+  E&            edges,
   std::integral_constant<graph_preamble_format, graph_preamble_format::graph_preamble_fmt_edge_count>)
 {
   io::graph_preamble<F, I> preamble(I(0), edges.size());
   if (!(os << preamble))
     throw std::logic_error("erro: can't print 'graph_preamble' because of IO problem");
 
-  print_graph_edges<F, I, W>(os, I(0), edges);
+  print_graph_edges<F, I, W, E>(os, I(0), edges);
 };
 
-template<graph_format F, typename I, typename W>
+template<graph_format F, typename I, typename W, typename E>
 void
 print_graph(
-  std::ostream&                     os,
-  std::vector<std::tuple<I, I, W>>& edges,
+  std::ostream& os,
+  E&            edges,
   std::integral_constant<graph_preamble_format, graph_preamble_format::graph_preamble_fmt_none>)
 {
-  print_graph_edges<F, I, W>(os, I(0), edges);
+  print_graph_edges<F, I, W, E>(os, I(0), edges);
 };
 
-template<graph_format F, typename I, typename W>
+template<graph_format F, typename I, typename W, typename E>
 void
 print_graph(
-  std::ostream&                     os,
-  std::vector<std::tuple<I, I, W>>& edges)
+  std::ostream& os,
+  E&            edges)
 {
-  print_graph<F, I, W>(
+  print_graph<F, I, W, E>(
     os,
     edges,
     typename graph_traits<F>::preamble_format());
 };
 
-template<graph_format F, typename I, typename W>
+template<graph_format F, typename I, typename W, typename E>
 void
 print_graph(
-  std::ostream&                     os,
-  I                                 vc,
-  std::vector<std::tuple<I, I, W>>& edges,
+  std::ostream& os,
+  I             vc,
+  E&            edges,
   std::integral_constant<graph_preamble_format, graph_preamble_format::graph_preamble_fmt_full>)
 {
   io::graph_preamble<F, I> preamble(vc, edges.size());
   if (!(os << preamble))
     throw std::logic_error("erro: can't print 'graph_preamble' because of IO problem");
 
-  print_graph_edges<F, I, W>(os, vc, edges);
+  print_graph_edges<F, I, W, E>(os, vc, edges);
 };
 
-template<graph_format F, typename I, typename W>
+template<graph_format F, typename I, typename W, typename E>
 void
 print_graph(
-  std::ostream&                     os,
-  I                                 vc,
-  std::vector<std::tuple<I, I, W>>& edges,
+  std::ostream& os,
+  I             vc,
+  E&            edges,
   std::integral_constant<graph_preamble_format, graph_preamble_format::graph_preamble_fmt_vertex_count>)
 {
-  print_graph<F, I, W>(
+  print_graph<F, I, W, E>(
     os,
     vc,
     edges,
     graph_preamble_format::graph_preamble_fmt_full);
 };
 
-template<graph_format F, typename I, typename W>
+template<graph_format F, typename I, typename W, typename E>
 void
 print_graph(
-  std::ostream&                     os,
-  I                                 vc,
-  std::vector<std::tuple<I, I, W>>& edges,
+  std::ostream& os,
+  I             vc,
+  E&            edges,
   std::integral_constant<graph_preamble_format, graph_preamble_format::graph_preamble_fmt_edge_count>)
 {
   io::graph_preamble<F, I> preamble(I(0), edges.size());
   if (!(os << preamble))
     throw std::logic_error("erro: can't print 'graph_preamble' because of IO problem");
 
-  print_graph_edges<F, I, W>(os, vc, edges);
+  print_graph_edges<F, I, W, E>(os, vc, edges);
 };
 
-template<graph_format F, typename I, typename W>
+template<graph_format F, typename I, typename W, typename E>
 void
 print_graph(
-  std::ostream&                     os,
-  I                                 vc,
-  std::vector<std::tuple<I, I, W>>& edges,
+  std::ostream& os,
+  I             vc,
+  E&            edges,
   std::integral_constant<graph_preamble_format, graph_preamble_format::graph_preamble_fmt_none>)
 {
-  print_graph_edges<F, I, W>(os, vc, edges);
+  print_graph_edges<F, I, W, E>(os, vc, edges);
 };
 
-template<graph_format F, typename I, typename W>
+template<graph_format F, typename I, typename W, typename E>
 void
 print_graph(
-  std::ostream&                     os,
-  I                                 vc,
-  std::vector<std::tuple<I, I, W>>& edges)
+  std::ostream& os,
+  I             vc,
+  E&            edges)
 {
-  print_graph<F, I, W>(
+  print_graph<F, I, W, E>(
     os,
     vc,
     edges,
@@ -0,0 +1,250 @@
+#pragma once
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "graphs-edges.hpp"
+
+namespace utilz {
+namespace graphs {
+namespace ordering {
+
+enum graph_ordering
+{
+  graph_ord_none   = 0,
+  graph_ord_bfs    = 1,
+  graph_ord_rcm    = 2,
+  graph_ord_degree = 3
+};
+
+bool
+parse_graph_ordering(
+  const std::string& ordering,
+  graph_ordering&    out_ordering)
+{
+  if (ordering == "bfs") {
+    out_ordering = graph_ordering::graph_ord_bfs;
+    return true;
+  }
+  if (ordering == "rcm") {
+    out_ordering = graph_ordering::graph_ord_rcm;
+    return true;
+  }
+  if (ordering == "degree") {
+    out_ordering = graph_ordering::graph_ord_degree;
+    return true;
+  }
+  return false;
+};
+
+// Symmetric adjacency of a graph in compressed form (neighbours of vertex `v`
+// are `targets[offsets[v]]` ... `targets[offsets[v + 1] - 1]`). Edge directions
+// are ignored, because orderings only care about locality
+//
+template<typename I>
+struct adjacency
+{
+  std::vector<I> offsets;
+  std::vector<I> targets;
+
+  I
+  degree(I v) const noexcept
+  {
+    return this->offsets[v + I(1)] - this->offsets[v];
+  };
+};
+
+template<typename I, typename W>
+adjacency<I>
+make_adjacency(
+  I                            vc,
+  const edges_container<I, W>& edges)
+{
+  adjacency<I> a;
+
+  a.offsets.assign(vc + I(1), I(0));
+  edges.for_each([&a](I f, I t, W w) -> void {
+    if (f == t)
+      return;
+
+    ++a.offsets[f + I(1)];
+    ++a.offsets[t + I(1)];
+  });
+  for (auto v = I(0); v < vc; ++v)
+    a.offsets[v + I(1)] += a.offsets[v];
+
+  a.targets.resize(a.offsets[vc]);
+
+  std::vector<I> positions(a.offsets.begin(), a.offsets.end() - 1);
+  edges.for_each([&a, &positions](I f, I t, W w) -> void {
+    if (f == t)
+      return;
+
+    a.targets[positions[f]++] = t;
+    a.targets[positions[t]++] = f;
+  });
+  return a;
+};
+
+// Returns vertexes in breadth-first order. Every connected component is started
+// from its vertex of the minimum degree. When `by_degree` is set neighbours are
+// visited in ascending order of their degrees (i.e. Cuthill-McKee ordering)
+//
+template<typename I>
+std::vector<I>
+breadth_first_order(
+  I                   vc,
+  const adjacency<I>& a,
+  bool                by_degree)
+{
+  std::vector<I> order;
+  std::vector<I> roots(vc);
+  std::vector<I> neighbours;
+
+  std::vector<bool> visited(vc, false);
+
+  order.reserve(vc);
+
+  std::iota(roots.begin(), roots.end(), I(0));
+  std::stable_sort(roots.begin(), roots.end(), [&a](I l, I r) -> bool {
+    return a.degree(l) < a.degree(r);
+  });
+
+  for (auto root : roots) {
+    if (visited[root])
+      continue;
+
+    visited[root] = true;
+    order.push_back(root);
+
+    for (auto x = order.size() - size_t(1); x < order.size(); ++x) {
+      const auto v = order[x];
+
+      neighbours.clear();
+      for (auto y = a.offsets[v]; y < a.offsets[v + I(1)]; ++y) {
+        const auto w = a.targets[y];
+        if (!visited[w]) {
+          visited[w] = true;
+          neighbours.push_back(w);
+        }
+      }
+
+      if (by_degree)
+        std::stable_sort(neighbours.begin(), neighbours.end(), [&a](I l, I r) -> bool {
+          return a.degree(l) < a.degree(r);
+        });
+
+      order.insert(order.end(), neighbours.begin(), neighbours.end());
+    }
+  }
+  return order;
+};
+
+// Computes a new label of every vertex (i.e. `labels[v]` is a new label of
+// vertex `v`) so that edges of the graph are concentrated near the diagonal
+// of the matrix:
+//
+// - 'bfs', vertexes are labelled in breadth-first order
+// - 'rcm', vertexes are labelled in Reverse Cuthill-McKee order
+// - 'degree', vertexes are labelled in descending order of their degrees,
+//   which packs the most connected vertexes into the top left corner
+//
+template<typename I, typename W>
+std::vector<I>
+order_graph(
+  graph_ordering               ordering,
+  I                            vc,
+  const edges_container<I, W>& edges)
+{
+  auto a = make_adjacency(vc, edges);
+
+  std::vector<I> order;
+  switch (ordering) {
+    case graph_ordering::graph_ord_bfs:
+      order = breadth_first_order(vc, a, false);
+      break;
+    case graph_ordering::graph_ord_rcm:
+      order = breadth_first_order(vc, a, true);
+      std::reverse(order.begin(), order.end());
+      break;
+    case graph_ordering::graph_ord_degree:
+      order.resize(vc);
+      std::iota(order.begin(), order.end(), I(0));
+      std::stable_sort(order.begin(), order.end(), [&a](I l, I r) -> bool {
+        return a.degree(l) > a.degree(r);
+      });
+      break;
+    default:
+      order.resize(vc);
+      std::iota(order.begin(), order.end(), I(0));
+      break;
+  }
+
+  std::vector<I> labels(vc);
+  for (auto x = I(0); x < vc; ++x)
+    labels[order[x]] = x;
+
+  return labels;
+};
+
+// Replaces vertexes of every edge with their new `labels`
+//
+template<typename I, typename W>
+void
+relabel_graph(
+  const std::vector<I>&  labels,
+  edges_container<I, W>& edges)
+{
+  for (auto x = size_t(0); x < edges.size(); ++x)
+    edges.set(x, labels[edges.from(x)], labels[edges.to(x)]);
+};
+
+// Compacts sparse (non-contiguous) vertexes of the graph into a dense range
+// `[0, vc)`, which also allows to store vertexes as 32-bit integers. Returns
+// an original vertex of every new label, which are assigned in ascending
+// order of original vertexes (so the compaction doesn't change relative
+// order of vertexes). Only vertexes referred by edges are kept, so isolated
+// vertexes (ex. declared by a DIMACS 'p' line, but without edges) are dropped
+// and `vc` shrinks accordingly.
+//
+template<typename I, typename W>
+std::vector<I>
+compact_graph(
+  I&                     vc,
+  edges_container<I, W>& edges)
+{
+  std::vector<I> ids;
+
+  ids.reserve(edges.size() * size_t(2));
+  edges.for_each([&ids](I f, I t, W w) -> void {
+    ids.push_back(f);
+    ids.push_back(t);
+  });
+
+  std::sort(ids.begin(), ids.end());
+  ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+  ids.shrink_to_fit();
+
+  const auto count = edges.size();
+
+#ifdef _OPENMP
+  #pragma omp parallel for default(none) shared(ids, edges) firstprivate(count)
+#endif
+  for (auto x = size_t(0); x < count; ++x) {
+    auto f = I(std::lower_bound(ids.begin(), ids.end(), edges.from(x)) - ids.begin());
+    auto t = I(std::lower_bound(ids.begin(), ids.end(), edges.to(x)) - ids.begin());
+
+    edges.set(x, f, t);
+  }
+  edges.shrink_to_fit();
+
+  vc = I(ids.size());
+
+  return ids;
+};
+
+} // namespace ordering
+} // namespace graphs
+} // namespace utilz
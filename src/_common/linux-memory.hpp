@@ -0,0 +1,75 @@
+#pragma once
+
+// global includes
+//
+#include <cstdint>
+#include <memory>
+#include <new>
+
+// operating system includes
+//
+#include <sys/mman.h>
+
+namespace utilz {
+namespace memory {
+
+namespace impl {
+
+// Size of a transparent huge page on x86-64 and most of aarch64 kernels,
+// the mapping is aligned to it so the kernel can back it with huge pages
+// from the very first byte
+//
+constexpr size_t largepage_size = size_t(2) * 1024 * 1024;
+
+// Stored right before the returned pointer, because `__largepages_free`
+// receives only the pointer and `munmap` requires the mapping bounds
+//
+struct largepages_header
+{
+  void*  mapping;
+  size_t length;
+};
+
+} // namespace impl
+
+void
+__largepages_init()
+{
+}
+
+void*
+__largepages_malloc(size_t size)
+{
+  const auto length = size + impl::largepage_size;
+
+  void* mapping = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (mapping == MAP_FAILED)
+    return nullptr;
+
+  const auto base = reinterpret_cast<uintptr_t>(mapping) + sizeof(impl::largepages_header);
+  const auto m    = (base + impl::largepage_size - 1) & ~(impl::largepage_size - 1);
+
+  // The hint is advisory, the memory is still usable when transparent huge
+  // pages are disabled (see /sys/kernel/mm/transparent_hugepage/enabled)
+  //
+#ifdef MADV_HUGEPAGE
+  ::madvise(reinterpret_cast<void*>(m), size, MADV_HUGEPAGE);
+#endif
+
+  new (reinterpret_cast<impl::largepages_header*>(m) - 1) impl::largepages_header{ mapping, length };
+
+  return reinterpret_cast<void*>(m);
+};
+
+void
+__largepages_free(void* m)
+{
+  if (m != nullptr) {
+    const auto header = *(reinterpret_cast<impl::largepages_header*>(m) - 1);
+
+    ::munmap(header.mapping, header.length);
+  }
+}
+
+} // namespace memory
+} // namespace utilz
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <stdexcept>
+#include <vector>
+
 #include "matrix.hpp"
 #include "matrix-manip.hpp"
 #include "matrix-traits.hpp"
@@ -16,9 +19,12 @@ class matrix_abstract;
 
 namespace impl {
 
-template<typename S>
+template<typename D, typename S>
 class impl_matrix_abstract;
 
+template<typename D, typename S>
+class impl_matrix_abstract_blocks;
+
 };
 
 //
@@ -31,9 +37,169 @@ class matrix_abstract
   static_assert(false, "The applied matrix type isn't supported");
 };
 
+namespace impl {
+
+// A base of all abstracts. Translation of indexes is resolved at compile time
+// (the derived abstract `D` provides `translate_at`, `translate_row` and
+// `size`), so it can be inlined into the loops which walk the matrix.
+//
+template<typename D, typename S>
+class impl_matrix_abstract
+{
+private:
+  using size_type = typename traits::matrix_traits<S>::size_type;
+
+  using reference        = typename traits::matrix_traits<S>::reference;
+  using const_reference  = typename traits::matrix_traits<S>::const_reference;
+  using matrix_reference = S&;
+
+protected:
+  matrix_reference m_matrix;
+
+protected:
+  impl_matrix_abstract(matrix_reference matrix)
+    : m_matrix(matrix)
+  {
+  }
+
+public:
+  matrix_reference
+  matrix()
+  {
+    return this->m_matrix;
+  }
+
+  reference
+  at(size_type i, size_type j)
+  {
+    return static_cast<const D*>(this)->translate_at(i, j);
+  }
+  const_reference
+  at(size_type i, size_type j) const
+  {
+    return static_cast<const D*>(this)->translate_at(i, j);
+  }
+
+  // Invokes `fn(j, pointer, count)` for every contiguous span of row `i` (in
+  // the order of columns), i.e. the row is translated once and then every span
+  // can be walked linearly
+  //
+  template<typename F>
+  void
+  for_each_row_span(size_type i, F&& fn) const
+  {
+    static_cast<const D*>(this)->translate_row(i, fn);
+  }
+};
+
+// A base of abstracts over matrices of blocks. It keeps a base pointer of every
+// row of every block (indexed by a row of the abstract and a column of blocks)
+// and a column of blocks (with an offset) of every column of the abstract, so
+// translation of an element takes two table lookups.
+//
+template<typename D, typename S>
+class impl_matrix_abstract_blocks : public impl_matrix_abstract<D, S>
+{
+private:
+  using size_type  = typename traits::matrix_traits<S>::size_type;
+  using value_type = typename traits::matrix_traits<S>::value_type;
+
+  using reference        = typename traits::matrix_traits<S>::reference;
+  using matrix_reference = S&;
+
+protected:
+  // Columns of blocks: the first column of the abstract and the width
+  //
+  std::vector<size_type> m_col_starts;
+  std::vector<size_type> m_col_widths;
+
+  // A column of blocks and an offset in it of every column of the abstract
+  //
+  std::vector<size_type> m_col_blocks;
+  std::vector<size_type> m_col_offsets;
+
+  // Base pointers of rows, `m_row_bases[i * blocks + c]` points to the row of
+  // a block in `c` column of blocks, which holds row `i` of the abstract
+  //
+  std::vector<value_type*> m_row_bases;
+
+  size_type m_s;
+
+protected:
+  impl_matrix_abstract_blocks(matrix_reference matrix)
+    : impl_matrix_abstract<D, S>(matrix)
+    , m_s(size_type(0))
+  {
+  }
+
+  // Rebuilds translation tables from sizes of rows (`heights`) and columns
+  // (`widths`) of blocks
+  //
+  void
+  rebind_tables(const std::vector<size_type>& heights, const std::vector<size_type>& widths)
+  {
+    const auto blocks = this->m_matrix.size();
+
+    this->m_col_starts.clear();
+    this->m_col_widths.clear();
+    this->m_col_blocks.clear();
+    this->m_col_offsets.clear();
+    this->m_row_bases.clear();
+
+    this->m_col_starts.reserve(blocks);
+    this->m_col_widths.reserve(blocks);
+    this->m_col_blocks.reserve(this->m_s);
+    this->m_col_offsets.reserve(this->m_s);
+    this->m_row_bases.reserve(this->m_s * blocks);
+
+    auto col_delta = size_type(0);
+    for (auto c = size_type(0); c < blocks; ++c) {
+      this->m_col_starts.push_back(col_delta);
+      this->m_col_widths.push_back(widths[c]);
+
+      for (auto j = size_type(0); j < widths[c]; ++j) {
+        this->m_col_blocks.push_back(c);
+        this->m_col_offsets.push_back(j);
+      }
+      col_delta += widths[c];
+    }
+
+    for (auto r = size_type(0); r < blocks; ++r)
+      for (auto i = size_type(0); i < heights[r]; ++i)
+        for (auto c = size_type(0); c < blocks; ++c)
+          this->m_row_bases.push_back(this->m_matrix.at(r, c).at(i));
+  }
+
+public:
+  reference
+  translate_at(size_type i, size_type j) const
+  {
+    const auto blocks = this->m_col_starts.size();
+    return this->m_row_bases[i * blocks + this->m_col_blocks[j]][this->m_col_offsets[j]];
+  }
+
+  template<typename F>
+  void
+  translate_row(size_type i, F& fn) const
+  {
+    const auto blocks = this->m_col_starts.size();
+    const auto bases  = this->m_row_bases.data() + i * blocks;
+    for (auto c = size_type(0); c < blocks; ++c)
+      fn(this->m_col_starts[c], bases[c], this->m_col_widths[c]);
+  }
+
+  size_type
+  size() const
+  {
+    return this->m_s;
+  }
+};
+
+} // namespace impl
+
 template<typename T, typename A>
 class matrix_abstract<square_matrix<T, A>, typename std::enable_if<traits::matrix_traits<T>::is_type::value>::type>
-  : public impl::impl_matrix_abstract<square_matrix<T, A>>
+  : public impl::impl_matrix_abstract<matrix_abstract<square_matrix<T, A>>, square_matrix<T, A>>
 {
 public:
   using matrix_type = square_matrix<T, A>;
@@ -45,18 +211,24 @@ private:
   using const_reference  = typename traits::matrix_traits<matrix_type>::const_reference;
   using matrix_reference = matrix_type&;
 
-protected:
+public:
+  matrix_abstract(matrix_reference matrix)
+    : impl::impl_matrix_abstract<matrix_abstract<square_matrix<T, A>>, square_matrix<T, A>>(matrix)
+  {
+    this->rebind();
+  }
+
   reference
-  translate_at(size_type i, size_type j) override
+  translate_at(size_type i, size_type j) const
   {
     return this->m_matrix.at(i, j);
   }
 
-public:
-  matrix_abstract(matrix_reference matrix)
-    : impl::impl_matrix_abstract<square_matrix<T, A>>(matrix)
+  template<typename F>
+  void
+  translate_row(size_type i, F& fn) const
   {
-    this->rebind();
+    fn(size_type(0), this->m_matrix.at(i), this->m_matrix.size());
   }
 
   void
@@ -73,7 +245,7 @@ public:
 
 template<typename T, typename A, typename U>
 class matrix_abstract<square_matrix<square_matrix<T, A>, U>, typename std::enable_if<traits::matrix_traits<T>::is_type::value>::type>
-  : public impl::impl_matrix_abstract<square_matrix<square_matrix<T, A>, U>>
+  : public impl::impl_matrix_abstract_blocks<matrix_abstract<square_matrix<square_matrix<T, A>, U>>, square_matrix<square_matrix<T, A>, U>>
 {
 public:
   using matrix_type = square_matrix<square_matrix<T, A>, U>;
@@ -81,29 +253,11 @@ public:
   using value_type  = typename traits::matrix_traits<matrix_type>::value_type;
 
 private:
-  using reference        = typename traits::matrix_traits<matrix_type>::reference;
-  using const_reference  = typename traits::matrix_traits<matrix_type>::const_reference;
   using matrix_reference = matrix_type&;
 
-private:
-  std::vector<int> m_cache;
-
-  size_type m_s;
-
-protected:
-  reference
-  translate_at(size_type i, size_type j) override
-  {
-    auto [r, ro] = this->translation_entry_unpack(this->m_cache[i]);
-    auto [c, co] = this->translation_entry_unpack(this->m_cache[j]);
-
-    return this->m_matrix.at(r, c).at(i - ro, j - co);
-  }
-
 public:
   matrix_abstract(matrix_reference matrix)
-    : impl::impl_matrix_abstract<square_matrix<square_matrix<T, A>, U>>(matrix)
-    , m_s(size_type(0))
+    : impl::impl_matrix_abstract_blocks<matrix_abstract<square_matrix<square_matrix<T, A>, U>>, square_matrix<square_matrix<T, A>, U>>(matrix)
   {
     this->rebind();
   }
@@ -111,36 +265,23 @@ public:
   void
   rebind()
   {
-    auto s = size_type(0);
-    for (auto z = size_type(0); z < this->m_matrix.size(); ++z)
-      s += this->m_matrix.at(z, z).size();
-
-    this->m_s = s;
-
-    this->m_cache.clear();
-    this->m_cache.reserve(this->m_s);
+    std::vector<size_type> sizes;
+    sizes.reserve(this->m_matrix.size());
 
-    auto delta = size_type(0);
+    auto s = size_type(0);
     for (auto z = size_type(0); z < this->m_matrix.size(); ++z) {
-      auto size = this->m_matrix.at(z, z).size();
-
-      for (auto i = size_type(0); i < size; ++i)
-        this->m_cache.push_back(this->translation_entry_pack(z, delta));
-
-      delta += size;
+      sizes.push_back(this->m_matrix.at(z, z).size());
+      s += sizes.back();
     }
-  }
 
-  size_type
-  size() const
-  {
-    return this->m_s;
+    this->m_s = s;
+    this->rebind_tables(sizes, sizes);
   }
 };
 
 template<typename T, typename A, typename U>
 class matrix_abstract<square_matrix<rect_matrix<T, A>, U>, typename std::enable_if<traits::matrix_traits<T>::is_type::value>::type>
-  : public impl::impl_matrix_abstract<square_matrix<rect_matrix<T, A>, U>>
+  : public impl::impl_matrix_abstract_blocks<matrix_abstract<square_matrix<rect_matrix<T, A>, U>>, square_matrix<rect_matrix<T, A>, U>>
 {
 public:
   using matrix_type = square_matrix<rect_matrix<T, A>, U>;
@@ -148,30 +289,11 @@ public:
   using value_type  = typename traits::matrix_traits<matrix_type>::value_type;
 
 private:
-  using reference        = typename traits::matrix_traits<matrix_type>::reference;
-  using const_reference  = typename traits::matrix_traits<matrix_type>::const_reference;
   using matrix_reference = matrix_type&;
 
-private:
-  std::vector<int> m_row_cache;
-  std::vector<int> m_col_cache;
-
-  size_type m_s;
-
-protected:
-  reference
-  translate_at(size_type i, size_type j) override
-  {
-    auto [r, ro] = this->translation_entry_unpack(this->m_row_cache[i]);
-    auto [c, co] = this->translation_entry_unpack(this->m_col_cache[j]);
-
-    return this->m_matrix.at(r, c).at(i - ro, j - co);
-  }
-
 public:
   matrix_abstract(matrix_reference matrix)
-    : impl::impl_matrix_abstract<square_matrix<rect_matrix<T, A>, U>>(matrix)
-    , m_s(size_type(0))
+    : impl::impl_matrix_abstract_blocks<matrix_abstract<square_matrix<rect_matrix<T, A>, U>>, square_matrix<rect_matrix<T, A>, U>>(matrix)
   {
     this->rebind();
   }
@@ -179,107 +301,28 @@ public:
   void
   rebind()
   {
+    std::vector<size_type> heights, widths;
+    heights.reserve(this->m_matrix.size());
+    widths.reserve(this->m_matrix.size());
+
     auto row_size = size_type(0), col_size = size_type(0);
     for (auto z = size_type(0); z < this->m_matrix.size(); ++z) {
       auto& block = this->m_matrix.at(z, z);
 
+      heights.push_back(block.height());
+      widths.push_back(block.width());
+
       row_size += block.height();
       col_size += block.width();
     }
 
     if (row_size != col_size)
-      std::logic_error("The abstract must represent a square matrix");
+      throw std::logic_error("erro: the abstract must represent a square matrix");
 
     this->m_s = col_size;
-
-    this->m_row_cache.clear();
-    this->m_col_cache.clear();
-    this->m_row_cache.reserve(this->m_s);
-    this->m_col_cache.reserve(this->m_s);
-
-    auto col       = size_type(0), row       = size_type(0);
-    auto col_delta = size_type(0), row_delta = size_type(0);
-
-    for (auto z = size_type(0); z < this->m_matrix.size(); ++z) {
-      auto& block = this->m_matrix.at(z, z);
-
-      for (auto i = size_type(0); i < block.height(); ++i, ++row)
-        this->m_row_cache.push_back(this->translation_entry_pack(z, row_delta));
-
-      for (auto j = size_type(0); j < block.width(); ++j,  ++col)
-        this->m_col_cache.push_back(this->translation_entry_pack(z, col_delta));
-
-      row_delta += block.height();
-      col_delta += block.width();
-    }
-  }
-
-  size_type
-  size() const
-  {
-    return this->m_s;
-  }
-};
-
-namespace impl {
-
-template<typename S>
-class impl_matrix_abstract
-{
-private:
-  using size_type = typename traits::matrix_traits<S>::size_type;
-
-  using reference        = typename traits::matrix_traits<S>::reference;
-  using const_reference  = typename traits::matrix_traits<S>::const_reference;
-  using matrix_reference = S&;
-
-protected:
-  matrix_reference m_matrix;
-
-protected:
-  std::tuple<size_type, size_type>
-  translation_entry_unpack(int entry)
-  {
-    return std::make_tuple(entry & 0xFFFF, entry >> 16);
-  }
-
-  int
-  translation_entry_pack(size_type index, size_type offset)
-  {
-    return int(offset << 16 | index);
-  }
-
-protected:
-  virtual
-  reference
-  translate_at(size_type i, size_type j) = 0;
-
-protected:
-  impl_matrix_abstract(matrix_reference matrix)
-    : m_matrix(matrix)
-  {
-  }
-
-public:
-  matrix_reference
-  matrix()
-  {
-    return this->m_matrix;
-  }
-
-  reference
-  at(size_type i, size_type j)
-  {
-    return this->translate_at(i, j);
-  }
-  const_reference
-  at(size_type i, size_type j) const
-  {
-    return this->translate_at(i, j);
+    this->rebind_tables(heights, widths);
   }
 };
 
-} // namespace impl
-
 } // namespace matrices
 } // namespace utilz
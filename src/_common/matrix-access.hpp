@@ -1,5 +1,7 @@
 #pragma once
 
+#include <tuple>
+
 #include "matrix.hpp"
 #include "matrix-traits.hpp"
 
@@ -381,6 +383,12 @@ public:
   }
 
 public:
+  matrix_reference
+  matrix() noexcept
+  {
+    return this->m_matrix;
+  }
+
   matrix_dimensions_reference
   dimensions() noexcept
   {
@@ -393,6 +401,32 @@ public:
     return this->m_matrix.at(i, j);
   }
 
+  // Returns a number of tiles in a row (column) of tiles
+  //
+  size_type
+  tiles() noexcept
+  {
+    return size_type(1);
+  }
+
+  // Returns a view of `ib`, `jb` tile (origins of tiles are in coordinates of
+  // the access, i.e. the whole matrix)
+  //
+  tile_view<value_type>
+  tile(size_type ib, size_type jb) noexcept
+  {
+    return make_tile_view(this->m_matrix, size_type(0), size_type(0), this->m_matrix.size(), this->m_matrix.size());
+  }
+
+  // Returns an index of the tile row (column) and an offset inside of the
+  // tile of the `i` row (column)
+  //
+  std::tuple<size_type, size_type>
+  locate(size_type i) noexcept
+  {
+    return std::make_tuple(size_type(0), i);
+  }
+
   void
   set_all(value_type v) noexcept
   {
@@ -449,6 +483,12 @@ public:
   }
 
 public:
+  matrix_reference
+  matrix() noexcept
+  {
+    return this->m_matrix;
+  }
+
   matrix_dimensions_reference
   dimensions() noexcept
   {
@@ -461,6 +501,29 @@ public:
     return this->m_matrix.at(i, j);
   }
 
+  // Returns a number of tiles in a row (column) of tiles
+  //
+  size_type
+  tiles() noexcept
+  {
+    return size_type(1);
+  }
+
+  tile_view<value_type>
+  tile(size_type ib, size_type jb) noexcept
+  {
+    return tile_view<value_type>(this->m_matrix.at(0), size_type(0), size_type(0), this->m_matrix.height(), this->m_matrix.width(), this->m_matrix.stride());
+  }
+
+  // Returns an index of the tile row (column) and an offset inside of the
+  // tile of the `i` row (column)
+  //
+  std::tuple<size_type, size_type>
+  locate(size_type i) noexcept
+  {
+    return std::make_tuple(size_type(0), i);
+  }
+
   void
   set_all(value_type v) noexcept
   {
@@ -518,6 +581,12 @@ public:
   }
 
 public:
+  matrix_reference
+  matrix() noexcept
+  {
+    return this->m_matrix;
+  }
+
   matrix_dimensions_reference
   dimensions() noexcept
   {
@@ -535,6 +604,31 @@ public:
     return this->m_matrix.at(ib, jb).at(bi, bj);
   }
 
+  // Returns a number of tiles (blocks) in a row (column) of tiles
+  //
+  size_type
+  tiles() noexcept
+  {
+    return this->m_matrix.size();
+  }
+
+  tile_view<value_type>
+  tile(size_type ib, size_type jb) noexcept
+  {
+    auto&      block = this->m_matrix.at(ib, jb);
+    const auto size  = this->m_block_size;
+    return tile_view<value_type>(block.at(0), ib * size, jb * size, size, size, block.stride());
+  }
+
+  // Returns an index of the block row (column) and an offset inside of the
+  // block of the `i` row (column)
+  //
+  std::tuple<size_type, size_type>
+  locate(size_type i) noexcept
+  {
+    return std::make_tuple(i / this->m_block_size, i % this->m_block_size);
+  }
+
   void
   set_all(value_type v) noexcept
   {
@@ -591,6 +685,7 @@ private:
 
   std::vector<size_type>  m_icache;
   std::vector<size_type>  m_ocache;
+  std::vector<size_type>  m_bcache;
 
 public:
   matrix_access(matrix_reference matrix, matrix_params_reference matrix_params)
@@ -609,12 +704,15 @@ public:
 
     this->m_icache.reserve(this->m_matrix_dimensions.max());
     this->m_ocache.reserve(this->m_matrix_dimensions.max());
+    this->m_bcache.reserve(this->m_matrix.size());
 
     auto coffset = size_type(0), roffset = size_type(0);
 
     for (auto z = size_type(0); z < this->m_matrix.size(); ++z) {
       auto& block = this->m_matrix.at(z, z);
 
+      this->m_bcache.push_back(roffset);
+
       for (auto i = size_type(0); i < block.height(); ++i) {
         this->m_icache.push_back(z);
         this->m_ocache.push_back(roffset);
@@ -626,6 +724,12 @@ public:
   }
 
 public:
+  matrix_reference
+  matrix() noexcept
+  {
+    return this->m_matrix;
+  }
+
   matrix_dimensions_reference
   dimensions() noexcept
   {
@@ -643,6 +747,30 @@ public:
     return this->m_matrix.at(ib, jb).at(bi, bj);
   }
 
+  // Returns a number of tiles (blocks) in a row (column) of tiles
+  //
+  size_type
+  tiles() noexcept
+  {
+    return this->m_matrix.size();
+  }
+
+  tile_view<value_type>
+  tile(size_type ib, size_type jb) noexcept
+  {
+    auto& block = this->m_matrix.at(ib, jb);
+    return tile_view<value_type>(block.at(0), this->m_bcache[ib], this->m_bcache[jb], block.height(), block.width(), block.stride());
+  }
+
+  // Returns an index of the block row (column) and an offset inside of the
+  // block of the `i` row (column)
+  //
+  std::tuple<size_type, size_type>
+  locate(size_type i) noexcept
+  {
+    return std::make_tuple(this->m_icache[i], i - this->m_ocache[i]);
+  }
+
   void
   set_all(value_type v) noexcept
   {
@@ -718,6 +846,40 @@ public:
   }
 };
 
+// Calls `fn(tile)` for every tile of the matrix (row by row of tiles)
+//
+template<matrix_access_schema TSchema, typename S, typename F>
+void
+for_each_tile(
+  matrix_access<TSchema, S>& matrix_access,
+  F                          fn)
+{
+  const auto tiles = matrix_access.tiles();
+  for (auto ib = decltype(tiles)(0); ib < tiles; ++ib)
+    for (auto jb = decltype(tiles)(0); jb < tiles; ++jb)
+      fn(matrix_access.tile(ib, jb));
+};
+
+// Calls `fn(j, data, count)` for every contiguous span of `i` row of the
+// matrix, where `j` is a column of the first element of the span
+//
+template<matrix_access_schema TSchema, typename S, typename F>
+void
+for_each_row_span(
+  matrix_access<TSchema, S>& matrix_access,
+  size_t                     i,
+  F                          fn)
+{
+  auto [ib, bi] = matrix_access.locate(i);
+
+  const auto tiles = matrix_access.tiles();
+  for (auto jb = decltype(tiles)(0); jb < tiles; ++jb) {
+    auto tile = matrix_access.tile(ib, jb);
+
+    fn(tile.j(), tile.at(bi), tile.width());
+  }
+};
+
 }
 }
 }
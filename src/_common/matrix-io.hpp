@@ -1,15 +1,28 @@
 #pragma once
 
+#ifdef _OPENMP
+  #include <omp.h>
+#endif
+
+#include <algorithm>
+#include <tuple>
+#include <utility>
+#include <vector>
+
 #include "memory.hpp"
 #include "constants.hpp"
 #include "communities-io.hpp"
 #include "graphs-io.hpp"
+#include "graphs-edges.hpp"
 
 #include "matrix.hpp"
 #include "matrix-manip.hpp"
+#include "matrix-panels.hpp"
+#include "matrix-stride.hpp"
 #include "matrix-traits.hpp"
 #include "matrix-abstract.hpp"
 #include "matrix-access.hpp"
+#include "matrix-layout.hpp"
 
 namespace utilz {
 namespace matrices {
@@ -29,7 +42,7 @@ public:
   using size_type   = typename traits::matrix_traits<matrix_type>::size_type;
   using value_type  = typename traits::matrix_traits<matrix_type>::value_type;
 
-  using graph_type       = std::tuple<size_type, std::vector<std::tuple<size_type, size_type, value_type>>>;
+  using graph_type       = std::tuple<size_type, graphs::edges_container<size_type, value_type>>;
   using graph_reference  = graph_type&;
 
   using buffer_type      = memory::buffer;
@@ -46,6 +59,19 @@ public:
   {
   }
 
+  // Returns sizes (in bytes) of allocations made by `scan_init_matrix` (in the
+  // order they are made)
+  //
+  static std::vector<size_t>
+  required_bytes(graph_reference graph)
+  {
+    const auto vc = std::get<0>(graph);
+    if (vc == size_type(0))
+      return std::vector<size_t>();
+
+    return std::vector<size_t>{ vc * stride::leading_dimension<T>(vc) * sizeof(T) };
+  }
+
   buffer_reference
   buffer()
   {
@@ -67,7 +93,7 @@ public:
   using size_type   = typename traits::matrix_traits<matrix_type>::size_type;
   using value_type  = typename traits::matrix_traits<matrix_type>::value_type;
 
-  using graph_type       = std::tuple<size_type, std::vector<std::tuple<size_type, size_type, value_type>>>;
+  using graph_type       = std::tuple<size_type, graphs::edges_container<size_type, value_type>>;
   using graph_reference  = graph_type&;
 
   using buffer_type      = memory::buffer;
@@ -87,6 +113,27 @@ public:
   {
   }
 
+  // Returns sizes (in bytes) of allocations made by `scan_init_matrix` (in the
+  // order they are made)
+  //
+  static std::vector<size_t>
+  required_bytes(graph_reference graph, size_type block_size)
+  {
+    const auto vc          = std::get<0>(graph);
+    const auto matrix_size = (vc + block_size - size_type(1)) / block_size;
+    if (matrix_size == size_type(0))
+      return std::vector<size_t>();
+
+    std::vector<size_t> bytes;
+    bytes.reserve(matrix_size * matrix_size + size_type(1));
+
+    bytes.push_back(matrix_size * matrix_size * sizeof(square_matrix<T, A>));
+    for (auto z = size_type(0); z < matrix_size * matrix_size; ++z)
+      bytes.push_back(block_size * stride::leading_dimension<T>(block_size) * sizeof(T));
+
+    return bytes;
+  }
+
   buffer_reference
   buffer()
   {
@@ -114,7 +161,7 @@ public:
   using size_type   = typename traits::matrix_traits<matrix_type>::size_type;
   using value_type  = typename traits::matrix_traits<matrix_type>::value_type;
 
-  using graph_type       = std::tuple<size_type, std::vector<std::tuple<size_type, size_type, value_type>>>;
+  using graph_type       = std::tuple<size_type, graphs::edges_container<size_type, value_type>>;
   using graph_reference  = graph_type&;
 
   using communities_type      = typename std::map<size_type, std::vector<size_type>>;
@@ -136,6 +183,30 @@ public:
   {
   }
 
+  // Returns sizes (in bytes) of allocations made by `scan_init_matrix` (in the
+  // order they are made)
+  //
+  static std::vector<size_t>
+  required_bytes(communities_reference communities)
+  {
+    std::vector<size_type> rect_sizes;
+    for (auto& [c, v] : communities)
+      rect_sizes.push_back(v.size());
+
+    const auto matrix_size = rect_sizes.size();
+    if (matrix_size == size_type(0))
+      return std::vector<size_t>();
+
+    std::vector<size_t> bytes;
+    bytes.reserve(matrix_size * matrix_size + size_type(1));
+
+    bytes.push_back(matrix_size * matrix_size * sizeof(rect_matrix<T, A>));
+    for (auto [i, j] : layout::tiles_sequence(layout::tiles_layout(), matrix_size))
+      bytes.push_back(rect_sizes[i] * panels::panel_stride<T>(rect_sizes[j]) * sizeof(T));
+
+    return bytes;
+  }
+
   buffer_reference
   buffer()
   {
@@ -181,7 +252,7 @@ scan_init_matrix(
   std::tie(vc, std::ignore)             = graph;
   memory::buffer_allocator<T> allocator = memory::buffer_allocator<T>(&buffer);
 
-  matrix = square_matrix<T, A>(vc, allocator);
+  matrix = square_matrix<T, A>(vc, stride::leading_dimension<T>(vc), allocator);
 };
 
 template<typename T, typename A, typename U>
@@ -211,13 +282,15 @@ scan_init_matrix(
   if (vc % block_size != size_type(0))
     ++matrix_size;
 
+  auto block_stride = stride::leading_dimension<T>(block_size);
+
   matrix = matrix_type(matrix_size, matrix_allocator);
 
-  for (auto i = size_type(0); i < matrix.size(); ++i) {
-    for (auto j = size_type(0); j < matrix.size(); ++j) {
-      matrix.at(i, j) = matrix_block_type(block_size, block_allocator);
-    }
-  }
+  // Blocks are allocated (and therefore placed in the buffer) in the order of
+  // tiles layout (see `tiles_layout`)
+  //
+  for (auto [i, j] : layout::tiles_sequence(layout::tiles_layout(), matrix.size()))
+    matrix.at(i, j) = matrix_block_type(block_size, block_stride, block_allocator);
 };
 
 template<typename T, typename A, typename U>
@@ -245,9 +318,13 @@ scan_init_matrix(
 
   matrix = matrix_type(rect_sizes.size(), matrix_allocator);
 
-  for (auto i = size_type(0); i < matrix.size(); ++i)
-    for (auto j = size_type(0); j < matrix.size(); ++j)
-      matrix.at(i, j) = matrix_block_type(rect_sizes[j], rect_sizes[i], block_allocator);
+  // Rows of every block are padded to the panel stride, which allows kernels
+  // to process whole rows without scalar remainders (the padding is filled
+  // with infinity, see `scan_set_matrix`, so it never affects real values).
+  // Blocks are allocated in the order of tiles layout (see `tiles_layout`)
+  //
+  for (auto [i, j] : layout::tiles_sequence(layout::tiles_layout(), matrix.size()))
+    matrix.at(i, j) = matrix_block_type(rect_sizes[j], rect_sizes[i], panels::panel_stride<T>(rect_sizes[j]), block_allocator);
 };
 
 template<access::matrix_access_schema TSchema, typename S>
@@ -256,34 +333,282 @@ scan_set_matrix(
   access::matrix_access<TSchema, S>& matrix_access,
   scan_matrix_params<S> params)
 {
+  using size_type  = typename traits::matrix_traits<S>::size_type;
   using value_type = typename traits::matrix_traits<S>::value_type;
 
   matrix_access.set_all(utilz::constants::infinity<value_type>());
 
-  auto [vc, edges] = params.graph();
+  auto& [vc, edges] = params.graph();
 
-  for (auto [f, t, w] : edges)
+  edges.for_each([&matrix_access](size_type f, size_type t, value_type w) -> void {
     matrix_access.at(f, t) = w;
+  });
 
   matrix_access.set_diagonal(value_type(0));
 };
 
+namespace impl {
+
+// Buckets edges by rows of blocks in parallel (keeping the order of edges),
+// then sorts edges of every row of blocks by columns of blocks (rows are
+// processed in parallel) and calls `fn(ib, jb, first, last)` for every block
+// of the row, where `first` ... `last` are indexes of the block edges
+//
+template<typename M, typename E, typename F>
+void
+scan_blocks(
+  M& matrix_access,
+  E& edges,
+  F  fn)
+{
+  using size_type = decltype(matrix_access.tiles());
+
+  const auto count  = edges.size();
+  const auto blocks = matrix_access.tiles();
+
+  // Indexes of edges bucketed by rows of blocks, edges of `ib` row of blocks
+  // are `order[offsets[ib]]` ... `order[offsets[ib + 1] - 1]`
+  //
+  std::vector<size_t> offsets(blocks + size_type(1), size_t(0));
+  std::vector<size_t> order(count);
+  std::vector<size_t> histograms;
+
+#ifdef _OPENMP
+  #pragma omp parallel default(none) shared(matrix_access, edges, offsets, order, histograms) firstprivate(count, blocks)
+#endif
+  {
+#ifdef _OPENMP
+    const auto threads = size_t(omp_get_num_threads());
+    const auto thread  = size_t(omp_get_thread_num());
+#else
+    const auto threads = size_t(1);
+    const auto thread  = size_t(0);
+#endif
+
+#ifdef _OPENMP
+  #pragma omp single
+#endif
+    histograms.assign(threads * blocks, size_t(0));
+
+    auto histogram = histograms.data() + thread * blocks;
+
+#ifdef _OPENMP
+  #pragma omp for schedule(static)
+#endif
+    for (auto x = size_t(0); x < count; ++x)
+      ++histogram[std::get<0>(matrix_access.locate(edges.from(x)))];
+
+#ifdef _OPENMP
+  #pragma omp single
+#endif
+    {
+      auto position = size_t(0);
+      for (auto ib = size_type(0); ib < blocks; ++ib) {
+        offsets[ib] = position;
+        for (auto t = size_t(0); t < threads; ++t) {
+          auto& h = histograms[t * blocks + ib];
+
+          position += std::exchange(h, position);
+        }
+      }
+      offsets[blocks] = position;
+    }
+
+    // The same static schedule makes every thread scatter the same edges it
+    // has counted, which keeps the order of edges inside of every bucket
+    //
+#ifdef _OPENMP
+  #pragma omp for schedule(static)
+#endif
+    for (auto x = size_t(0); x < count; ++x)
+      order[histogram[std::get<0>(matrix_access.locate(edges.from(x)))]++] = x;
+  }
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(dynamic) default(none) shared(matrix_access, edges, offsets, order, fn) firstprivate(blocks)
+#endif
+  for (auto ib = size_type(0); ib < blocks; ++ib) {
+    // Stable sort of the row edges by columns of blocks
+    //
+    std::vector<size_t> columns(blocks + size_type(1), size_t(0));
+    std::vector<size_t> sorted(offsets[ib + size_type(1)] - offsets[ib]);
+
+    for (auto x = offsets[ib]; x < offsets[ib + size_type(1)]; ++x)
+      ++columns[std::get<0>(matrix_access.locate(edges.to(order[x]))) + size_type(1)];
+
+    for (auto jb = size_type(0); jb < blocks; ++jb)
+      columns[jb + size_type(1)] += columns[jb];
+
+    {
+      std::vector<size_t> positions(columns.begin(), columns.end() - 1);
+      for (auto x = offsets[ib]; x < offsets[ib + size_type(1)]; ++x)
+        sorted[positions[std::get<0>(matrix_access.locate(edges.to(order[x])))]++] = order[x];
+    }
+
+    for (auto jb = size_type(0); jb < blocks; ++jb)
+      fn(ib, jb, sorted.data() + columns[jb], sorted.data() + columns[jb + size_type(1)]);
+  }
+};
+
+// Fills `tile` of `ib` row and `jb` column of blocks in a single pass: the whole
+// stride with infinity (which initialises padding of the rows, if any), edges
+// `first` ... `last` and the diagonal (for diagonal tiles)
+//
+template<typename M, typename E, typename V>
+void
+scan_tile(
+  M&            matrix_access,
+  E&            edges,
+  V             tile,
+  bool          diagonal,
+  const size_t* first,
+  const size_t* last)
+{
+  using size_type  = typename traits::matrix_traits<V>::size_type;
+  using value_type = typename traits::matrix_traits<V>::value_type;
+
+  for (auto i = size_type(0); i < tile.height(); ++i)
+    std::fill_n(tile.at(i), tile.stride(), utilz::constants::infinity<value_type>());
+
+  for (auto x = first; x != last; ++x)
+    tile.at(std::get<1>(matrix_access.locate(edges.from(*x))), std::get<1>(matrix_access.locate(edges.to(*x)))) = edges.weight(*x);
+
+  if (diagonal)
+    for (auto i = size_type(0); i < (std::min)(tile.height(), tile.width()); ++i)
+      tile.at(i, i) = value_type(0);
+};
+
+} // namespace impl
+
+// Populates matrices of blocks (square blocks and clusters). Edges are bucketed
+// by rows of blocks and then every block is filled in a single pass by the
+// thread which owns its row of blocks (see `scan_blocks`).
+//
+template<typename B, typename U, typename = typename std::enable_if<traits::matrix_traits<B>::is_matrix::value>::type>
+void
+scan_set_matrix(
+  access::matrix_access<access::matrix_access_schema_flat, square_matrix<B, U>>& matrix_access,
+  scan_matrix_params<square_matrix<B, U>> params)
+{
+  using size_type = typename traits::matrix_traits<square_matrix<B, U>>::size_type;
+
+  auto& edges = std::get<1>(params.graph());
+
+  impl::scan_blocks(
+    matrix_access,
+    edges,
+    [&matrix_access, &edges](size_type ib, size_type jb, const size_t* first, const size_t* last) -> void {
+      impl::scan_tile(matrix_access, edges, matrix_access.tile(ib, jb), ib == jb, first, last);
+    });
+};
+
 template<typename T, typename A, typename U>
 void
 scan_matrix_clusters(
   clusters& matrix_clusters,
   scan_matrix_params<square_matrix<rect_matrix<T, A>, U>> params)
 {
-  auto [vc, edges] = params.graph();
+  using matrix_type = square_matrix<rect_matrix<T, A>, U>;
+  using size_type   = typename traits::matrix_traits<matrix_type>::size_type;
+  using value_type  = typename traits::matrix_traits<matrix_type>::value_type;
+
+  auto& [vc, edges] = params.graph();
 
   for (auto [c, v] : params.communities())
     for (auto i : v)
       matrix_clusters.insert_vertex(c, i);
 
-  for (auto [f, t, w] : edges)
+  edges.for_each([&matrix_clusters](size_type f, size_type t, value_type w) -> void {
     matrix_clusters.insert_edge(f, t);
+  });
 }
 
+// Returns blocks of the matrix (a pointer to the first element, height, width
+// and stride) in row-major order of blocks, which describe where the matrix
+// is stored (see `buffer_mmap`)
+//
+template<typename T, typename A>
+std::vector<std::tuple<const void*, size_t, size_t, size_t>>
+storage_blocks(
+  const square_matrix<T, A>& matrix)
+{
+  return { std::make_tuple(static_cast<const void*>(matrix.at(0)), size_t(matrix.size()), size_t(matrix.size()), size_t(matrix.stride())) };
+};
+
+template<typename T, typename A, typename U>
+std::vector<std::tuple<const void*, size_t, size_t, size_t>>
+storage_blocks(
+  const square_matrix<square_matrix<T, A>, U>& matrix)
+{
+  using size_type = typename traits::matrix_traits<square_matrix<square_matrix<T, A>, U>>::size_type;
+
+  std::vector<std::tuple<const void*, size_t, size_t, size_t>> blocks;
+  blocks.reserve(matrix.size() * matrix.size());
+
+  for (auto i = size_type(0); i < matrix.size(); ++i) {
+    for (auto j = size_type(0); j < matrix.size(); ++j) {
+      auto& block = matrix.at(i, j);
+      blocks.push_back(std::make_tuple(static_cast<const void*>(block.at(0)), size_t(block.size()), size_t(block.size()), size_t(block.stride())));
+    }
+  }
+  return blocks;
+};
+
+template<typename T, typename A, typename U>
+std::vector<std::tuple<const void*, size_t, size_t, size_t>>
+storage_blocks(
+  const square_matrix<rect_matrix<T, A>, U>& matrix)
+{
+  using size_type = typename traits::matrix_traits<square_matrix<rect_matrix<T, A>, U>>::size_type;
+
+  std::vector<std::tuple<const void*, size_t, size_t, size_t>> blocks;
+  blocks.reserve(matrix.size() * matrix.size());
+
+  for (auto i = size_type(0); i < matrix.size(); ++i) {
+    for (auto j = size_type(0); j < matrix.size(); ++j) {
+      auto& block = matrix.at(i, j);
+      blocks.push_back(std::make_tuple(static_cast<const void*>(block.at(0)), size_t(block.height()), size_t(block.width()), size_t(block.stride())));
+    }
+  }
+  return blocks;
+};
+
+// Returns vertexes of rows of diagonal blocks (in the order of blocks), i.e.
+// a vertex of `r` row of `k` block (see `buffer_mmap`). Blocks of clusters are
+// of sizes of communities, while in the rest of matrices rows are in the order
+// of vertexes and nothing is returned
+//
+template<access::matrix_access_schema TSchema, typename S>
+std::vector<typename traits::matrix_traits<S>::size_type>
+storage_rows(
+  access::matrix_access<TSchema, S>& matrix_access)
+{
+  return std::vector<typename traits::matrix_traits<S>::size_type>();
+};
+
+template<typename T, typename A, typename U>
+std::vector<typename traits::matrix_traits<square_matrix<rect_matrix<T, A>, U>>::size_type>
+storage_rows(
+  access::matrix_access<access::matrix_access_schema_flat, square_matrix<rect_matrix<T, A>, U>>& matrix_access)
+{
+  using size_type = typename traits::matrix_traits<square_matrix<rect_matrix<T, A>, U>>::size_type;
+
+  auto& matrix = matrix_access.matrix();
+
+  // Rows of every block are consecutive (see `locate`)
+  //
+  std::vector<size_type> offsets(matrix.size(), size_type(0));
+  for (auto k = size_type(1); k < matrix.size(); ++k)
+    offsets[k] = offsets[k - 1] + matrix.at(k - 1, k - 1).height();
+
+  std::vector<size_type> rows(size_t(matrix_access.dimensions().h()));
+  for (auto v = size_type(0); v < size_type(rows.size()); ++v) {
+    auto [k, r] = matrix_access.locate(v);
+    rows[offsets[k] + r] = v;
+  }
+  return rows;
+};
+
 template<access::matrix_access_schema TSchema, typename S>
 void
 print_matrix(
@@ -296,19 +621,81 @@ print_matrix(
 
   auto dimensions = matrix_access.dimensions();
 
+  const auto w        = size_t(dimensions.w());
+  const auto infinity = utilz::constants::infinity<value_type>();
+
   std::vector<std::tuple<size_type, size_type, value_type>> edges;
   for (auto i = size_type(0); i < dimensions.h(); ++i) {
-    for (auto j = size_type(0); j < dimensions.w(); ++j) {
+    access::for_each_row_span(matrix_access, i, [&edges, i, w, infinity](size_t j0, value_type* row, size_t count) -> void {
+      const auto last = (std::min)(j0 + count, w);
+      for (auto j = j0; j < last; ++j) {
+        if (size_t(i) == j)
+          continue;
+
+        auto value = row[j - j0];
+        if (value != infinity)
+          edges.push_back(std::make_tuple(i, size_type(j), value));
+      }
+    });
+  }
+
+  utilz::graphs::io::print_graph(format, os, dimensions.max(), edges);
+};
+
+// Prints the matrix of a relabelled (or compacted) graph using original
+// vertexes, where `labels[v]` is a label of vertex `v` in the matrix and
+// `ids[v]` is an original vertex of `v` (see `graphs-ordering.hpp`). Any of
+// the mappings can be empty.
+//
+template<access::matrix_access_schema TSchema, typename S>
+void
+print_matrix(
+  utilz::graphs::io::graph_format                                  format,
+  std::ostream&                                                    os,
+  access::matrix_access<TSchema, S>&                               matrix_access,
+  const std::vector<typename traits::matrix_traits<S>::size_type>& labels,
+  const std::vector<typename traits::matrix_traits<S>::size_type>& ids)
+{
+  using size_type  = typename traits::matrix_traits<S>::size_type;
+  using value_type = typename traits::matrix_traits<S>::value_type;
+
+  auto dimensions = matrix_access.dimensions();
+
+  auto label = [&labels](size_type v) -> size_type { return labels.empty() ? v : labels[v]; };
+  auto id    = [&ids](size_type v) -> size_type { return ids.empty() ? v : ids[v]; };
+
+  const auto w        = size_t(dimensions.w());
+  const auto infinity = utilz::constants::infinity<value_type>();
+
+  // Blocked matrices are padded up to a multiple of the block size, while
+  // labels cover only the vertexes of the graph
+  //
+  const auto n = labels.empty() ? size_type(dimensions.h()) : size_type(labels.size());
+
+  // Every row of the matrix is gathered from its spans and then read in the
+  // order of original vertexes
+  //
+  std::vector<value_type> row(w);
+
+  std::vector<std::tuple<size_type, size_type, value_type>> edges;
+  for (auto i = size_type(0); i < n; ++i) {
+    access::for_each_row_span(matrix_access, label(i), [&row, w](size_t j0, value_type* span, size_t count) -> void {
+      std::copy_n(span, (std::min)(j0 + count, w) - j0, row.begin() + j0);
+    });
+
+    for (auto j = size_type(0); j < n; ++j) {
       if (i == j)
         continue;
 
-      auto value = matrix_access.at(i, j);
-      if (value != utilz::constants::infinity<value_type>())
-        edges.push_back(std::make_tuple(i, j, value));
+      auto value = row[label(j)];
+      if (value != infinity)
+        edges.push_back(std::make_tuple(id(i), id(j), value));
     }
   }
 
-  utilz::graphs::io::print_graph(format, os, dimensions.max(), edges);
+  auto vc = ids.empty() ? n : ids.back() + size_type(1);
+
+  utilz::graphs::io::print_graph(format, os, vc, edges);
 };
 
 } // namespace io
@@ -0,0 +1,283 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "matrix.hpp"
+
+namespace utilz {
+namespace matrices {
+namespace layout {
+
+// Layouts of `n * n` matrix stored in a contiguous memory:
+//
+// - 'flat', rows of the matrix follow each other (row-major)
+// - 'tiled', the matrix is split into `b * b` tiles, every tile is stored
+//   contiguously (row-major) and tiles follow each other in row-major order
+// - 'morton', the same as 'tiled', but tiles follow each other in Z-order
+//
+enum matrix_layout
+{
+  matrix_layout_flat   = 0,
+  matrix_layout_tiled  = 1,
+  matrix_layout_morton = 2
+};
+
+namespace impl {
+
+// Interleaves bits of `i` and `j` (bits of `i` are the odd ones)
+//
+inline uint64_t
+morton_code(
+  uint32_t i,
+  uint32_t j)
+{
+  auto spread = [](uint64_t x) -> uint64_t {
+    x = (x | (x << 16)) & 0x0000FFFF0000FFFFull;
+    x = (x | (x << 8)) & 0x00FF00FF00FF00FFull;
+    x = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0Full;
+    x = (x | (x << 2)) & 0x3333333333333333ull;
+    x = (x | (x << 1)) & 0x5555555555555555ull;
+    return x;
+  };
+  return (spread(i) << 1) | spread(j);
+};
+
+// Permutes `count` chunks of `chunk` elements in place, so that chunk `x`
+// receives the chunk which was at `source(x)`. Cycles of the permutation are
+// found first and then moved independently (in parallel if `parallel` is set)
+// using a single scratch chunk per thread.
+//
+template<typename T, typename F>
+void
+permute_chunks(
+  T*     data,
+  size_t count,
+  size_t chunk,
+  F      source,
+  bool   parallel)
+{
+  std::vector<size_t> leaders;
+  std::vector<bool>   visited(count, false);
+
+  for (auto s = size_t(0); s < count; ++s) {
+    if (visited[s])
+      continue;
+
+    auto x = s;
+    do {
+      visited[x] = true;
+      x          = source(x);
+    } while (x != s);
+
+    if (source(s) != s)
+      leaders.push_back(s);
+  }
+
+  const auto cycles = leaders.size();
+
+#ifdef _OPENMP
+  #pragma omp parallel if(parallel) default(none) shared(data, leaders, source) firstprivate(chunk, cycles)
+#endif
+  {
+    std::vector<T> scratch(chunk);
+
+#ifdef _OPENMP
+  #pragma omp for schedule(dynamic)
+#endif
+    for (auto c = size_t(0); c < cycles; ++c) {
+      const auto s = leaders[c];
+
+      std::copy_n(data + s * chunk, chunk, scratch.data());
+      for (auto x = s;;) {
+        const auto y = source(x);
+        if (y == s) {
+          std::copy_n(scratch.data(), chunk, data + x * chunk);
+          break;
+        }
+        std::copy_n(data + y * chunk, chunk, data + x * chunk);
+        x = y;
+      }
+    }
+  }
+};
+
+// Converts `n * n` matrix between 'flat' and 'tiled' layouts. Every band of `b`
+// rows is converted independently (in parallel), which is an in place transpose
+// of `b * (n / b)` matrix of `b` elements chunks
+//
+template<typename T>
+void
+relayout_bands(
+  T*     data,
+  size_t n,
+  size_t b,
+  bool   to_tiled)
+{
+  const auto blocks = n / b;
+  const auto bands  = blocks;
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(dynamic) default(none) shared(data) firstprivate(n, b, blocks, bands, to_tiled)
+#endif
+  for (auto r = size_t(0); r < bands; ++r) {
+    auto band = data + r * b * n;
+    if (to_tiled) {
+      // Chunk `x` of the tile `x / b` (row `x % b`) comes from row `x % b` and
+      // column `x / b` of the band
+      //
+      permute_chunks(band, b * blocks, b, [b, blocks](size_t x) -> size_t { return (x % b) * blocks + x / b; }, false);
+    } else {
+      permute_chunks(band, b * blocks, b, [b, blocks](size_t x) -> size_t { return (x % blocks) * b + x / blocks; }, false);
+    }
+  }
+};
+
+} // namespace impl
+
+// Returns a position of every tile of a matrix of `blocks * blocks` tiles in
+// the storage, i.e. `positions[ib * blocks + jb]` is a position of `ib`, `jb`
+// tile
+//
+inline std::vector<size_t>
+tiles_positions(
+  matrix_layout layout,
+  size_t        blocks)
+{
+  std::vector<size_t> order(blocks * blocks);
+  std::iota(order.begin(), order.end(), size_t(0));
+
+  if (layout == matrix_layout::matrix_layout_morton)
+    std::sort(order.begin(), order.end(), [blocks](size_t l, size_t r) -> bool {
+      return impl::morton_code(uint32_t(l / blocks), uint32_t(l % blocks)) < impl::morton_code(uint32_t(r / blocks), uint32_t(r % blocks));
+    });
+
+  std::vector<size_t> positions(blocks * blocks);
+  for (auto x = size_t(0); x < order.size(); ++x)
+    positions[order[x]] = x;
+
+  return positions;
+};
+
+// Returns tiles of a matrix of `blocks * blocks` tiles in the order they follow
+// each other in the storage of `layout`. Schedulers iterate tiles in this order,
+// so temporally adjacent tasks touch adjacent tiles (and in case of 'morton'
+// layout reuse tiles of the same pivot row and column)
+//
+inline std::vector<std::tuple<size_t, size_t>>
+tiles_sequence(
+  matrix_layout layout,
+  size_t        blocks)
+{
+  const auto positions = tiles_positions(layout, blocks);
+
+  std::vector<std::tuple<size_t, size_t>> sequence(blocks * blocks);
+  for (auto t = size_t(0); t < positions.size(); ++t)
+    sequence[positions[t]] = std::make_tuple(t / blocks, t % blocks);
+
+  return sequence;
+};
+
+// Returns a layout of tiles in matrices of blocks. The layout can be set using
+// `APSP_TILES_ORDER` environment variable to `row` (default) or `morton`, which
+// allows to compare them without rebuilding
+//
+inline matrix_layout
+tiles_layout()
+{
+  static const matrix_layout layout = []() -> matrix_layout {
+    auto order = std::getenv("APSP_TILES_ORDER");
+    if (order == nullptr || std::string(order) == "row")
+      return matrix_layout::matrix_layout_tiled;
+
+    if (std::string(order) == "morton")
+      return matrix_layout::matrix_layout_morton;
+
+    throw std::logic_error("erro: unsupported value of APSP_TILES_ORDER (expected 'row' or 'morton')");
+  }();
+  return layout;
+};
+
+// Converts `n * n` matrix stored in contiguous `data` from one layout to another
+// in place, `n` has to be a multiple of the tile size `b`. The conversion is
+// cache blocked (it moves whole rows of tiles or tiles) and uses a single
+// scratch tile per thread.
+//
+template<typename T>
+void
+relayout(
+  T*            data,
+  size_t        n,
+  size_t        b,
+  matrix_layout from,
+  matrix_layout to)
+{
+  if (from == to || n == size_t(0))
+    return;
+
+  if (b == size_t(0) || n % b != size_t(0))
+    throw std::logic_error("erro: the matrix size has to be a multiple of the tile size");
+
+  const auto blocks    = n / b;
+  const auto positions = tiles_positions(matrix_layout::matrix_layout_morton, blocks);
+
+  if (from == matrix_layout::matrix_layout_flat)
+    impl::relayout_bands(data, n, b, true);
+
+  if (from == matrix_layout::matrix_layout_morton) {
+    // Tile `t` (in row-major order) is at `positions[t]`
+    //
+    impl::permute_chunks(data, blocks * blocks, b * b, [&positions](size_t t) -> size_t { return positions[t]; }, true);
+  }
+
+  if (to == matrix_layout::matrix_layout_morton) {
+    std::vector<size_t> order(blocks * blocks);
+    for (auto t = size_t(0); t < order.size(); ++t)
+      order[positions[t]] = t;
+
+    impl::permute_chunks(data, blocks * blocks, b * b, [&order](size_t p) -> size_t { return order[p]; }, true);
+  }
+
+  if (to == matrix_layout::matrix_layout_flat)
+    impl::relayout_bands(data, n, b, false);
+};
+
+// Converts a flat matrix `m` in place, rows of the matrix are compacted first
+// if the matrix has padded rows (and expanded back when the matrix is
+// converted to the 'flat' layout).
+//
+template<typename T, typename A>
+void
+relayout(
+  square_matrix<T, A>& m,
+  size_t               b,
+  matrix_layout        from,
+  matrix_layout        to)
+{
+  const auto n  = m.size();
+  const auto ld = m.stride();
+  if (from == to || n == size_t(0))
+    return;
+
+  auto data = m.at(0);
+
+  if (from == matrix_layout::matrix_layout_flat && ld != n)
+    for (auto i = size_t(1); i < n; ++i)
+      std::copy_n(data + i * ld, n, data + i * n);
+
+  relayout(data, n, b, from, to);
+
+  if (to == matrix_layout::matrix_layout_flat && ld != n)
+    for (auto i = n; i-- > size_t(1);)
+      std::copy_backward(data + i * n, data + i * n + n, data + i * ld + n);
+};
+
+} // namespace layout
+} // namespace matrices
+} // namespace utilz
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <map>
 #include <numeric>
 
@@ -30,16 +31,35 @@ private:
   arrange(access::matrix_access<TSchema, S>& matrix_access, Iterator begin, Iterator end)
   {
     auto dimensions = matrix_access.dimensions();
+    auto tiles      = matrix_access.tiles();
 
     for (auto it = begin; it != end; ++it) {
       if (it->first == it->second)
         continue;
 
-      for (auto j = size_type(0); j < dimensions.w(); ++j)
-        std::swap(matrix_access.at(it->first, j), matrix_access.at(it->second, j));
+      auto [a_tile, a_offset] = matrix_access.locate(it->first);
+      auto [b_tile, b_offset] = matrix_access.locate(it->second);
 
-      for (auto i = size_type(0); i < dimensions.h(); ++i)
-        std::swap(matrix_access.at(i, it->first), matrix_access.at(i, it->second));
+      // Swap rows span by span (both rows have the same tiles of columns)
+      //
+      for (auto t = size_type(0); t < tiles; ++t) {
+        auto a = matrix_access.tile(a_tile, t);
+        auto b = matrix_access.tile(b_tile, t);
+
+        const auto count = (std::min)(a.width(), dimensions.w() - (std::min)(a.j(), dimensions.w()));
+        std::swap_ranges(a.at(a_offset), a.at(a_offset) + count, b.at(b_offset));
+      }
+
+      // Swap columns tile by tile (both columns have the same tiles of rows)
+      //
+      for (auto t = size_type(0); t < tiles; ++t) {
+        auto a = matrix_access.tile(t, a_tile);
+        auto b = matrix_access.tile(t, b_tile);
+
+        const auto count = (std::min)(a.height(), dimensions.h() - (std::min)(a.i(), dimensions.h()));
+        for (auto r = size_type(0); r < count; ++r)
+          std::swap(a.at(r, a_offset), b.at(r, b_offset));
+      }
     }
   }
 
@@ -0,0 +1,216 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#include "memory.hpp"
+#include "matrix.hpp"
+#include "matrix-traits.hpp"
+
+namespace utilz {
+namespace matrices {
+namespace panels {
+
+// ---
+// Forward declarations
+//
+
+template<typename T>
+struct bridges_panels;
+
+//
+// Forward declarations
+// ---
+
+// Alignment (in bytes) of every row of a packed panel, it is large enough for
+// any of the available SIMD extensions (and matches a cache line size)
+//
+constexpr size_t panel_alignment = 64;
+
+// Returns a number of elements in a row of a packed panel, which has `count`
+// meaningful elements (the rest is padding)
+//
+template<typename T>
+constexpr size_t
+panel_stride(size_t count)
+{
+  const auto x = (std::max)(size_t(1), panel_alignment / sizeof(T));
+  return (count + x - size_t(1)) / x * x;
+};
+
+// Packed bridges panels of a clustered matrix. For a diagonal block `m`:
+//
+// - `columns(i)` holds bridges columns of block `im` as `im.height() x count`
+//   panel with `panel_stride(count)` elements per row
+// - `rows(j)` holds bridges rows of block `mj` as `count x mj.width()` panel
+//   with `panel_stride(mj.width())` elements per row
+//
+// where `count` is the number of bridges (it can't exceed `capacity`). The
+// memory is allocated once (see `allocate_panels`) and reused by all diagonal
+// blocks.
+//
+template<typename T>
+struct bridges_panels
+{
+  using pointer = T*;
+
+  ::utilz::memory::buffer::pointer columns_memory;
+  ::utilz::memory::buffer::pointer rows_memory;
+
+  size_t columns_size;
+  size_t rows_size;
+  size_t capacity;
+
+  pointer columns_base;
+  pointer rows_base;
+
+  std::vector<size_t> columns_offsets;
+  std::vector<size_t> rows_offsets;
+
+  pointer
+  columns(size_t i) const noexcept
+  {
+    return this->columns_base + this->columns_offsets[i];
+  };
+
+  pointer
+  rows(size_t j) const noexcept
+  {
+    return this->rows_base + this->rows_offsets[j];
+  };
+};
+
+// Returns sizes (in bytes) of columns and rows panels of a clustered matrix,
+// where `heights` are heights of rows of blocks, `widths` are widths of columns
+// of blocks and `capacity` is the maximum number of bridges of any diagonal
+// block
+//
+template<typename T>
+std::tuple<size_t, size_t>
+panels_bytes(
+  const std::vector<size_t>& heights,
+  const std::vector<size_t>& widths,
+  size_t                     capacity)
+{
+  const auto columns_stride = panel_stride<T>(capacity);
+
+  auto columns_count = size_t(0);
+  auto rows_count    = size_t(0);
+  for (auto i = size_t(0); i < heights.size(); ++i) {
+    columns_count += heights[i] * columns_stride;
+    rows_count    += capacity * panel_stride<T>(widths[i]);
+  }
+
+  // Buffers don't guarantee alignment, that is why we allocate a bit more
+  // and align panels manually
+  //
+  return std::make_tuple(columns_count * sizeof(T) + panel_alignment, rows_count * sizeof(T) + panel_alignment);
+};
+
+// Allocates panels for all blocks of a clustered `matrix` using buffer `b`,
+// where `capacity` is the maximum number of bridges of any diagonal block
+//
+template<typename T, typename A, typename U>
+void
+allocate_panels(
+  bridges_panels<T>&                            panels,
+  const square_matrix<rect_matrix<T, A>, U>&    matrix,
+  size_t                                        capacity,
+  ::utilz::memory::buffer&                      b)
+{
+  using pointer = typename bridges_panels<T>::pointer;
+
+  const auto columns_stride = panel_stride<T>(capacity);
+
+  panels.capacity = capacity;
+  panels.columns_offsets.resize(matrix.size());
+  panels.rows_offsets.resize(matrix.size());
+
+  std::vector<size_t> heights(matrix.size());
+  std::vector<size_t> widths(matrix.size());
+
+  auto columns_count = size_t(0);
+  auto rows_count    = size_t(0);
+  for (auto i = size_t(0); i < matrix.size(); ++i) {
+    panels.columns_offsets[i] = columns_count;
+    panels.rows_offsets[i]    = rows_count;
+
+    // All blocks in the same row have the same height and all blocks in the
+    // same column have the same width
+    //
+    heights[i] = matrix.at(i, 0).height();
+    widths[i]  = matrix.at(0, i).width();
+
+    columns_count += heights[i] * columns_stride;
+    rows_count    += capacity * panel_stride<T>(widths[i]);
+  }
+
+  std::tie(panels.columns_size, panels.rows_size) = panels_bytes<T>(heights, widths, capacity);
+
+  panels.columns_memory = b.allocate(panels.columns_size);
+  panels.rows_memory    = b.allocate(panels.rows_size);
+
+  auto align = [](::utilz::memory::buffer::pointer p) -> pointer {
+    auto x = reinterpret_cast<std::uintptr_t>(p);
+    return reinterpret_cast<pointer>((x + panel_alignment - 1) / panel_alignment * panel_alignment);
+  };
+
+  panels.columns_base = align(panels.columns_memory);
+  panels.rows_base    = align(panels.rows_memory);
+};
+
+template<typename T>
+void
+free_panels(
+  bridges_panels<T>&       panels,
+  ::utilz::memory::buffer& b)
+{
+  b.deallocate(panels.columns_memory, panels.columns_size);
+  b.deallocate(panels.rows_memory, panels.rows_size);
+
+  panels.columns_offsets.clear();
+  panels.rows_offsets.clear();
+};
+
+// Gathers bridges columns of block `ik` into a `panel`
+//
+template<typename T, typename A>
+void
+pack_columns(
+  const rect_matrix<T, A>&   ik,
+  const std::vector<size_t>& bridges,
+  T*                         panel)
+{
+  const auto stride = panel_stride<T>(bridges.size());
+
+  for (auto i = size_t(0); i < ik.height(); ++i) {
+    auto row = panel + i * stride;
+    for (auto k : bridges)
+      *row++ = ik.at(i, k);
+  }
+};
+
+// Gathers bridges rows of block `kj` into a `panel`. Rows are copied together
+// with their padding if the block is padded to the panel stride
+//
+template<typename T, typename A>
+void
+pack_rows(
+  const rect_matrix<T, A>&   kj,
+  const std::vector<size_t>& bridges,
+  T*                         panel)
+{
+  const auto stride = panel_stride<T>(kj.width());
+  const auto count  = (std::min)(stride, size_t(kj.stride()));
+
+  for (auto k : bridges) {
+    std::copy_n(kj.at(k), count, panel);
+    panel += stride;
+  }
+};
+
+} // namespace panels
+} // namespace matrices
+} // namespace utilz
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__linux__)
+  #include <unistd.h>
+#elif defined(__APPLE__)
+  #include <sys/sysctl.h>
+#endif
+
+namespace utilz {
+namespace matrices {
+namespace stride {
+
+// ---
+// Forward declarations
+//
+
+struct cache_geometry;
+
+//
+// Forward declarations
+// ---
+
+// Geometry of the first level data cache (all values are in bytes, except the
+// associativity)
+//
+struct cache_geometry
+{
+  size_t line;
+  size_t size;
+  size_t associativity;
+};
+
+// Returns geometry of the first level data cache of the machine. Values which
+// can't be detected are replaced with the ones common for x86 and ARM cores
+//
+inline cache_geometry
+detect_cache_geometry()
+{
+  cache_geometry g{ size_t(64), size_t(32) * size_t(1024), size_t(8) };
+
+#if defined(__linux__) && defined(_SC_LEVEL1_DCACHE_LINESIZE)
+  if (auto v = sysconf(_SC_LEVEL1_DCACHE_LINESIZE); v > 0)
+    g.line = size_t(v);
+  if (auto v = sysconf(_SC_LEVEL1_DCACHE_SIZE); v > 0)
+    g.size = size_t(v);
+  if (auto v = sysconf(_SC_LEVEL1_DCACHE_ASSOC); v > 0)
+    g.associativity = size_t(v);
+#elif defined(__APPLE__)
+  auto query = [](const char* name, size_t& out) -> void {
+    auto v = int64_t(0);
+    auto s = sizeof(v);
+    if (sysctlbyname(name, &v, &s, nullptr, 0) == 0 && v > 0)
+      out = size_t(v);
+  };
+  query("hw.cachelinesize", g.line);
+  query("hw.l1dcachesize", g.size);
+#endif
+
+  return g;
+};
+
+inline const cache_geometry&
+get_cache_geometry()
+{
+  static const cache_geometry g = detect_cache_geometry();
+  return g;
+};
+
+// Returns a leading dimension (a number of elements in a padded row) of `n * n`
+// matrix of `T`.
+//
+// A column walk touches one element in every row, i.e. addresses `i * ld`. When
+// a row is a multiple of a large power of two, all of them map to a few cache
+// sets and evict each other long before the cache is full (i.e. sizes like 4096
+// are the worst). Rows are padded to an odd number of cache lines, which makes
+// a column walk to use all sets of the cache (the number of sets is a power of
+// two) and keeps rows aligned to cache lines. Matrices which fit into the cache
+// are never padded.
+//
+template<typename T>
+size_t
+leading_dimension(size_t n)
+{
+  const auto& g = get_cache_geometry();
+
+  if (n * n * sizeof(T) <= g.size || g.line % sizeof(T) != size_t(0))
+    return n;
+
+  auto lines = (n * sizeof(T) + g.line - size_t(1)) / g.line;
+  if (lines % size_t(2) == size_t(0))
+    ++lines;
+
+  return lines * (g.line / sizeof(T));
+};
+
+// Returns a size of a square tile of `T`, so that three tiles (`ij`, `ik` and
+// `kj`) fit into the cache. The size is a multiple of a cache line (if the
+// cache line holds a whole number of elements)
+//
+template<typename T>
+size_t
+tile_size()
+{
+  const auto& g = get_cache_geometry();
+
+  auto size = size_t(1);
+  while ((size + size_t(1)) * (size + size_t(1)) * sizeof(T) * size_t(3) <= g.size)
+    ++size;
+
+  if (g.line % sizeof(T) == size_t(0)) {
+    const auto x = g.line / sizeof(T);
+    if (size >= x)
+      size = size / x * x;
+  }
+  return size;
+};
+
+} // namespace stride
+} // namespace matrices
+} // namespace utilz
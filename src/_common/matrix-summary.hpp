@@ -0,0 +1,99 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "constants.hpp"
+#include "matrix.hpp"
+
+namespace utilz {
+namespace matrices {
+namespace summary {
+
+// ---
+// Forward declarations
+//
+
+class infinite_blocks;
+
+//
+// Forward declarations
+// ---
+
+// Returns `true` if all values of a block are infinite, i.e. there are no
+// known paths between vertexes represented by the block
+//
+template<typename T, typename A>
+bool
+is_infinite(
+  const square_matrix<T, A>& block)
+{
+  for (auto i = size_t(0); i < block.size(); ++i) {
+    const auto p = block.at(i);
+    if (!std::all_of(p, p + block.size(), [](const T& v) -> bool { return v >= ::utilz::constants::infinity<T>(); }))
+      return false;
+  }
+  return true;
+};
+
+template<typename T, typename A>
+bool
+is_infinite(
+  const rect_matrix<T, A>& block)
+{
+  for (auto i = size_t(0); i < block.height(); ++i) {
+    const auto p = block.at(i);
+    if (!std::all_of(p, p + block.width(), [](const T& v) -> bool { return v >= ::utilz::constants::infinity<T>(); }))
+      return false;
+  }
+  return true;
+};
+
+// Per block "all infinite" flags of a blocked (or clustered) matrix.
+//
+// Relaxation never increases values, so once a block has a finite value it
+// stays finite, while an infinite block can only become finite when it is
+// relaxed through two non-infinite blocks (`ik + kj` is infinite otherwise).
+// This allows schedulers to skip relaxations through infinite blocks
+// and re-check only those blocks, which were actually relaxed.
+//
+// Flags of different blocks can be updated concurrently.
+//
+class infinite_blocks
+{
+private:
+  std::vector<unsigned char> m_flags;
+  size_t                     m_size;
+
+public:
+  template<typename T, typename U>
+  explicit infinite_blocks(square_matrix<T, U>& matrix)
+    : m_flags(matrix.size() * matrix.size(), (unsigned char)(0))
+    , m_size(matrix.size())
+  {
+    for (auto i = size_t(0); i < this->m_size; ++i)
+      for (auto j = size_t(0); j < this->m_size; ++j)
+        this->m_flags[i * this->m_size + j] = is_infinite(matrix.at(i, j)) ? 1 : 0;
+  };
+
+  bool
+  at(size_t i, size_t j) const noexcept
+  {
+    return this->m_flags[i * this->m_size + j] != (unsigned char)(0);
+  };
+
+  // Re-checks a block `ij` after relaxation (only if it was infinite)
+  //
+  template<typename B>
+  void
+  update(size_t i, size_t j, const B& block)
+  {
+    auto& flag = this->m_flags[i * this->m_size + j];
+    if (flag != (unsigned char)(0))
+      flag = is_infinite(block) ? 1 : 0;
+  };
+};
+
+} // namespace summary
+} // namespace matrices
+} // namespace utilz
@@ -0,0 +1,473 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "memory.hpp"
+#include "constants.hpp"
+#include "graphs-edges.hpp"
+#include "tiles-storage.hpp"
+
+#include "matrix.hpp"
+#include "matrix-traits.hpp"
+#include "matrix-access.hpp"
+#include "matrix-io.hpp"
+#include "matrix-stride.hpp"
+
+namespace utilz {
+namespace matrices {
+
+// ---
+// Forward declarations
+//
+
+template<typename T>
+class tiles_matrix;
+
+//
+// Forward declarations
+// ---
+
+// A square matrix of `size * size` square tiles, which are stored in a tiles
+// file (see `tiles_file`) instead of memory. Tile `(ib, jb)` is stored under
+// `ib * size + jb` index and rows of every tile are padded to `tile_stride`.
+//
+// The matrix doesn't keep any of the tiles in memory, they are read and written
+// explicitly (i.e. by an out-of-core algorithm). Every write changes a version
+// of the matrix, which allows readers to invalidate tiles they have cached.
+//
+template<typename T>
+class tiles_matrix
+{
+public:
+  using value_type      = T;
+  using size_type       = size_t;
+  using reference       = T&;
+  using const_reference = const T&;
+  using pointer         = T*;
+  using const_pointer   = const T*;
+
+private:
+  struct storage
+  {
+    ::utilz::storage::tiles_file<T> file;
+    std::atomic<size_type>          version;
+
+    storage(const std::string& directory, size_type tile_elements)
+      : file(directory, tile_elements)
+      , version(size_type(0))
+    {
+    }
+  };
+
+  std::unique_ptr<storage> m_storage;
+
+  size_type m_size;
+  size_type m_tile_size;
+  size_type m_tile_stride;
+
+public:
+  tiles_matrix()
+    : m_size(size_type(0))
+    , m_tile_size(size_type(0))
+    , m_tile_stride(size_type(0))
+  {
+  }
+
+  tiles_matrix(size_type size, size_type tile_size, size_type tile_stride, const std::string& directory)
+    : m_storage(std::make_unique<storage>(directory, tile_size * tile_stride))
+    , m_size(size)
+    , m_tile_size(tile_size)
+    , m_tile_stride(tile_stride)
+  {
+  }
+
+  tiles_matrix(const tiles_matrix&) = delete;
+
+  tiles_matrix(tiles_matrix&& o)
+    : m_storage(std::move(o.m_storage))
+    , m_size(std::exchange(o.m_size, size_type(0)))
+    , m_tile_size(std::exchange(o.m_tile_size, size_type(0)))
+    , m_tile_stride(std::exchange(o.m_tile_stride, size_type(0)))
+  {
+  }
+
+  tiles_matrix&
+  operator=(const tiles_matrix&) = delete;
+
+  tiles_matrix&
+  operator=(tiles_matrix&& o) noexcept
+  {
+    if (this != &o) {
+      this->m_storage     = std::move(o.m_storage);
+      this->m_size        = std::exchange(o.m_size, size_type(0));
+      this->m_tile_size   = std::exchange(o.m_tile_size, size_type(0));
+      this->m_tile_stride = std::exchange(o.m_tile_stride, size_type(0));
+    }
+    return *this;
+  };
+
+  // Returns a number of tiles in a row (column) of tiles
+  //
+  size_type
+  size() const noexcept
+  {
+    return this->m_size;
+  };
+
+  size_type
+  tile_size() const noexcept
+  {
+    return this->m_tile_size;
+  };
+
+  size_type
+  tile_stride() const noexcept
+  {
+    return this->m_tile_stride;
+  };
+
+  size_type
+  version() const noexcept
+  {
+    return this->m_storage == nullptr ? size_type(0) : this->m_storage->version.load();
+  };
+
+  // Reads `(ib, jb)` tile into `tile_size * tile_stride` elements of `tile`
+  //
+  void
+  read(size_type ib, size_type jb, pointer tile)
+  {
+    this->m_storage->file.read(ib * this->m_size + jb, tile);
+  };
+
+  // Writes `tile_size * tile_stride` elements of `tile` into `(ib, jb)` tile
+  //
+  void
+  write(size_type ib, size_type jb, const_pointer tile)
+  {
+    this->m_storage->file.write(ib * this->m_size + jb, tile);
+    this->m_storage->version.fetch_add(size_type(1));
+  };
+};
+
+namespace traits {
+
+template<typename T>
+struct matrix_traits<utilz::matrices::tiles_matrix<T>, typename std::enable_if<utilz::matrices::traits::matrix_traits<T>::is_type::value>::type>
+{
+public:
+  using is_matrix       = std::bool_constant<true>;
+  using is_type         = std::bool_constant<false>;
+  using item_type       = typename utilz::matrices::tiles_matrix<T>::value_type;
+  using value_type      = typename utilz::matrices::tiles_matrix<T>::value_type;
+  using size_type       = typename utilz::matrices::tiles_matrix<T>::size_type;
+  using pointer         = typename utilz::matrices::tiles_matrix<T>::pointer;
+  using reference       = typename utilz::matrices::tiles_matrix<T>::reference;
+  using const_reference = typename utilz::matrices::tiles_matrix<T>::const_reference;
+};
+
+} // namespace traits
+
+namespace access {
+
+template<typename T>
+class matrix_params
+  <
+    tiles_matrix<T>,
+    typename std::enable_if<traits::matrix_traits<T>::is_type::value>::type
+  >
+{
+private:
+  using matrix_type = tiles_matrix<T>;
+  using size_type   = typename ::utilz::matrices::traits::matrix_traits<matrix_type>::size_type;
+
+  using matrix_params_reference      = matrix_params&;
+  using matrix_params_move_reference = matrix_params&&;
+
+private:
+  size_type m_block_size;
+
+public:
+  matrix_params()
+    : m_block_size(size_type(0))
+  {
+  }
+  matrix_params(size_type block_size)
+    : m_block_size(block_size)
+  {
+  }
+
+  matrix_params(const matrix_params_reference o)
+    : m_block_size(o.m_block_size)
+  {
+  }
+
+  matrix_params(matrix_params_move_reference o)
+    : m_block_size(std::exchange(o.m_block_size, size_type(0)))
+  {
+  }
+
+  size_type
+  block_size() noexcept
+  {
+    return this->m_block_size;
+  }
+
+  matrix_params_reference
+  operator=(const matrix_params_reference o)
+  {
+    if (this != &o) {
+      this->m_block_size = o.m_block_size;
+    }
+    return *this;
+  };
+
+  matrix_params_reference
+  operator=(matrix_params_move_reference o) noexcept
+  {
+    if (this != &o) {
+      this->m_block_size = std::exchange(o.m_block_size, size_type(0));
+    };
+
+    return *this;
+  };
+};
+
+// Read-only access to a matrix of tiles. A row of tiles is read from the tiles
+// file when any of its tiles is accessed and cached until a different row of
+// tiles is accessed (or the matrix is written), which makes row by row reads
+// (i.e. `for_each_row_span`) read every tile once. Changes made through the
+// access (or tiles it returns) aren't written back to the file.
+//
+template<typename T>
+class matrix_access
+  <
+    matrix_access_schema::matrix_access_schema_flat,
+    tiles_matrix<T>,
+    typename std::enable_if<traits::matrix_traits<T>::is_type::value>::type
+  >
+{
+public:
+  using schema_value = std::integral_constant<matrix_access_schema, matrix_access_schema_flat>;
+
+private:
+  using matrix_type                 = tiles_matrix<T>;
+  using matrix_dimensions_type      = matrix_dimensions<matrix_type>;
+  using matrix_params_type          = matrix_params<matrix_type>;
+  using size_type                   = ::utilz::matrices::traits::matrix_traits<matrix_type>::size_type;
+  using value_type                  = ::utilz::matrices::traits::matrix_traits<matrix_type>::value_type;
+
+  using value_reference             = value_type&;
+  using matrix_reference            = matrix_type&;
+  using matrix_dimensions_reference = matrix_dimensions_type&;
+  using matrix_params_reference     = matrix_params_type&;
+
+private:
+  matrix_reference        m_matrix;
+  matrix_params_reference m_matrix_params;
+
+  size_type               m_block_size;
+  matrix_dimensions_type  m_matrix_dimensions;
+
+  std::vector<value_type> m_row;
+  size_type               m_row_index;
+  size_type               m_row_version;
+
+  value_type*
+  row_of(size_type ib)
+  {
+    const auto elements = this->m_matrix.tile_size() * this->m_matrix.tile_stride();
+    const auto version  = this->m_matrix.version();
+
+    if (this->m_row_index != ib || this->m_row_version != version) {
+      this->m_row.resize(this->m_matrix.size() * elements);
+      for (auto jb = size_type(0); jb < this->m_matrix.size(); ++jb)
+        this->m_matrix.read(ib, jb, this->m_row.data() + jb * elements);
+
+      this->m_row_index   = ib;
+      this->m_row_version = version;
+    }
+    return this->m_row.data();
+  }
+
+public:
+  matrix_access(matrix_reference matrix, matrix_params_reference matrix_params)
+    : m_matrix(matrix)
+    , m_matrix_params(matrix_params)
+    , m_block_size(matrix_params.block_size())
+    , m_matrix_dimensions(matrix.size() * this->m_block_size, matrix.size() * this->m_block_size)
+    , m_row_index(matrix.size())
+    , m_row_version(size_type(0))
+  {
+  }
+
+public:
+  matrix_reference
+  matrix() noexcept
+  {
+    return this->m_matrix;
+  }
+
+  matrix_dimensions_reference
+  dimensions() noexcept
+  {
+    return this->m_matrix_dimensions;
+  }
+
+  value_reference
+  at(size_type i, size_type j)
+  {
+    auto [ib, bi] = this->locate(i);
+    auto [jb, bj] = this->locate(j);
+
+    return this->tile(ib, jb).at(bi, bj);
+  }
+
+  // Returns a number of tiles in a row (column) of tiles
+  //
+  size_type
+  tiles() noexcept
+  {
+    return this->m_matrix.size();
+  }
+
+  tile_view<value_type>
+  tile(size_type ib, size_type jb)
+  {
+    const auto size     = this->m_block_size;
+    const auto stride   = this->m_matrix.tile_stride();
+    const auto elements = this->m_matrix.tile_size() * stride;
+
+    return tile_view<value_type>(this->row_of(ib) + jb * elements, ib * size, jb * size, size, size, stride);
+  }
+
+  // Returns an index of the tile row (column) and an offset inside of the
+  // tile of the `i` row (column)
+  //
+  std::tuple<size_type, size_type>
+  locate(size_type i) noexcept
+  {
+    return std::make_tuple(i / this->m_block_size, i % this->m_block_size);
+  }
+};
+
+} // namespace access
+
+namespace io {
+
+template<typename T>
+class scan_matrix_params<tiles_matrix<T>>
+{
+public:
+  using matrix_type = tiles_matrix<T>;
+  using size_type   = typename traits::matrix_traits<matrix_type>::size_type;
+  using value_type  = typename traits::matrix_traits<matrix_type>::value_type;
+
+  using graph_type       = std::tuple<size_type, graphs::edges_container<size_type, value_type>>;
+  using graph_reference  = graph_type&;
+
+  using buffer_type      = memory::buffer;
+  using buffer_reference = buffer_type&;
+
+private:
+  buffer_reference m_buffer;
+  graph_reference  m_graph;
+
+  size_type m_block_size;
+
+public:
+  scan_matrix_params(buffer_reference buffer, graph_reference graph, size_type block_size)
+    : m_buffer(buffer)
+    , m_graph(graph)
+    , m_block_size(block_size)
+  {
+  }
+
+  // Returns sizes (in bytes) of allocations made by `scan_init_matrix` (in the
+  // order they are made), the matrix is stored in a tiles file and therefore
+  // nothing is allocated from the buffer
+  //
+  static std::vector<size_t>
+  required_bytes(graph_reference graph, size_type block_size)
+  {
+    return std::vector<size_t>();
+  }
+
+  buffer_reference
+  buffer()
+  {
+    return this->m_buffer;
+  }
+
+  graph_reference
+  graph()
+  {
+    return this->m_graph;
+  }
+
+  size_type
+  block_size()
+  {
+    return this->m_block_size;
+  }
+};
+
+// Creates a tiles file for the matrix in `tiles_directory`
+//
+template<typename T>
+void
+scan_init_matrix(
+  tiles_matrix<T>& matrix,
+  scan_matrix_params<tiles_matrix<T>> params)
+{
+  using size_type = typename traits::matrix_traits<tiles_matrix<T>>::size_type;
+
+  size_type vc;
+  std::tie(vc, std::ignore) = params.graph();
+
+  auto block_size  = params.block_size();
+  auto matrix_size = (vc + block_size - size_type(1)) / block_size;
+
+  matrix = tiles_matrix<T>(matrix_size, block_size, stride::leading_dimension<T>(block_size), ::utilz::storage::tiles_directory());
+};
+
+// Populates the tiles file directly: every tile is filled in a thread local
+// buffer (see `scan_blocks`) and written into the file, which means that the
+// matrix is never entirely in memory
+//
+template<typename T>
+void
+scan_set_matrix(
+  access::matrix_access<access::matrix_access_schema_flat, tiles_matrix<T>>& matrix_access,
+  scan_matrix_params<tiles_matrix<T>> params)
+{
+  using size_type = typename traits::matrix_traits<tiles_matrix<T>>::size_type;
+
+  auto& edges  = std::get<1>(params.graph());
+  auto& matrix = matrix_access.matrix();
+
+  impl::scan_blocks(
+    matrix_access,
+    edges,
+    [&matrix_access, &matrix, &edges](size_type ib, size_type jb, const size_t* first, const size_t* last) -> void {
+      static thread_local std::vector<T> buffer;
+
+      const auto size   = matrix.tile_size();
+      const auto stride = matrix.tile_stride();
+
+      buffer.resize(size * stride);
+
+      impl::scan_tile(matrix_access, edges, tile_view<T>(buffer.data(), ib * size, jb * size, size, size, stride), ib == jb, first, last);
+
+      matrix.write(ib, jb, buffer.data());
+    });
+};
+
+} // namespace io
+} // namespace matrices
+} // namespace utilz
@@ -81,6 +81,20 @@ public:
   using const_reference = typename matrix_traits<T>::const_reference;
 };
 
+template<typename T>
+struct matrix_traits<utilz::matrices::tile_view<T>, typename std::enable_if<utilz::matrices::traits::matrix_traits<T>::is_type::value>::type>
+{
+public:
+  using is_matrix       = std::bool_constant<true>;
+  using is_type         = std::bool_constant<false>;
+  using item_type       = typename utilz::matrices::tile_view<T>::value_type;
+  using value_type      = typename utilz::matrices::tile_view<T>::value_type;
+  using size_type       = typename utilz::matrices::tile_view<T>::size_type;
+  using pointer         = typename utilz::matrices::tile_view<T>::pointer;
+  using reference       = typename utilz::matrices::tile_view<T>::reference;
+  using const_reference = typename utilz::matrices::tile_view<T>::const_reference;
+};
+
 } // namespace traits
 } // namespace matrices
 } // namespace utilz
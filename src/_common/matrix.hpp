@@ -39,6 +39,9 @@ class rect_matrix;
 template<typename T, typename A>
 class square_matrix;
 
+template<typename T>
+class tile_view;
+
 //
 // Forward declarations
 // ---
@@ -321,6 +324,7 @@ private:
 
   size_type m_width;
   size_type m_height;
+  size_type m_stride;
 
   size_type m_msize;
   pointer   m_m;
@@ -392,6 +396,7 @@ public:
     : m_a(allocator_type())
     , m_width(0)
     , m_height(0)
+    , m_stride(0)
     , m_msize(0)
     , m_m(nullptr)
   {
@@ -400,19 +405,29 @@ public:
     : m_a(a)
     , m_width(0)
     , m_height(0)
+    , m_stride(0)
     , m_msize(0)
     , m_m(nullptr)
   {
   }
 
   rect_matrix(size_type w, size_type h, const allocator_type& a)
+    : rect_matrix(w, h, w, a)
+  {
+  }
+
+  // Creates `w * h` matrix, where every row is followed by `s - w` padding
+  // elements (i.e. `i` row starts at `i * s` element)
+  //
+  rect_matrix(size_type w, size_type h, size_type s, const allocator_type& a)
     : m_a(a)
     , m_width(w)
     , m_height(h)
-    , m_msize(w * h)
+    , m_stride(s)
+    , m_msize(s * h)
     , m_m(nullptr)
   {
-    if ((w * h) > 0) {
+    if ((s * h) > 0) {
       this->allocate_resources();
       this->construct_default();
     }
@@ -422,6 +437,7 @@ public:
     : m_a(std::allocator_traits<allocator_type>::select_on_container_copy_construction(o.m_a))
     , m_width(o.m_width)
     , m_height(o.m_height)
+    , m_stride(o.m_stride)
     , m_msize(o.m_msize)
     , m_m(nullptr)
   {
@@ -432,6 +448,7 @@ public:
     : m_a(std::move(o.m_a))
     , m_width(std::exchange(o.m_width, 0))
     , m_height(std::exchange(o.m_height, 0))
+    , m_stride(std::exchange(o.m_stride, 0))
     , m_msize(std::exchange(o.m_msize, 0))
     , m_m(std::move(o.m_m))
   {
@@ -440,6 +457,7 @@ public:
     : m_a(a)
     , m_width(o.m_width)
     , m_height(o.m_height)
+    , m_stride(o.m_stride)
     , m_msize(o.m_msize)
     , m_m(nullptr)
   {
@@ -459,6 +477,7 @@ public:
       o.m_msize  = size_type();
       o.m_width  = size_type();
       o.m_height = size_type();
+      o.m_stride = size_type();
       o.m_m      = nullptr;
     }
   };
@@ -487,26 +506,35 @@ public:
     return this->m_height;
   };
 
+  // Returns a number of elements between the beginnings of two consecutive
+  // rows (it is never less than `width()`)
+  //
+  size_type
+  stride() const
+  {
+    return this->m_stride;
+  };
+
   pointer
   at(size_type i) noexcept
   {
-    return &this->m_m[i * this->m_width];
+    return &this->m_m[i * this->m_stride];
   };
   const_pointer
   at(size_type i) const noexcept
   {
-    return &this->m_m[i * this->m_width];
+    return &this->m_m[i * this->m_stride];
   };
 
   reference
   at(size_type i, size_type j) noexcept
   {
-    return this->m_m[i * this->m_width + j];
+    return this->m_m[i * this->m_stride + j];
   };
   const_reference
   at(size_type i, size_type j) const noexcept
   {
-    return this->m_m[i * this->m_width + j];
+    return this->m_m[i * this->m_stride + j];
   };
 
   bool
@@ -533,6 +561,7 @@ public:
       this->m_msize  = o.m_msize;
       this->m_width  = o.m_width;
       this->m_height = o.m_height;
+      this->m_stride = o.m_stride;
 
       this->allocate_resources();
       this->copy_assign_resources_n(o.m_m, o.m_msize);
@@ -552,6 +581,7 @@ public:
         this->m_m      = std::exchange(o.m_m, nullptr);
         this->m_width  = std::exchange(o.m_width, size_type());
         this->m_height = std::exchange(o.m_height, size_type());
+        this->m_stride = std::exchange(o.m_stride, size_type());
         this->m_msize  = std::exchange(o.m_msize, size_type());
       } else {
         if (this->m_a == o.m_a) {
@@ -561,6 +591,7 @@ public:
           this->m_m      = std::exchange(o.m_m, nullptr);
           this->m_width  = std::exchange(o.m_width, size_type());
           this->m_height = std::exchange(o.m_height, size_type());
+          this->m_stride = std::exchange(o.m_stride, size_type());
           this->m_msize  = std::exchange(o.m_msize, size_type());
         } else {
           if (this->m_msize != o.m_msize) {
@@ -593,6 +624,7 @@ private:
   allocator_type m_a;
 
   size_type m_size;
+  size_type m_stride;
 
   size_type m_msize;
   pointer   m_m;
@@ -667,6 +699,7 @@ public:
   square_matrix(const allocator_type& a)
     : m_a(a)
     , m_size(0)
+    , m_stride(0)
     , m_msize(0)
     , m_m(nullptr)
   {
@@ -677,9 +710,18 @@ public:
   {
   }
   square_matrix(size_type s, const allocator_type& a)
+    : square_matrix(s, s, a)
+  {
+  }
+
+  // Creates `s * s` matrix with a leading dimension `ld`, i.e. every row is
+  // followed by `ld - s` padding elements (see `matrix-stride.hpp`)
+  //
+  square_matrix(size_type s, size_type ld, const allocator_type& a)
     : m_a(a)
     , m_size(s)
-    , m_msize(s * s)
+    , m_stride(ld)
+    , m_msize(s * ld)
     , m_m(nullptr)
   {
     if (s > 0) {
@@ -691,6 +733,7 @@ public:
   square_matrix(const square_matrix& o)
     : m_a(std::allocator_traits<allocator_type>::select_on_container_copy_construction(o.m_a))
     , m_size(o.m_size)
+    , m_stride(o.m_stride)
     , m_msize(o.m_msize)
     , m_m(nullptr)
   {
@@ -700,6 +743,7 @@ public:
   square_matrix(square_matrix&& o) noexcept
     : m_a(std::move(o.m_a))
     , m_size(std::exchange(o.m_size, 0))
+    , m_stride(std::exchange(o.m_stride, 0))
     , m_msize(std::exchange(o.m_msize, 0))
     , m_m(std::move(o.m_m))
   {
@@ -707,6 +751,7 @@ public:
   square_matrix(square_matrix&& o, const allocator_type& a)
     : m_a(a)
     , m_size(o.m_size)
+    , m_stride(o.m_stride)
     , m_msize(o.m_msize)
     , m_m(nullptr)
   {
@@ -723,8 +768,9 @@ public:
         o.free_resources();
       }
 
-      o.m_msize = size_type();
-      o.m_size  = size_type();
+      o.m_msize  = size_type();
+      o.m_size   = size_type();
+      o.m_stride = size_type();
       o.m_m     = nullptr;
     }
   };
@@ -747,26 +793,35 @@ public:
     return this->m_size;
   };
 
+  // Returns a number of elements between the beginnings of two consecutive
+  // rows (it is never less than `size()`)
+  //
+  size_type
+  stride() const
+  {
+    return this->m_stride;
+  };
+
   pointer
   at(size_type i) noexcept
   {
-    return &this->m_m[i * this->m_size];
+    return &this->m_m[i * this->m_stride];
   };
   const_pointer
   at(size_type i) const noexcept
   {
-    return &this->m_m[i * this->m_size];
+    return &this->m_m[i * this->m_stride];
   };
 
   reference
   at(size_type i, size_type j) noexcept
   {
-    return this->m_m[i * this->m_size + j];
+    return this->m_m[i * this->m_stride + j];
   };
   const_reference
   at(size_type i, size_type j) const noexcept
   {
-    return this->m_m[i * this->m_size + j];
+    return this->m_m[i * this->m_stride + j];
   };
 
   bool
@@ -790,8 +845,9 @@ public:
       if (std::allocator_traits<allocator_type>::propagate_on_container_copy_assignment::value)
         this->m_a = o.m_a;
 
-      this->m_msize = o.m_msize;
-      this->m_size  = o.m_size;
+      this->m_msize  = o.m_msize;
+      this->m_size   = o.m_size;
+      this->m_stride = o.m_stride;
 
       this->allocate_resources();
       this->copy_assign_resources_n(o.m_m, o.m_msize);
@@ -807,18 +863,20 @@ public:
         this->destroy_resources();
         this->free_resources();
 
-        this->m_a     = std::move(o.m_a);
-        this->m_m     = std::exchange(o.m_m, nullptr);
-        this->m_size  = std::exchange(o.m_size, size_type());
-        this->m_msize = std::exchange(o.m_msize, size_type());
+        this->m_a      = std::move(o.m_a);
+        this->m_m      = std::exchange(o.m_m, nullptr);
+        this->m_size   = std::exchange(o.m_size, size_type());
+        this->m_stride = std::exchange(o.m_stride, size_type());
+        this->m_msize  = std::exchange(o.m_msize, size_type());
       } else {
         if (this->m_a == o.m_a) {
           this->destroy_resources();
           this->free_resources();
 
-          this->m_m     = std::exchange(o.m_m, nullptr);
-          this->m_size  = std::exchange(o.m_size, size_type());
-          this->m_msize = std::exchange(o.m_msize, size_type());
+          this->m_m      = std::exchange(o.m_m, nullptr);
+          this->m_size   = std::exchange(o.m_size, size_type());
+          this->m_stride = std::exchange(o.m_stride, size_type());
+          this->m_msize  = std::exchange(o.m_msize, size_type());
         } else {
           if (this->m_msize != o.m_msize) {
             this->destroy_resources();
@@ -834,5 +892,109 @@ public:
   };
 };
 
+// A non-owning view of `h * w` tile of a matrix, which is located at `i` row
+// and `j` column of the matrix. Rows of the tile start `s` elements after each
+// other (i.e. the tile shares the leading dimension of the matrix). Copies of
+// the view refer to the same memory.
+//
+template<typename T>
+class tile_view
+{
+public:
+  using value_type      = T;
+  using size_type       = size_t;
+  using reference       = T&;
+  using const_reference = const T&;
+  using pointer         = T*;
+  using const_pointer   = const T*;
+
+private:
+  pointer m_m;
+
+  size_type m_i;
+  size_type m_j;
+  size_type m_height;
+  size_type m_width;
+  size_type m_stride;
+
+public:
+  tile_view()
+    : m_m(nullptr)
+    , m_i(0)
+    , m_j(0)
+    , m_height(0)
+    , m_width(0)
+    , m_stride(0)
+  {
+  }
+
+  tile_view(pointer m, size_type i, size_type j, size_type h, size_type w, size_type s)
+    : m_m(m)
+    , m_i(i)
+    , m_j(j)
+    , m_height(h)
+    , m_width(w)
+    , m_stride(s)
+  {
+  }
+
+  size_type
+  i() const noexcept
+  {
+    return this->m_i;
+  };
+
+  size_type
+  j() const noexcept
+  {
+    return this->m_j;
+  };
+
+  size_type
+  width() const noexcept
+  {
+    return this->m_width;
+  };
+
+  size_type
+  height() const noexcept
+  {
+    return this->m_height;
+  };
+
+  size_type
+  stride() const noexcept
+  {
+    return this->m_stride;
+  };
+
+  pointer
+  at(size_type i) const noexcept
+  {
+    return this->m_m + i * this->m_stride;
+  };
+
+  reference
+  at(size_type i, size_type j) const noexcept
+  {
+    return this->m_m[i * this->m_stride + j];
+  };
+};
+
+// Returns a view of `h * w` tile of matrix `m`, which starts at `i` row and
+// `j` column
+//
+template<typename T, typename A>
+tile_view<T>
+make_tile_view(
+  square_matrix<T, A>& m,
+  size_t               i,
+  size_t               j,
+  size_t               h,
+  size_t               w)
+{
+  return tile_view<T>(m.at(i) + j, i, j, h, w, m.stride());
+};
+
 } // namespace matrices
 } // namespace utilz
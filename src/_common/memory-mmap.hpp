@@ -0,0 +1,264 @@
+#pragma once
+
+// global includes
+//
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+// global C includes
+//
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace utilz {
+namespace memory {
+
+// ---
+// Forward declarations
+//
+
+struct buffer_mmap_header;
+struct buffer_mmap_block;
+
+class buffer_mmap;
+
+//
+// Forward declarations
+// ---
+
+// A header of the mapped file (all offsets are in bytes from the beginning of
+// the file). The file consists of:
+//
+// - the header (a single page)
+// - the reservation (`size` bytes starting at `offset`)
+// - a description of the matrix (`blocks_count` records of blocks followed by
+//   `labels_count` labels, `ids_count` ids and `rows_count` vertexes), which is
+//   written by `describe`
+//
+// Vertexes are written for clusters only, where blocks are of different sizes
+// and `rows_count` vertexes are the vertexes of rows of diagonal blocks (in the
+// order of blocks), i.e. a vertex of `r` row of `k` block
+//
+struct buffer_mmap_header
+{
+  char     magic[8];
+  uint64_t version;
+  uint64_t offset;
+  uint64_t size;
+  uint64_t element_size;
+  uint64_t vertices;
+  uint64_t blocks;
+  uint64_t blocks_count;
+  uint64_t blocks_offset;
+  uint64_t labels_count;
+  uint64_t labels_offset;
+  uint64_t ids_count;
+  uint64_t ids_offset;
+  uint64_t rows_count;
+  uint64_t rows_offset;
+};
+
+// A block of the matrix, `offset` is an offset of the first element and the
+// `stride` is the number of elements between rows
+//
+struct buffer_mmap_block
+{
+  uint64_t offset;
+  uint64_t height;
+  uint64_t width;
+  uint64_t stride;
+};
+
+// A reservation of a buffer (see `buffer_arena`) backed by a file, which is
+// mapped into memory as shared. Everything allocated from the buffer (including
+// the matrix) is computed directly in the file, so persisting of the result is
+// a description of the matrix and a single `msync` (instead of printing it).
+// Because pages are backed by the file, the kernel can evict them, which allows
+// reservations somewhat larger than the memory.
+//
+class buffer_mmap
+{
+public:
+  using value_type = char;
+  using pointer    = value_type*;
+  using size_type  = std::size_t;
+
+  // A block of the matrix (a pointer to the first element, height, width and
+  // stride), see `storage_blocks`
+  //
+  using block_type = std::tuple<const void*, size_type, size_type, size_type>;
+
+private:
+  static constexpr const char* magic   = "APSPMMAP";
+  static constexpr uint64_t    version = uint64_t(1);
+
+  int m_fd;
+
+  pointer   m_mapping;
+  size_type m_mapping_size;
+
+  size_type m_offset;
+  size_type m_size;
+
+private:
+  static size_type
+  page_size()
+  {
+    const auto v = sysconf(_SC_PAGESIZE);
+    return v > 0 ? size_type(v) : size_type(4096);
+  };
+
+  buffer_mmap_header*
+  header()
+  {
+    return reinterpret_cast<buffer_mmap_header*>(this->m_mapping);
+  };
+
+  uint64_t
+  offset_of(const void* p) const
+  {
+    const auto x = reinterpret_cast<const char*>(p);
+    if (x < this->m_mapping + this->m_offset || x >= this->m_mapping + this->m_mapping_size)
+      throw std::logic_error("erro: the block isn't a part of the mapped reservation");
+
+    return uint64_t(x - this->m_mapping);
+  };
+
+  void
+  write_at(const void* data, size_type size, size_type offset)
+  {
+    auto bytes = reinterpret_cast<const char*>(data);
+    while (size != size_type(0)) {
+      auto written = ::pwrite(this->m_fd, bytes, size, off_t(offset));
+      if (written <= 0)
+        throw std::runtime_error("erro: can't write the description of the matrix into the mapped file");
+
+      bytes  += written;
+      offset += size_type(written);
+      size   -= size_type(written);
+    }
+  };
+
+public:
+  // Creates (or truncates) `path` and maps `size` bytes of the reservation
+  //
+  buffer_mmap(const std::string& path, size_type size)
+    : m_fd(-1)
+    , m_mapping(nullptr)
+    , m_mapping_size(size_type(0))
+    , m_offset(page_size())
+    , m_size(size)
+  {
+    this->m_fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (this->m_fd == -1)
+      throw std::runtime_error("erro: can't open the file '" + path + "' to map the reservation");
+
+    this->m_mapping_size = this->m_offset + this->m_size;
+    if (::ftruncate(this->m_fd, off_t(this->m_mapping_size)) != 0) {
+      ::close(this->m_fd);
+      throw std::runtime_error("erro: can't resize the file '" + path + "' to map the reservation");
+    }
+
+    auto mapping = ::mmap(nullptr, this->m_mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED, this->m_fd, 0);
+    if (mapping == MAP_FAILED) {
+      ::close(this->m_fd);
+      throw std::runtime_error("erro: can't map the file '" + path + "' into memory");
+    }
+    this->m_mapping = reinterpret_cast<pointer>(mapping);
+
+    auto h = this->header();
+    std::memcpy(h->magic, magic, sizeof(h->magic));
+
+    h->version = version;
+    h->offset  = uint64_t(this->m_offset);
+    h->size    = uint64_t(this->m_size);
+  }
+
+  buffer_mmap(const buffer_mmap&) = delete;
+
+  buffer_mmap&
+  operator=(const buffer_mmap&) = delete;
+
+  ~buffer_mmap()
+  {
+    ::munmap(this->m_mapping, this->m_mapping_size);
+    ::close(this->m_fd);
+  }
+
+  // Returns the reservation to create a buffer over. The memory is owned by
+  // the mapping, so it has to outlive the buffer
+  //
+  std::shared_ptr<value_type>
+  memory()
+  {
+    return std::shared_ptr<value_type>(this->m_mapping + this->m_offset, [](pointer) -> void {});
+  };
+
+  size_type
+  size() const
+  {
+    return this->m_size;
+  };
+
+  // Writes a description of the matrix of `vertices` (`blocks` is the number
+  // of blocks in a row of blocks) after the reservation and updates the header
+  //
+  template<typename I>
+  void
+  describe(
+    size_type                      element_size,
+    size_type                      vertices,
+    size_type                      blocks,
+    const std::vector<block_type>& storage,
+    const std::vector<I>&          labels,
+    const std::vector<I>&          ids,
+    const std::vector<I>&          rows)
+  {
+    std::vector<buffer_mmap_block> records;
+    records.reserve(storage.size());
+    for (auto [p, height, width, stride] : storage)
+      records.push_back(buffer_mmap_block{ this->offset_of(p), uint64_t(height), uint64_t(width), uint64_t(stride) });
+
+    std::vector<uint64_t> labels_records(labels.begin(), labels.end());
+    std::vector<uint64_t> ids_records(ids.begin(), ids.end());
+    std::vector<uint64_t> rows_records(rows.begin(), rows.end());
+
+    auto h = this->header();
+
+    h->element_size  = uint64_t(element_size);
+    h->vertices      = uint64_t(vertices);
+    h->blocks        = uint64_t(blocks);
+    h->blocks_count  = uint64_t(records.size());
+    h->blocks_offset = uint64_t(this->m_mapping_size);
+    h->labels_count  = uint64_t(labels_records.size());
+    h->labels_offset = h->blocks_offset + h->blocks_count * sizeof(buffer_mmap_block);
+    h->ids_count     = uint64_t(ids_records.size());
+    h->ids_offset    = h->labels_offset + h->labels_count * sizeof(uint64_t);
+    h->rows_count    = uint64_t(rows_records.size());
+    h->rows_offset   = h->ids_offset + h->ids_count * sizeof(uint64_t);
+
+    this->write_at(records.data(), records.size() * sizeof(buffer_mmap_block), size_type(h->blocks_offset));
+    this->write_at(labels_records.data(), labels_records.size() * sizeof(uint64_t), size_type(h->labels_offset));
+    this->write_at(ids_records.data(), ids_records.size() * sizeof(uint64_t), size_type(h->ids_offset));
+    this->write_at(rows_records.data(), rows_records.size() * sizeof(uint64_t), size_type(h->rows_offset));
+  };
+
+  // Flushes the mapping (and the description) to the file
+  //
+  void
+  sync()
+  {
+    if (::msync(this->m_mapping, this->m_mapping_size, MS_SYNC) != 0 || ::fsync(this->m_fd) != 0)
+      throw std::runtime_error("erro: can't flush the mapped reservation to the file");
+  };
+};
+
+} // namespace memory
+} // namespace utilz
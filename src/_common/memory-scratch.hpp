@@ -0,0 +1,298 @@
+#pragma once
+
+// global includes
+//
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+
+#ifdef _OPENMP
+  #include <omp.h>
+#endif
+
+#if defined(__linux__) || defined(__APPLE__)
+  #include <unistd.h>
+#endif
+
+// local includes
+//
+#include "memory.hpp"
+#include "matrix-stride.hpp"
+
+namespace utilz {
+namespace memory {
+
+// ---
+// Forward declarations
+//
+
+template<typename T>
+class scratch_context;
+
+template<typename T>
+class scratch_arena;
+
+//
+// Forward declarations
+// ---
+
+namespace impl {
+
+inline size_t
+page_size()
+{
+  static const size_t size = []() -> size_t {
+#if defined(__linux__) || defined(__APPLE__)
+    if (auto v = sysconf(_SC_PAGESIZE); v > 0)
+      return size_t(v);
+#endif
+    return size_t(4096);
+  }();
+  return size;
+};
+
+inline size_t
+round_up(size_t value, size_t multiple)
+{
+  return (value + multiple - size_t(1)) / multiple * multiple;
+};
+
+} // namespace impl
+
+// A view of scratch arrays of a single worker
+//
+template<typename T>
+class scratch_context
+{
+public:
+  using value_type = T;
+  using pointer    = T*;
+  using size_type  = size_t;
+
+private:
+  char*     m_base;
+  size_type m_array_bytes;
+
+public:
+  scratch_context(char* base, size_type array_bytes)
+    : m_base(base)
+    , m_array_bytes(array_bytes)
+  {
+  }
+
+  pointer
+  array(size_type index) const
+  {
+    return reinterpret_cast<pointer>(this->m_base + index * this->m_array_bytes);
+  }
+};
+
+// Scratch arrays of workers of a parallel team. Every worker owns `arrays`
+// arrays of `length` elements, every array starts at a cache line and arrays of
+// different workers are on different pages. The arena is sized from the team
+// size (and not from the number of cores), so every worker of the team gets its
+// own arrays.
+//
+// The arena has to be reserved (in `up`) with the same number of threads as
+// the parallel regions, which use it (i.e. the number of threads can't be
+// increased in between). Otherwise `context` aborts, because it is called from
+// parallel regions and tasks, where an exception can't be propagated.
+//
+// Arrays of every worker are initialized by the worker itself, so with the
+// first-touch policy (and threads bound to places, see OMP_PROC_BIND) their
+// pages are committed on the node of the worker.
+//
+template<typename T>
+class scratch_arena
+{
+public:
+  using value_type   = T;
+  using pointer      = T*;
+  using size_type    = size_t;
+  using context_type = scratch_context<T>;
+
+private:
+  buffer*         m_buffer;
+  buffer::pointer m_memory;
+  size_type       m_size;
+
+  char* m_base;
+
+  size_type m_workers;
+  size_type m_array_bytes;
+  size_type m_worker_bytes;
+
+private:
+  static size_type
+  array_bytes(size_type length)
+  {
+    return impl::round_up(
+      (std::max)(length, size_type(1)) * sizeof(T),
+      (std::max)(matrices::stride::get_cache_geometry().line, alignof(T)));
+  };
+
+  static size_type
+  worker_bytes(size_type arrays, size_type length)
+  {
+    return impl::round_up(arrays * array_bytes(length), impl::page_size());
+  };
+
+public:
+  // Returns a size of the team, which runs the next parallel region
+  //
+  static size_type
+  team_size()
+  {
+#ifdef _OPENMP
+    return size_type(omp_get_max_threads());
+#else
+    return size_type(1);
+#endif
+  };
+
+  // Returns a size (in bytes) of the allocation made by `reserve`
+  //
+  static size_type
+  required_bytes(size_type arrays, size_type length, size_type workers = team_size())
+  {
+    return workers * worker_bytes(arrays, length) + impl::page_size();
+  };
+
+public:
+  scratch_arena()
+    : m_buffer(nullptr)
+    , m_memory(nullptr)
+    , m_size(size_type(0))
+    , m_base(nullptr)
+    , m_workers(size_type(0))
+    , m_array_bytes(size_type(0))
+    , m_worker_bytes(size_type(0))
+  {
+  }
+
+  scratch_arena(const scratch_arena&) = delete;
+
+  scratch_arena&
+  operator=(const scratch_arena&) = delete;
+
+  scratch_arena(scratch_arena&& other) noexcept
+    : scratch_arena()
+  {
+    this->swap(other);
+  }
+
+  scratch_arena&
+  operator=(scratch_arena&& other) noexcept
+  {
+    if (this != &other) {
+      this->release();
+      this->swap(other);
+    }
+    return *this;
+  }
+
+  ~scratch_arena()
+  {
+    this->release();
+  }
+
+  // Allocates `arrays` arrays of `length` elements for every worker of the
+  // team from `b` and fills them with `value`
+  //
+  void
+  reserve(buffer& b, size_type arrays, size_type length, value_type value)
+  {
+    this->release();
+
+    const auto page = impl::page_size();
+
+    this->m_workers      = team_size();
+    this->m_array_bytes  = array_bytes(length);
+    this->m_worker_bytes = worker_bytes(arrays, length);
+
+    this->m_buffer = &b;
+    this->m_size   = required_bytes(arrays, length, this->m_workers);
+    this->m_memory = b.allocate(this->m_size);
+
+    auto address = reinterpret_cast<std::uintptr_t>(this->m_memory);
+    this->m_base = this->m_memory + (impl::round_up(address, page) - address);
+
+    const auto base    = this->m_base;
+    const auto workers = this->m_workers;
+    const auto stride  = this->m_worker_bytes;
+    const auto count   = this->m_worker_bytes / sizeof(T);
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static, 1) num_threads(int(workers)) default(none) firstprivate(base, workers, stride, count, value)
+#endif
+    for (auto w = size_type(0); w < workers; ++w)
+      std::fill_n(reinterpret_cast<pointer>(base + w * stride), count, value);
+  };
+
+  void
+  release()
+  {
+    if (this->m_memory == nullptr)
+      return;
+
+    this->m_buffer->deallocate(this->m_memory, this->m_size);
+
+    this->m_buffer = nullptr;
+    this->m_memory = nullptr;
+    this->m_size   = size_type(0);
+    this->m_base   = nullptr;
+  };
+
+  void
+  swap(scratch_arena& other) noexcept
+  {
+    std::swap(this->m_buffer, other.m_buffer);
+    std::swap(this->m_memory, other.m_memory);
+    std::swap(this->m_size, other.m_size);
+    std::swap(this->m_base, other.m_base);
+    std::swap(this->m_workers, other.m_workers);
+    std::swap(this->m_array_bytes, other.m_array_bytes);
+    std::swap(this->m_worker_bytes, other.m_worker_bytes);
+  };
+
+  size_type
+  workers() const
+  {
+    return this->m_workers;
+  }
+
+  // Returns arrays of `worker`
+  //
+  context_type
+  context(size_type worker) const
+  {
+    if (worker >= this->m_workers) {
+      std::fprintf(
+        stderr,
+        "erro: the worker %zu doesn't have scratch arrays, the arena is reserved for %zu workers (the team is larger than the reserved one)\n",
+        worker,
+        this->m_workers);
+      std::abort();
+    }
+
+    return context_type(this->m_base + worker * this->m_worker_bytes, this->m_array_bytes);
+  };
+
+  // Returns arrays of the calling worker
+  //
+  context_type
+  context() const
+  {
+#ifdef _OPENMP
+    return this->context(size_type(omp_get_thread_num()));
+#else
+    return this->context(size_type(0));
+#endif
+  };
+};
+
+} // namespace memory
+} // namespace utilz
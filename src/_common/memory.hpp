@@ -3,17 +3,19 @@
 // global includes
 //
 #include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <new>
 #include <stdexcept>
+#include <unordered_map>
 #include <vector>
 #include <utility>
 
-#ifdef __clang__
-#define _aligned_malloc aligned_alloc
-#define _aligned_free   free
-#endif
-
 namespace utilz {
 namespace memory {
 
@@ -106,7 +108,7 @@ public:
     if (this->m_buffer == nullptr)
       throw std::logic_error("erro: the allocator wasn't initialized with memory buffer");
 
-    this->m_buffer->deallocate(reinterpret_cast<char*>(p), sz);
+    this->m_buffer->deallocate(reinterpret_cast<char*>(p), sz * sizeof(value_type));
   };
 
   inline size_type
@@ -147,7 +149,41 @@ public:
   };
 };
 
-class buffer_fx : public buffer
+// Statistics of a buffer (all values are in bytes):
+//
+// - `reserved`, memory carved from the reservation (including memory which is
+//   kept in free lists and unused tails of threads chunks)
+// - `used`, memory which is currently allocated
+// - `peak`, the maximum of `used`
+//
+struct buffer_statistics
+{
+  std::size_t reserved;
+  std::size_t used;
+  std::size_t peak;
+
+  // Returns a fraction of reserved memory, which isn't used
+  //
+  double
+  fragmentation() const
+  {
+    return this->reserved == std::size_t(0) ? 0.0 : double(this->reserved - this->used) / double(this->reserved);
+  };
+};
+
+// A thread-safe arena. Small allocations (up to 4KB) are rounded up to a power
+// of two size class and served from free lists of the class or from a chunk
+// owned by the calling thread (chunks are carved from the shared reservation).
+// Larger allocations (i.e. matrices and blocks, which are padded to their own
+// leading dimension and live as long as the matrix) are bumped from the
+// reservation with their exact size (rounded up to the alignment only) and
+// freed ones are reused by allocations of the same size.
+//
+// The reservation is either a memory provided by the caller (the arena throws
+// when it is exhausted) or it grows with regions of dynamic memory (which are
+// released when the arena is destroyed).
+//
+class buffer_arena : public buffer
 {
 public:
   using value_type      = typename buffer::value_type;
@@ -157,148 +193,374 @@ public:
   using difference_type = typename buffer::difference_type;
 
 private:
+  static constexpr size_type chunk_size    = size_type(64) << 10;
+  static constexpr size_type region_size   = size_type(64) << 20;
+  static constexpr size_type slots_count   = size_type(64);
+  static constexpr size_type classes_limit = size_type(4) << 10;
+
+  struct region
+  {
+    pointer   base;
+    size_type size;
+    size_type top;
+  };
+
+  struct alignas(64) slot
+  {
+    std::atomic_flag lock;
+    pointer          cur = nullptr;
+    pointer          end = nullptr;
+  };
+
+  struct alignas(64) size_class
+  {
+    std::mutex           mutex;
+    std::atomic<size_t>  count = size_t(0);
+    std::vector<pointer> items;
+  };
+
   size_type                   m_alignment;
-  size_type                   m_size;
+  bool                        m_growing;
   std::shared_ptr<value_type> m_mem;
 
-  pointer m_cmem;
+  std::mutex                             m_mutex;
+  std::vector<region>                    m_regions;
+  std::multimap<size_type, pointer>      m_large;
+  std::unordered_map<pointer, size_type> m_large_live;
+  std::unique_ptr<slot[]>                m_slots;
+  std::unique_ptr<size_class[]>          m_classes;
+  size_type                              m_classes_count;
 
-public:
-  buffer_fx()
-    : m_alignment(size_type())
-    , m_size(size_type())
-    , m_mem(nullptr)
-    , m_cmem(nullptr)
+  std::atomic<size_type> m_reserved;
+  std::atomic<size_type> m_used;
+  std::atomic<size_type> m_peak;
+
+  static size_type
+  thread_index()
   {
-  }
-  buffer_fx(std::shared_ptr<value_type> memory, size_type size, size_type alignment)
-    : m_alignment(alignment)
-    , m_size(size)
-    , m_mem(memory)
-    , m_cmem(memory.get())
+    static std::atomic<size_type> counter(size_type(0));
+    static thread_local size_type index = counter.fetch_add(size_type(1), std::memory_order_relaxed);
+    return index;
+  };
+
+  // Returns an index of a size class of `size`, the smallest class is the
+  // alignment of the arena
+  //
+  size_type
+  class_of(size_type size) const
   {
-    if (alignment % 2 != 0)
-      throw std::invalid_argument("erro: the alignment value has to be a power of 2");
-  }
+    auto c = size_type(0);
+    while ((this->m_alignment << c) < size)
+      ++c;
+    return c;
+  };
 
-  inline pointer
-  allocate(size_type size)
+  void
+  account(size_type size)
   {
-    void* p;
-    if (this->m_alignment != 0) {
-      p = reinterpret_cast<void*>(this->m_cmem);
-      if (!std::align(this->m_alignment, size, p, this->m_size))
-        throw std::runtime_error("erro: not enough memory in buffer");
+    const auto used = this->m_used.fetch_add(size, std::memory_order_relaxed) + size;
 
-      // Update current to aligned value, which is going to be returned
-      //
-      this->m_cmem = reinterpret_cast<pointer>(p);
-    } else {
-      p = this->m_cmem;
-    }
+    auto peak = this->m_peak.load(std::memory_order_relaxed);
+    while (used > peak && !this->m_peak.compare_exchange_weak(peak, used, std::memory_order_relaxed))
+      ;
+  };
+
+  // Carves `size` bytes aligned to `alignment` from the reservation
+  //
+  pointer
+  carve(size_type size, size_type alignment)
+  {
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+
+    for (;;) {
+      if (!this->m_regions.empty()) {
+        auto& r = this->m_regions.back();
+
+        void* p     = r.base + r.top;
+        auto  space = r.size - r.top;
+        if (std::align(alignment, size, p, space)) {
+          const auto top = size_type(reinterpret_cast<pointer>(p) - r.base) + size;
+
+          this->m_reserved.fetch_add(top - r.top, std::memory_order_relaxed);
+
+          r.top = top;
+          return reinterpret_cast<pointer>(p);
+        }
+      }
 
-    if (size > this->m_size)
-      throw std::runtime_error("erro: not enough memory in buffer");
+      if (!this->m_growing)
+        throw std::runtime_error("erro: not enough memory in buffer");
 
-    this->m_size = this->m_size - size;
-    this->m_cmem = this->m_cmem + size;
+      const auto rsize = (std::max)(region_size, size + alignment);
+      const auto rbase = reinterpret_cast<pointer>(::operator new(rsize, std::align_val_t(this->m_alignment)));
 
-    return reinterpret_cast<pointer>(p);
+      this->m_regions.push_back(region{ rbase, rsize, size_type(0) });
+    }
   };
-  inline void
-    deallocate(pointer, size_type){
-      // There is no need for complex rent-return semantic, all we need is
-      // a C++ way to allocate memory from previously reserved buffer
-      //
-    };
 
-  inline bool
-  operator==(buffer_fx const& a)
+  pointer
+  allocate_small(size_type c)
   {
-    return this == &a || (this->m_mem == a.m_mem && this->m_size == a.m_size);
+    const auto size = this->m_alignment << c;
+
+    auto& sc = this->m_classes[c];
+    if (sc.count.load(std::memory_order_relaxed) != size_t(0)) {
+      std::lock_guard<std::mutex> lock(sc.mutex);
+      if (!sc.items.empty()) {
+        auto p = sc.items.back();
+
+        sc.items.pop_back();
+        sc.count.store(sc.items.size(), std::memory_order_relaxed);
+        return p;
+      }
+    }
+
+    auto& s = this->m_slots[thread_index() % slots_count];
+    while (s.lock.test_and_set(std::memory_order_acquire))
+      ;
+
+    pointer p = nullptr;
+    try {
+      if (s.cur == nullptr || size_type(s.end - s.cur) < size) {
+        s.cur = this->carve(chunk_size, this->m_alignment);
+        s.end = s.cur + chunk_size;
+      }
+      p = s.cur;
+
+      s.cur += size;
+    } catch (...) {
+      s.lock.clear(std::memory_order_release);
+      throw;
+    }
+    s.lock.clear(std::memory_order_release);
+
+    return p;
   };
-  inline bool
-  operator!=(buffer_fx const& a)
+
+  // Returns a large block of exactly `size` bytes, either a freed one of the
+  // same size or a new one bumped from the reservation
+  //
+  pointer
+  allocate_large(size_type size, size_type alignment)
   {
-    return !operator==(a);
+    {
+      std::lock_guard<std::mutex> lock(this->m_mutex);
+
+      auto [first, last] = this->m_large.equal_range(size);
+      for (auto it = first; it != last; ++it) {
+        if (reinterpret_cast<uintptr_t>(it->second) % alignment == uintptr_t(0)) {
+          auto p = it->second;
+
+          this->m_large.erase(it);
+          this->m_large_live.emplace(p, size);
+          return p;
+        }
+      }
+    }
+
+    auto p = this->carve(size, alignment);
+    {
+      std::lock_guard<std::mutex> lock(this->m_mutex);
+      this->m_large_live.emplace(p, size);
+    }
+    return p;
   };
-};
 
-class buffer_dyn : public buffer
-{
 public:
-  using value_type      = typename buffer::value_type;
-  using pointer         = typename buffer::pointer;
-  using const_pointer   = typename buffer::const_pointer;
-  using size_type       = typename buffer::size_type;
-  using difference_type = typename buffer::difference_type;
+  // Creates an arena, which grows with regions of dynamic memory
+  //
+  explicit buffer_arena(size_type alignment = size_type(0))
+    : m_alignment((std::max)(alignment, size_type(alignof(std::max_align_t))))
+    , m_growing(true)
+    , m_mem(nullptr)
+    , m_reserved(size_type(0))
+    , m_used(size_type(0))
+    , m_peak(size_type(0))
+  {
+    this->init();
+  }
 
-private:
-  std::vector<pointer> m_allocations;
+  // Creates an arena over `size` bytes of `memory`
+  //
+  buffer_arena(std::shared_ptr<value_type> memory, size_type size, size_type alignment)
+    : m_alignment((std::max)(alignment, size_type(alignof(std::max_align_t))))
+    , m_growing(false)
+    , m_mem(memory)
+    , m_reserved(size_type(0))
+    , m_used(size_type(0))
+    , m_peak(size_type(0))
+  {
+    this->init();
 
-  size_type m_alignment;
+    this->m_regions.push_back(region{ memory.get(), size, size_type(0) });
+  }
 
-public:
-  buffer_dyn()
-    : m_alignment(size_type())
+  buffer_arena(const buffer_arena&) = delete;
+
+  buffer_arena&
+  operator=(const buffer_arena&) = delete;
+
+  ~buffer_arena()
   {
-  }
-  ~buffer_dyn()
-  {
-    std::for_each(
-      this->m_allocations.begin(),
-      this->m_allocations.end(),
-      [this](pointer p) -> void {
-        this->_deallocate(p, 0);
-      });
+    if (this->m_growing)
+      for (auto& r : this->m_regions)
+        ::operator delete(r.base, std::align_val_t(this->m_alignment));
   }
 
 private:
-  inline void
-  _deallocate(pointer p, size_type)
+  void
+  init()
   {
-    if (this->m_alignment != 0) {
-      _aligned_free(p);
-    } else {
-      free(p);
-    }
+    if ((this->m_alignment & (this->m_alignment - size_type(1))) != size_type(0))
+      throw std::invalid_argument("erro: the alignment value has to be a power of 2");
+
+    this->m_classes_count = this->class_of(classes_limit) + size_type(1);
+
+    this->m_slots   = std::make_unique<slot[]>(slots_count);
+    this->m_classes = std::make_unique<size_class[]>(this->m_classes_count);
   };
 
 public:
   inline pointer
   allocate(size_type size)
   {
+    return this->allocate(size, this->m_alignment);
+  };
+
+  // Allocates `size` bytes aligned to `alignment` (a power of two)
+  //
+  inline pointer
+  allocate(size_type size, size_type alignment)
+  {
+    if ((alignment & (alignment - size_type(1))) != size_type(0))
+      throw std::invalid_argument("erro: the alignment value has to be a power of 2");
+
+    if (size == size_type(0))
+      size = size_type(1);
+
+    // Small allocations with an alignment stronger than the one of the arena
+    // are carved as a whole block of the class (so they can be reused through
+    // free lists of the class)
+    //
     pointer p;
-    if (this->m_alignment != 0) {
-      p = reinterpret_cast<pointer>(_aligned_malloc(size, this->m_alignment));
+    if (size <= classes_limit) {
+      const auto c = this->class_of(size);
+
+      p = alignment <= this->m_alignment
+        ? this->allocate_small(c)
+        : this->carve(this->m_alignment << c, alignment);
+
+      this->account(this->m_alignment << c);
     } else {
-      p = reinterpret_cast<pointer>(malloc(size));
+      size = (size + this->m_alignment - size_type(1)) / this->m_alignment * this->m_alignment;
+
+      p = this->allocate_large(size, (std::max)(alignment, this->m_alignment));
+      this->account(size);
     }
+    return p;
+  };
+
+  // Returns memory to the arena, `size` has to be the size requested from
+  // `allocate`
+  //
+  inline void
+  deallocate(pointer p, size_type size)
+  {
     if (p == nullptr)
-      throw std::runtime_error("erro: can't allocate dynamic memory");
+      return;
+
+    if (size == size_type(0))
+      size = size_type(1);
+
+    if (size <= classes_limit) {
+      const auto c = this->class_of(size);
+
+      auto& sc = this->m_classes[c];
+      {
+        std::lock_guard<std::mutex> lock(sc.mutex);
 
-    this->m_allocations.push_back(p);
+        sc.items.push_back(p);
+        sc.count.store(sc.items.size(), std::memory_order_relaxed);
+      }
+      this->m_used.fetch_sub(this->m_alignment << c, std::memory_order_relaxed);
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(this->m_mutex);
+
+      auto it = this->m_large_live.find(p);
+      if (it == this->m_large_live.end())
+        throw std::logic_error("erro: the pointer wasn't allocated from the buffer");
+
+      size = it->second;
 
-    return reinterpret_cast<pointer>(p);
+      this->m_large_live.erase(it);
+      this->m_large.emplace(size, p);
+    }
+    this->m_used.fetch_sub(size, std::memory_order_relaxed);
   };
-  inline void
-  deallocate(pointer p, size_type)
-  {
-    auto it = std::find(this->m_allocations.begin(), this->m_allocations.end(), p);
-    if (it != this->m_allocations.end()) {
-      this->m_allocations.erase(it);
 
-      this->_deallocate(p, 0);
+  // Returns a size of the reservation (in bytes), which is enough to serve
+  // `requests` (sizes in bytes) when the arena is created with `alignment`.
+  // Requests can be made by any number of threads, every thread carves its
+  // own chunk for small allocations, so a partially used chunk of every slot
+  // is added on top of requests made one after another
+  //
+  static size_type
+  reservation(const std::vector<size_type>& requests, size_type alignment)
+  {
+    alignment = (std::max)(alignment, size_type(alignof(std::max_align_t)));
+
+    // Every carve from the reservation can be padded to the alignment
+    //
+    const auto padding = alignment - size_type(1);
+
+    auto total = size_type(0);
+    auto space = size_type(0);
+    auto chunked = false;
+    for (auto size : requests) {
+      size = (std::max)(size, size_type(1));
+      if (size <= classes_limit) {
+        chunked = true;
+
+        auto csize = alignment;
+        while (csize < size)
+          csize <<= 1;
+
+        if (space < csize) {
+          total += chunk_size + padding;
+          space  = chunk_size;
+        }
+        space -= csize;
+      } else {
+        total += (size + alignment - size_type(1)) / alignment * alignment + padding;
+      }
     }
+
+    if (chunked)
+      total += slots_count * (chunk_size + padding);
+
+    return total;
+  };
+
+  buffer_statistics
+  statistics() const
+  {
+    return buffer_statistics{
+      this->m_reserved.load(std::memory_order_relaxed),
+      this->m_used.load(std::memory_order_relaxed),
+      this->m_peak.load(std::memory_order_relaxed)
+    };
   };
 
   inline bool
-  operator==(buffer_dyn const& a)
+  operator==(buffer_arena const& a)
   {
-    return this->m_alignment == a.m_alignment;
+    return this == &a;
   };
   inline bool
-  operator!=(buffer_dyn const& a)
+  operator!=(buffer_arena const& a)
   {
     return !operator==(a);
   };
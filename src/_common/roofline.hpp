@@ -0,0 +1,416 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#ifdef _OPENMP
+  #include <omp.h>
+#endif
+
+#ifdef __linux__
+  #include <unistd.h>
+#endif
+
+#include "portables/hacks/defines.h"
+
+#include "constants.hpp"
+#include "matrix.hpp"
+#include "matrix-traits.hpp"
+
+namespace utilz {
+namespace roofline {
+
+// ---
+// Forward declarations
+//
+
+struct phase;
+
+using counters = std::map<std::string, phase>;
+
+//
+// Forward declarations
+// ---
+
+// Number of min-plus relaxations (`ij = min(ij, ik + kj)`) and number of bytes
+// moved to and from memory by a phase of an algorithm.
+//
+// The amount of bytes is a model, which assumes every block (or matrix in case
+// of flat algorithms) is loaded once and (if updated) stored once per
+// invocation of the phase, i.e. it ignores cache reuse between invocations.
+// This makes it a streaming upper bound, which is limited by the footprint
+// of the matrix when the matrix fits into the last level cache (see
+// `limit_to_footprint`).
+//
+struct phase
+{
+  uint64_t relaxations;
+  uint64_t bytes;
+};
+
+namespace impl {
+
+template<typename T>
+__hack_noinline
+T
+peak_relaxations_kernel(T* ij, T* ik, T* kj, size_t x)
+{
+  for (auto k = size_t(0); k < x; ++k)
+    for (auto i = size_t(0); i < x; ++i)
+      __hack_ivdep
+      for (auto j = size_t(0); j < x; ++j)
+        ij[i * x + j] = (std::min)(ij[i * x + j], ik[i * x + k] + kj[k * x + j]);
+
+  return ij[0];
+};
+
+template<typename T>
+__hack_noinline
+T
+peak_bandwidth_kernel(T* a, T* b, size_t n)
+{
+  __hack_ivdep
+  for (auto i = size_t(0); i < n; ++i)
+    a[i] = (std::min)(a[i], b[i] + T(1));
+
+  return a[0];
+};
+
+} // namespace impl
+
+// Returns the size (in bytes) of the last level cache or `0` if it can't be
+// determined on the current platform
+//
+inline uint64_t
+last_level_cache_bytes()
+{
+#ifdef __linux__
+  #ifdef _SC_LEVEL3_CACHE_SIZE
+  if (auto l3 = sysconf(_SC_LEVEL3_CACHE_SIZE); l3 > 0)
+    return uint64_t(l3);
+  #endif
+  #ifdef _SC_LEVEL2_CACHE_SIZE
+  if (auto l2 = sysconf(_SC_LEVEL2_CACHE_SIZE); l2 > 0)
+    return uint64_t(l2);
+  #endif
+#endif
+  return uint64_t(0);
+};
+
+// Limits the amount of bytes of all phases to a single load and store of the
+// matrix `footprint` (in bytes) when the matrix fits into the last level
+// cache, because in this case only the first access to every element reaches
+// memory. The bytes are distributed between the phases proportionally to the
+// streaming model.
+//
+inline void
+limit_to_footprint(
+  counters& c,
+  uint64_t  footprint)
+{
+  const auto cache = last_level_cache_bytes();
+  if (cache == uint64_t(0) || footprint > cache)
+    return;
+
+  auto bytes = uint64_t(0);
+  for (auto& [name, p] : c)
+    bytes += p.bytes;
+
+  const auto limit = footprint * uint64_t(2);
+  if (bytes <= limit)
+    return;
+
+  for (auto& [name, p] : c)
+    p.bytes = uint64_t((long double)(p.bytes) * (long double)(limit) / (long double)(bytes));
+};
+
+// Measures peak min-plus throughput (relaxations per second) of the machine
+// using a kernel working on a cache resident blocks (each thread has its own
+// set of blocks).
+//
+template<typename T>
+double
+measure_peak_relaxations()
+{
+  const auto x = size_t(64);
+  const auto r = size_t(256);
+
+  auto threads = 1;
+  auto start   = std::chrono::high_resolution_clock::now();
+
+#ifdef _OPENMP
+  #pragma omp parallel default(none) shared(threads, x, r)
+#endif
+  {
+#ifdef _OPENMP
+  #pragma omp single
+    threads = omp_get_num_threads();
+#endif
+
+    std::vector<T> ij(x * x, T(1)), ik(x * x, T(2)), kj(x * x, T(3));
+
+    volatile T sink = T(0);
+    for (auto i = size_t(0); i < r; ++i)
+      sink = impl::peak_relaxations_kernel(ij.data(), ik.data(), kj.data(), x);
+
+    (void)sink;
+  }
+
+  auto stop    = std::chrono::high_resolution_clock::now();
+  auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(stop - start).count();
+
+  return double(x * x * x) * double(r) * double(threads) / elapsed;
+};
+
+// Measures peak memory bandwidth (bytes per second) of the machine using a
+// stream-style kernel (two reads and one write per element), which resembles
+// memory access pattern of the min-plus relaxation.
+//
+template<typename T>
+double
+measure_peak_bandwidth()
+{
+  const auto n = size_t(32) * size_t(1024) * size_t(1024);
+  const auto r = 5;
+
+  std::vector<T> a(n, T(2)), b(n, T(1));
+
+  auto best = double(0);
+  for (auto k = 0; k < r; ++k) {
+    auto start = std::chrono::high_resolution_clock::now();
+
+#ifdef _OPENMP
+  #pragma omp parallel default(none) shared(a, b, n)
+#endif
+    {
+#ifdef _OPENMP
+      auto count = n / size_t(omp_get_num_threads());
+      auto shift = count * size_t(omp_get_thread_num());
+      if (omp_get_thread_num() == omp_get_num_threads() - 1)
+        count = n - shift;
+#else
+      auto count = n;
+      auto shift = size_t(0);
+#endif
+      impl::peak_bandwidth_kernel(a.data() + shift, b.data() + shift, count);
+    }
+
+    auto stop    = std::chrono::high_resolution_clock::now();
+    auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(stop - start).count();
+
+    best = (std::max)(best, double(size_t(3) * n * sizeof(T)) / elapsed);
+  }
+  return best;
+};
+
+// Flat matrix (Floyd-Warshall): `n` iterations, each of them relaxes and
+// streams the whole matrix
+//
+template<typename T, typename A>
+counters
+count(
+  ::utilz::matrices::square_matrix<T, A>& matrix)
+{
+  const auto n = uint64_t(matrix.size());
+
+  counters c;
+  c["EXEC"] = phase{ n * n * n, n * n * n * uint64_t(2 * sizeof(T)) };
+
+  limit_to_footprint(c, n * n * uint64_t(sizeof(T)));
+
+  return c;
+};
+
+// Blocked Floyd-Warshall over `n * n` matrix of `T` split into blocks of `b`
+// (the last row and column of blocks are counted as full blocks): every
+// iteration over diagonal block `m` processes a diagonal block, a row and
+// column of blocks and all peripheral blocks
+//
+template<typename T>
+counters
+count_blocks(
+  uint64_t n,
+  uint64_t b)
+{
+  const auto s = b == uint64_t(0) ? uint64_t(0) : (n + b - uint64_t(1)) / b;
+
+  const auto block_relaxations = b * b * b;
+  const auto block_bytes       = b * b * uint64_t(sizeof(T));
+
+  const auto e = s == uint64_t(0) ? uint64_t(0) : s - uint64_t(1);
+
+  counters c;
+  c["DIAG"] = phase{ s * block_relaxations, s * uint64_t(2) * block_bytes };
+  c["VERT"] = phase{ s * e * block_relaxations, s * e * uint64_t(3) * block_bytes };
+  c["HORZ"] = phase{ s * e * block_relaxations, s * e * uint64_t(3) * block_bytes };
+  c["PERH"] = phase{ s * e * e * block_relaxations, s * e * e * uint64_t(4) * block_bytes };
+
+  limit_to_footprint(c, s * s * block_bytes);
+
+  return c;
+};
+
+// Blocked matrix
+//
+template<typename T, typename A, typename U>
+counters
+count(
+  ::utilz::matrices::square_matrix<::utilz::matrices::square_matrix<T, A>, U>& matrix)
+{
+  const auto s = uint64_t(matrix.size());
+  const auto b = s == uint64_t(0) ? uint64_t(0) : uint64_t(matrix.at(0, 0).size());
+
+  return count_blocks<T>(s * b, b);
+};
+
+// Clustered matrix: the diagonal blocks are fully processed, while the rest
+// of the blocks are relaxed only through bridges positions, which are provided
+// by `positions` function as a tuple of (vertical, horizontal, peripheral)
+// bridges count for a diagonal block `m`
+//
+template<typename T, typename A, typename U, typename F>
+counters
+count(
+  ::utilz::matrices::square_matrix<::utilz::matrices::rect_matrix<T, A>, U>& matrix,
+  F                                                                          positions)
+{
+  const auto s = uint64_t(sizeof(T));
+
+  auto footprint = uint64_t(0);
+
+  counters c = {
+    { "DIAG", phase{ 0, 0 } },
+    { "VERT", phase{ 0, 0 } },
+    { "HORZ", phase{ 0, 0 } },
+    { "PERH", phase{ 0, 0 } }
+  };
+
+  for (auto m = size_t(0); m < matrix.size(); ++m) {
+    auto& mm = matrix.at(m, m);
+
+    const auto x = uint64_t(mm.height());
+
+    c["DIAG"].relaxations += x * x * x;
+    c["DIAG"].bytes       += x * x * s * uint64_t(2);
+
+    auto [vert, horz, perh] = positions(m);
+
+    for (auto i = size_t(0); i < matrix.size(); ++i) {
+      if (i == m)
+        continue;
+
+      auto& im = matrix.at(i, m);
+      auto& mi = matrix.at(m, i);
+
+      // Vertical block `im` is updated using bridge rows of `mm`,
+      // horizontal block `mi` is updated using bridge columns of `mm`
+      //
+      const auto im_size = uint64_t(im.height()) * uint64_t(im.width());
+      const auto mi_size = uint64_t(mi.height()) * uint64_t(mi.width());
+
+      c["VERT"].relaxations += im_size * uint64_t(vert);
+      c["VERT"].bytes       += vert == 0 ? uint64_t(0) : (im_size * uint64_t(2) + uint64_t(vert) * x) * s;
+      c["HORZ"].relaxations += mi_size * uint64_t(horz);
+      c["HORZ"].bytes       += horz == 0 ? uint64_t(0) : (mi_size * uint64_t(2) + uint64_t(horz) * x) * s;
+
+      if (perh == 0)
+        continue;
+
+      for (auto j = size_t(0); j < matrix.size(); ++j) {
+        if (j == m)
+          continue;
+
+        auto& ij = matrix.at(i, j);
+
+        const auto ij_size = uint64_t(ij.height()) * uint64_t(ij.width());
+
+        c["PERH"].relaxations += ij_size * uint64_t(perh);
+        c["PERH"].bytes       += (ij_size * uint64_t(2) + uint64_t(perh) * (uint64_t(ij.height()) + uint64_t(ij.width()))) * s;
+      }
+    }
+  }
+
+  for (auto i = size_t(0); i < matrix.size(); ++i)
+    for (auto j = size_t(0); j < matrix.size(); ++j)
+      footprint += uint64_t(matrix.at(i, j).height()) * uint64_t(matrix.at(i, j).width()) * s;
+
+  limit_to_footprint(c, footprint);
+
+  return c;
+};
+
+// Prints achieved throughput of the algorithm (executed in `exec_ms`) along
+// with per phase relaxations, bytes and arithmetic intensity and compares
+// them to the measured machine peak. Phases, which have their execution time
+// in `seconds` (see `SCOPE_MEASURE_MILLISECONDS`), also print their achieved
+// throughput and its fraction of the phase roof. The only phase of flat
+// algorithms takes the whole execution time.
+//
+template<typename T>
+void
+print_roofline(
+  std::ostream&                        os,
+  const counters&                      c,
+  int64_t                              exec_ms,
+  const std::map<std::string, double>& seconds = {})
+{
+  auto peak_relaxations = measure_peak_relaxations<T>();
+  auto peak_bandwidth   = measure_peak_bandwidth<T>();
+
+  // The ridge point is arithmetic intensity (relaxations per byte) at which
+  // kernel stops being bandwidth bound and becomes compute bound
+  //
+  auto ridge = peak_relaxations / peak_bandwidth;
+
+  os << "R/PK: " << peak_relaxations / 1e9 << " Grelax/s" << std::endl;
+  os << "R/BW: " << peak_bandwidth / 1e9 << " GB/s" << std::endl;
+  os << "R/RG: " << ridge << " relax/byte" << std::endl;
+  os << "R/LC: " << last_level_cache_bytes() << " bytes (matrices, which don't fit, are counted as streamed)" << std::endl;
+
+  auto relaxations = uint64_t(0);
+  auto bytes       = uint64_t(0);
+  auto timed       = true;
+  for (auto& [name, p] : c) {
+    auto intensity = p.bytes == uint64_t(0) ? 0.0 : double(p.relaxations) / double(p.bytes);
+
+    os << name << ": (Rlx): " << p.relaxations << std::endl;
+    os << name << ": (Byt): " << p.bytes << std::endl;
+    os << name << ": (Int): " << intensity << " relax/byte, " << (intensity < ridge ? "bandwidth" : "compute") << " bound" << std::endl;
+
+    auto elapsed = c.size() == size_t(1) ? double(exec_ms) / 1e3 : 0.0;
+    if (auto it = seconds.find(name); it != seconds.end())
+      elapsed = it->second;
+
+    if (elapsed > 0.0) {
+      auto roof     = (std::min)(peak_relaxations, intensity * peak_bandwidth);
+      auto achieved = double(p.relaxations) / elapsed;
+
+      os << name << ": (Ach): " << achieved / 1e9 << " Grelax/s, " << (roof == 0.0 ? 0.0 : achieved / roof * 100.0) << "% of roof" << std::endl;
+    } else if (p.relaxations != uint64_t(0)) {
+      timed = false;
+    }
+
+    relaxations += p.relaxations;
+    bytes       += p.bytes;
+  }
+
+  auto intensity = bytes == uint64_t(0) ? 0.0 : double(relaxations) / double(bytes);
+  auto roof      = (std::min)(peak_relaxations, intensity * peak_bandwidth);
+  auto achieved  = exec_ms == int64_t(0) ? 0.0 : double(relaxations) / (double(exec_ms) / 1e3);
+
+  os << "R/AC: " << achieved / 1e9 << " Grelax/s" << std::endl;
+  os << "R/RF: " << roof / 1e9 << " Grelax/s (" << (intensity < ridge ? "bandwidth" : "compute") << " bound)" << std::endl;
+  os << "R/EF: " << (roof == 0.0 ? 0.0 : achieved / roof * 100.0) << "% of roof, " << achieved / peak_relaxations * 100.0 << "% of peak" << std::endl;
+
+  if (!timed)
+    os << "R/PH: phases aren't timed, per phase throughput requires a statistics (-stats) target" << std::endl;
+};
+
+} // namespace roofline
+} // namespace utilz
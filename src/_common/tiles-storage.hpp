@@ -0,0 +1,209 @@
+#pragma once
+
+#include <cerrno>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+namespace utilz {
+namespace storage {
+
+// ---
+// Forward declarations
+//
+
+class io_pool;
+
+template<typename T>
+class tiles_file;
+
+//
+// Forward declarations
+// ---
+
+// Returns a directory to store tiles files in. The directory can be set using
+// `APSP_TILES_DIRECTORY` environment variable (i.e. to point it to a local
+// NVMe drive), otherwise `TMPDIR` or `/tmp` is used
+//
+inline std::string
+tiles_directory()
+{
+  if (auto directory = std::getenv("APSP_TILES_DIRECTORY"); directory != nullptr)
+    return std::string(directory);
+
+  if (auto directory = std::getenv("TMPDIR"); directory != nullptr)
+    return std::string(directory);
+
+  return std::string("/tmp");
+};
+
+// A fixed size pool of threads, which executes submitted I/O requests in the
+// order of submission. The result (or an error) of every request is delivered
+// through `std::future`
+//
+class io_pool
+{
+private:
+  std::vector<std::thread>               m_threads;
+  std::deque<std::packaged_task<void()>> m_requests;
+  std::mutex                             m_mutex;
+  std::condition_variable                m_condition;
+  bool                                   m_stop;
+
+  void
+  work()
+  {
+    for (;;) {
+      std::packaged_task<void()> request;
+      {
+        std::unique_lock<std::mutex> lock(this->m_mutex);
+
+        this->m_condition.wait(lock, [this] { return this->m_stop || !this->m_requests.empty(); });
+        if (this->m_requests.empty())
+          return;
+
+        request = std::move(this->m_requests.front());
+        this->m_requests.pop_front();
+      }
+      request();
+    }
+  };
+
+public:
+  explicit io_pool(size_t threads)
+    : m_stop(false)
+  {
+    if (threads == size_t(0))
+      throw std::invalid_argument("erro: the number of I/O threads has to be greater than zero");
+
+    for (auto i = size_t(0); i < threads; ++i)
+      this->m_threads.emplace_back(&io_pool::work, this);
+  };
+
+  io_pool(const io_pool&) = delete;
+
+  ~io_pool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(this->m_mutex);
+      this->m_stop = true;
+    }
+    this->m_condition.notify_all();
+
+    for (auto& thread : this->m_threads)
+      thread.join();
+  };
+
+  io_pool&
+  operator=(const io_pool&) = delete;
+
+  std::future<void>
+  submit(std::function<void()> fn)
+  {
+    std::packaged_task<void()> request(std::move(fn));
+
+    auto result = request.get_future();
+    {
+      std::lock_guard<std::mutex> lock(this->m_mutex);
+      this->m_requests.push_back(std::move(request));
+    }
+    this->m_condition.notify_one();
+
+    return result;
+  };
+};
+
+// A temporary file, which stores fixed size tiles of `T` by index. The file
+// is unlinked right after creation and therefore disappears as soon as it is
+// closed (including abnormal termination of the process).
+//
+// All operations use `pread` / `pwrite` and don't change the file offset,
+// which makes them safe to execute from multiple threads in parallel.
+//
+template<typename T>
+class tiles_file
+{
+private:
+  int    m_fd;
+  size_t m_tile_size;
+
+  template<typename F, typename P>
+  void
+  transfer(F fn, P p, size_t index, const char* error)
+  {
+    auto bytes  = this->m_tile_size * sizeof(T);
+    auto offset = off_t(index) * off_t(bytes);
+    auto cursor = p;
+
+    while (bytes != size_t(0)) {
+      auto r = fn(this->m_fd, cursor, bytes, offset);
+      if (r == -1 && errno == EINTR)
+        continue;
+
+      if (r <= 0)
+        throw std::runtime_error(error);
+
+      cursor += r;
+      bytes  -= size_t(r);
+      offset += off_t(r);
+    }
+  };
+
+public:
+  tiles_file(const std::string& directory, size_t tile_size)
+    : m_fd(-1)
+    , m_tile_size(tile_size)
+  {
+    std::string path = directory + "/apsp-tiles-XXXXXX";
+
+    std::vector<char> name(path.begin(), path.end());
+    name.push_back('\0');
+
+    this->m_fd = ::mkstemp(name.data());
+    if (this->m_fd == -1)
+      throw std::runtime_error("erro: can't create a tiles file in '" + directory + "'");
+
+    ::unlink(name.data());
+  };
+
+  tiles_file(const tiles_file&) = delete;
+
+  ~tiles_file()
+  {
+    if (this->m_fd != -1)
+      ::close(this->m_fd);
+  };
+
+  tiles_file&
+  operator=(const tiles_file&) = delete;
+
+  size_t
+  tile_size() const noexcept
+  {
+    return this->m_tile_size;
+  };
+
+  void
+  read(size_t index, T* tile)
+  {
+    this->transfer(::pread, reinterpret_cast<char*>(tile), index, "erro: can't read a tile from the tiles file");
+  };
+
+  void
+  write(size_t index, const T* tile)
+  {
+    this->transfer(::pwrite, reinterpret_cast<const char*>(tile), index, "erro: can't write a tile to the tiles file");
+  };
+};
+
+} // namespace storage
+} // namespace utilz
@@ -33,8 +33,14 @@
 #include "osx-memory.hpp"
 #endif
 
+#ifdef __linux__
+#include "linux-memory.hpp"
+#endif
+
 #ifdef _WIN32
 #include "win-memory.hpp"
+#else
+#include "memory-mmap.hpp"
 #endif
 
 #ifdef APSP_STATISTICS
@@ -46,6 +52,9 @@
 #include "memory.hpp"
 #include "measure.hpp"
 #include "graphs-io.hpp"
+#include "graphs-edges.hpp"
+#include "graphs-ingest.hpp"
+#include "graphs-ordering.hpp"
 
 #include "matrix.hpp"
 #include "matrix-manip.hpp"
@@ -57,7 +66,7 @@
 //
 #include "_shell_inject.hpp"
 
-using buffer_type      = ::utilz::memory::buffer_fx;
+using buffer_type      = ::utilz::memory::buffer_arena;
 
 int
 main(int argc, char* argv[]) __hack_noexcept
@@ -67,7 +76,11 @@ main(int argc, char* argv[]) __hack_noexcept
 
   communities_format_type opt_input_communities_format = communities_format_type::communities_fmt_none;
 
+  ::utilz::graphs::ordering::graph_ordering opt_ordering = ::utilz::graphs::ordering::graph_ordering::graph_ord_none;
+
   bool      opt_pages      = false;
+  bool      opt_compact    = false;
+  bool      opt_roofline   = false;
   size_t    opt_reserve    = size_t(0);
   size_t    opt_alignment  = size_t(0);
   size_type opt_block_size = size_type(0);
@@ -75,17 +88,32 @@ main(int argc, char* argv[]) __hack_noexcept
   std::string opt_input_graph;
   std::string opt_input_communities;
   std::string opt_output;
-
+  std::string opt_mapping;
+
+  // Vertexes relabelling (-l) and compaction (-m) aren't supported for
+  // clusters, because clusters require vertexes of every community to be
+  // labelled consecutively. Mapping of the reservation onto a file (-f) isn't
+  // supported for out-of-core algorithms, because their matrix isn't a part
+  // of the reservation. On Windows (-f) is rejected while options are parsed,
+  // because there is no mapping to allocate the reservation from.
+  //
+  // Compaction (-m) keeps only vertexes with edges, so isolated vertexes (ex.
+  // declared by a DIMACS 'p' line) are dropped and aren't a part of the result
+  //
 #ifdef APSP_ALG_MATRIX_FLAT
-  const char* options = "g:G:o:O:pr:a:";
+  const char* options = "g:G:o:O:pr:a:Rl:mf:";
 #endif
 
 #ifdef APSP_ALG_MATRIX_BLOCKS
-  const char* options = "g:G:o:O:pr:a:s:";
+  #ifdef APSP_ALG_OUT_OF_CORE
+  const char* options = "g:G:o:O:pr:a:Rl:ms:";
+  #else
+  const char* options = "g:G:o:O:pr:a:Rl:ms:f:";
+  #endif
 #endif
 
 #ifdef APSP_ALG_MATRIX_CLUSTERS
-  const char* options = "g:G:o:O:pr:a:c:C:";
+  const char* options = "g:G:o:O:pr:a:Rc:C:f:";
 #endif
 
   std::cerr << "Options:\n";
@@ -156,6 +184,19 @@ main(int argc, char* argv[]) __hack_noexcept
         }
         std::cerr << "erro: unexpected '-O' option detected" << '\n';
         return 1;
+      case 'f':
+#ifndef _WIN32
+        if (opt_mapping.empty()) {
+          std::cerr << "-f: " << optarg << "\n";
+
+          opt_mapping = optarg;
+          break;
+        }
+        std::cerr << "erro: unexpected '-f' option detected" << '\n';
+#else
+        std::cerr << "erro: the '-f' option isn't supported on this platform" << '\n';
+#endif
+        return 1;
       case 'p':
         if (!opt_pages) {
           std::cerr << "-p: true\n";
@@ -165,6 +206,15 @@ main(int argc, char* argv[]) __hack_noexcept
         }
         std::cerr << "erro: unexpected '-p' option detected" << '\n';
         return 1;
+      case 'R':
+        if (!opt_roofline) {
+          std::cerr << "-R: true\n";
+
+          opt_roofline = true;
+          break;
+        }
+        std::cerr << "erro: unexpected '-R' option detected" << '\n';
+        return 1;
       case 'r':
         if (opt_reserve == size_t(0)) {
           std::cerr << "-r: " << optarg << "\n";
@@ -207,6 +257,27 @@ main(int argc, char* argv[]) __hack_noexcept
         }
         std::cerr << "erro: unexpected '-s' option detected" << '\n';
         return 1;
+      case 'l':
+        if (opt_ordering == ::utilz::graphs::ordering::graph_ordering::graph_ord_none) {
+          std::cerr << "-l: " << optarg << "\n";
+
+          if (!::utilz::graphs::ordering::parse_graph_ordering(optarg, opt_ordering)) {
+            std::cerr << "erro: invalid graph ordering has been detected in '-l' option" << '\n';
+            return 1;
+          }
+          break;
+        }
+        std::cerr << "erro: unexpected '-l' option detected" << '\n';
+        return 1;
+      case 'm':
+        if (!opt_compact) {
+          std::cerr << "-m: true\n";
+
+          opt_compact = true;
+          break;
+        }
+        std::cerr << "erro: unexpected '-m' option detected" << '\n';
+        return 1;
       default:
         return 1;
     }
@@ -223,11 +294,19 @@ main(int argc, char* argv[]) __hack_noexcept
     std::cerr << "erro: the -G parameter is required";
     return 1;
   }
-  if (opt_output_format == graph_format_type::graph_fmt_none) {
+  if (opt_output_format == graph_format_type::graph_fmt_none && opt_mapping.empty()) {
     std::cerr << "erro: the -O parameter is required";
     return 1;
   }
 
+  // The reservation is either mapped onto a file (-f) or allocated using large
+  // pages (-p), but not both
+  //
+  if (opt_pages && !opt_mapping.empty()) {
+    std::cerr << "erro: the -f and -p parameters can't be used together";
+    return 1;
+  }
+
 #ifdef APSP_ALG_MATRIX_CLUSTERS
   if (opt_input_communities_format == communities_format_type::communities_fmt_none) {
     std::cerr << "erro: the -C parameter is required";
@@ -268,8 +347,101 @@ main(int argc, char* argv[]) __hack_noexcept
 
   std::ostream& output_stream = output_fstream.is_open() ? output_fstream : std::cout;
 
+  auto scan_time = int64_t(0);
+
+  // Parsing of the graph is pipelined with reading of the input stream (and
+  // is included into the scan time)
+  //
+  graph_type graph;
+
+  scan_time += ::utilz::measure_milliseconds(
+    [&graph, &input_graph_stream, opt_input_graph_format]() -> void {
+      graph = ::utilz::graphs::io::scan_graph_pipelined<size_type, value_type, edges_type>(opt_input_graph_format, input_graph_stream);
+    });
+
+#ifdef APSP_ALG_MATRIX_CLUSTERS
+  communities_type communities = ::utilz::communities::io::scan_communities<size_type>(opt_input_communities_format, input_communities_stream);
+#endif
+
+  // Compact sparse vertexes into a dense range, the original vertexes are
+  // restored when the result is printed
+  //
+  std::vector<size_type> ids;
+  if (opt_compact) {
+    auto compact_ms = ::utilz::measure_milliseconds([&graph, &ids]() -> void {
+      auto& [vc, edges] = graph;
+
+      ids = ::utilz::graphs::ordering::compact_graph(vc, edges);
+    });
+
+    std::cerr << "U/CM: " << compact_ms << "ms" << std::endl;
+  }
+
+  // Relabel vertexes to concentrate edges near the diagonal, the original
+  // labels are restored when the result is printed
+  //
+  std::vector<size_type> labels;
+  if (opt_ordering != ::utilz::graphs::ordering::graph_ordering::graph_ord_none) {
+    auto relabel_ms = ::utilz::measure_milliseconds([&graph, &labels, opt_ordering]() -> void {
+      auto& [vc, edges] = graph;
+
+      labels = ::utilz::graphs::ordering::order_graph(opt_ordering, vc, edges);
+
+      ::utilz::graphs::ordering::relabel_graph(labels, edges);
+    });
+
+    std::cerr << "U/RL: " << relabel_ms << "ms" << std::endl;
+  }
+
+  // Compute the reservation from sizes of the matrix and allocations made by
+  // the algorithm (unless it is set explicitly using -r option)
+  //
+#ifdef APSP_ALG_ACCESS_FLAT
+  matrix_params_type matrix_params;
+#endif
+#ifdef APSP_ALG_ACCESS_BLOCKS
+  matrix_params_type matrix_params(opt_block_size);
+#endif
+#ifdef APSP_ALG_ACCESS_CLUSTERS
+  matrix_params_type matrix_params(communities);
+#endif
+
+  if (opt_reserve == size_t(0)) {
+#ifdef APSP_ALG_MATRIX_FLAT
+    auto required = scan_matrix_params_type::required_bytes(graph);
+#endif
+#ifdef APSP_ALG_MATRIX_BLOCKS
+    auto required = scan_matrix_params_type::required_bytes(graph, opt_block_size);
+#endif
+#ifdef APSP_ALG_MATRIX_CLUSTERS
+    auto required = scan_matrix_params_type::required_bytes(communities);
+#endif
+
+    for (auto bytes : SHELL_REQUIRED_BYTES(matrix_params, size_t(std::get<0>(graph))))
+      required.push_back(bytes);
+
+    opt_reserve = (std::max)(buffer_type::reservation(required, opt_alignment), size_t(1));
+  }
+
+  std::cerr << "Rsrv: " << opt_reserve << " bytes" << std::endl;
+
+  // The reservation isn't touched up front, pages are committed when they are
+  // used for the first time
+  //
+#ifndef _WIN32
+  std::unique_ptr<::utilz::memory::buffer_mmap> mapping;
+#endif
+
   std::shared_ptr<char> memory;
-  if (opt_pages) {
+  if (!opt_mapping.empty()) {
+#ifndef _WIN32
+    // The matrix is computed directly in the file, which replaces printing of
+    // the result (see `buffer_mmap`)
+    //
+    mapping = std::make_unique<::utilz::memory::buffer_mmap>(opt_mapping, opt_reserve);
+    memory  = mapping->memory();
+#endif
+  } else if (opt_pages) {
     // Initialize large pages support from application side
     // this might require different actions in different operating systems
     //
@@ -287,22 +459,22 @@ main(int argc, char* argv[]) __hack_noexcept
     return 1;
   }
 
-  ::memset(memory.get(), 0, opt_reserve);
-
   buffer_type            buffer_fx(memory, opt_reserve, opt_alignment);
 
+  // Report the high-water mark of the buffer after every phase
+  //
+  auto report_memory = [&buffer_fx](const char* phase) -> void {
+    auto statistics = buffer_fx.statistics();
+
+    std::cerr << phase << ": " << statistics.peak << " bytes (used: " << statistics.used << ", fragmentation: " << statistics.fragmentation() << ")" << std::endl;
+  };
+
   // Define matrix and execute algorithm specific overloads of methods
   //
   matrix_type            matrix;
   matrix_run_config_type matrix_run_config;
   matrix_clusters_type   matrix_clusters;
 
-  graph_type       graph       = ::utilz::graphs::io::scan_graph<size_type, value_type>(opt_input_graph_format, input_graph_stream);
-
-#ifdef APSP_ALG_MATRIX_CLUSTERS
-  communities_type communities = ::utilz::communities::io::scan_communities<size_type>(opt_input_communities_format, input_communities_stream);
-#endif
-
 #ifdef APSP_ALG_MATRIX_FLAT
   scan_matrix_params_type scan_matrix_params(buffer_fx, graph);
 #endif
@@ -313,18 +485,6 @@ main(int argc, char* argv[]) __hack_noexcept
   scan_matrix_params_type scan_matrix_params(buffer_fx, graph, communities);
 #endif
 
-#ifdef APSP_ALG_ACCESS_FLAT
-  matrix_params_type matrix_params;
-#endif
-#ifdef APSP_ALG_ACCESS_BLOCKS
-  matrix_params_type matrix_params(opt_block_size);
-#endif
-#ifdef APSP_ALG_ACCESS_CLUSTERS
-  matrix_params_type matrix_params(communities);
-#endif
-
-  auto scan_time = int64_t(0);
-
   scan_time += ::utilz::measure_milliseconds(
     [&matrix, &scan_matrix_params]() -> void {
       scan_init_matrix(matrix, scan_matrix_params);
@@ -344,11 +504,18 @@ main(int argc, char* argv[]) __hack_noexcept
     });
 #endif
 
+  // Once the matrix (and labels and ids) are built the edges aren't needed
+  // anymore, so they are released instead of being kept till the end of the
+  // execution (only the number of vertexes is used further)
+  //
+  std::get<1>(graph) = edges_type();
+
   std::cerr << "Scan: " << scan_time << "ms" << std::endl;
+  report_memory("M/SC");
 
 #ifdef APSP_ALG_MATRIX_CLUSTERS
   #ifdef APSP_ALG_MATRIX_CLUSTERS_CONFIGURATION
-  auto up_clusters_ms = ::utilz::measure_milliseconds([&c]() -> void { up_clusters(c); });
+  auto up_clusters_ms = ::utilz::measure_milliseconds([&matrix_clusters]() -> void { up_clusters(matrix_clusters); });
 
   std::cerr << "U/CU: " << up_clusters_ms << "ms" << std::endl;
   #endif
@@ -370,6 +537,15 @@ main(int argc, char* argv[]) __hack_noexcept
   #endif
 #endif
 
+  // Relaxations and bytes are counted before the execution, because some of
+  // the algorithms (ex. 12) depend on the structure of the graph, which is
+  // lost once the matrix is closed
+  //
+  ::utilz::roofline::counters roofline_counters;
+  if (opt_roofline) {
+    roofline_counters = SHELL_ROOFLINE(matrix, matrix_clusters);
+  }
+
 #ifdef APSP_ALG_RUN_CONFIGURATION
   // In cases when algorithm requires additional setup (ex. pre-allocated arrays)
   // it can be done in up procedure (and undone in down).
@@ -383,6 +559,7 @@ main(int argc, char* argv[]) __hack_noexcept
     });
 
   std::cerr << "U/CF: " << up_ms << "ms" << std::endl;
+  report_memory("M/CF");
 #endif
 
   auto exec_ms = utilz::measure_milliseconds(
@@ -402,6 +579,7 @@ main(int argc, char* argv[]) __hack_noexcept
     });
 
   std::cerr << "Exec: " << exec_ms << "ms" << std::endl;
+  report_memory("M/EX");
 
 #ifdef APSP_ALG_RUN_CONFIGURATION
   auto down_ms = utilz::measure_milliseconds(
@@ -410,6 +588,7 @@ main(int argc, char* argv[]) __hack_noexcept
     });
 
   std::cerr << "D/CF: " << down_ms << "ms" << std::endl;
+  report_memory("M/DN");
 #endif
 
 #ifdef APSP_ALG_MATRIX_CLUSTERS
@@ -426,11 +605,52 @@ main(int argc, char* argv[]) __hack_noexcept
   #endif
 #endif
 
-  auto prnt_ms = ::utilz::measure_milliseconds([&matrix_access, &output_stream, opt_output_format]() -> void {
-    ::utilz::matrices::io::print_matrix(opt_output_format, output_stream, matrix_access);
-  });
+  auto prnt_ms = int64_t(0);
+  if (!opt_mapping.empty()) {
+#if !defined(_WIN32) && !defined(APSP_ALG_OUT_OF_CORE)
+  #ifdef APSP_ALG_MATRIX_FLAT
+    const auto blocks = size_t(1);
+  #else
+    const auto blocks = size_t(matrix.size());
+  #endif
+
+    // Blocks of clusters are of sizes of communities, so the vertex of every
+    // row of diagonal blocks is written as well
+    //
+    const auto rows = ::utilz::matrices::io::storage_rows(matrix_access);
+
+    // The result is already in the file, so only a description of the matrix
+    // is written and the mapping is flushed
+    //
+    prnt_ms = ::utilz::measure_milliseconds([&mapping, &matrix, &graph, &labels, &ids, &rows, blocks]() -> void {
+      mapping->describe(sizeof(value_type), size_t(std::get<0>(graph)), blocks, ::utilz::matrices::io::storage_blocks(matrix), labels, ids, rows);
+      mapping->sync();
+    });
+#endif
+  } else {
+    prnt_ms = ::utilz::measure_milliseconds([&matrix_access, &output_stream, &labels, &ids, opt_output_format]() -> void {
+      if (labels.empty() && ids.empty())
+        ::utilz::matrices::io::print_matrix(opt_output_format, output_stream, matrix_access);
+      else
+        ::utilz::matrices::io::print_matrix(opt_output_format, output_stream, matrix_access, labels, ids);
+    });
+  }
   std::cerr << "Prnt: " << prnt_ms << "ms" << std::endl;
 
+  if (opt_roofline) {
+    // Compare number of relaxations and bytes moved by the algorithm with
+    // measured peak throughput and bandwidth of the machine (per phase, when
+    // phases are measured)
+    //
+    std::map<std::string, double> roofline_seconds;
+#ifdef APSP_STATISTICS
+    for (auto& [name, durations] : utilz::auto_measurements)
+      roofline_seconds[name] = std::chrono::duration<double>(std::reduce(durations.begin(), durations.end())).count();
+#endif
+
+    ::utilz::roofline::print_roofline<value_type>(std::cerr, roofline_counters, exec_ms, roofline_seconds);
+  }
+
 #ifdef APSP_STATISTICS
   for (auto k : utilz::auto_measurements) {
     auto total   = std::reduce(k.second.begin(), k.second.end());
@@ -0,0 +1,330 @@
+// benchmarks
+//
+#include "benchmark/benchmark.h"
+
+// global includes
+//
+#include <algorithm>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _OPENMP
+  #include <omp.h>
+#endif
+
+// local utilz
+#include "memory.hpp"
+#include "measure.hpp"
+#include "graphs-io.hpp"
+#include "graphs-generators.hpp"
+
+#include "matrix.hpp"
+#include "matrix-manip.hpp"
+#include "matrix-traits.hpp"
+#include "matrix-io.hpp"
+#include "matrix-access.hpp"
+
+// local includes
+//
+#include "_shell_inject.hpp"
+
+// This is a synthetic benchmark, which unlike `_benchmark.cpp` doesn't
+// depend on the test graphs and instead generates graphs in-process, which
+// allows to measure behaviour of the algorithms on "real" sizes.
+//
+// Every benchmark is parametrised with:
+// - v: number of vertexes in a graph
+// - d: percentage of edges in a graph (based on `v * (v - 1)`)
+// - c: number of communities in a graph (`1` means no community structure)
+// - t: number of threads (always `1` for sequential variants)
+// - b: size of a block (blocked variants only)
+//
+// All graphs are generated from the same seed and therefore are identical
+// across variants. The throughput is reported in relaxations per second,
+// where number of relaxations is `v * v * v` (Floyd-Warshall), which makes
+// reports of different variants comparable, i.e.:
+//
+// _benchmark-synthetic-v01 --benchmark_out=01.json --benchmark_filter=/v:1024/
+//
+// The default sizes are small enough to run the whole suite on a workstation.
+// Large sizes are registered as a separate `-large` benchmark, only when they
+// are explicitly selected by the filter, i.e.:
+//
+// _benchmark-synthetic-v01 --benchmark_filter=large/v:8192/
+//
+
+#ifndef APSP_VARIANT_NAME
+  #define APSP_VARIANT_NAME "unknown"
+#endif
+
+const auto parameters_vertexes    = std::vector<int64_t>({ 512, 1024, 2048 });
+const auto parameters_density     = std::vector<int64_t>({ 1, 10 });
+const auto parameters_communities = std::vector<int64_t>({ 1, 32 });
+
+const auto parameters_large_vertexes    = std::vector<int64_t>({ 4096, 8192, 16384 });
+const auto parameters_large_density     = std::vector<int64_t>({ 10 });
+const auto parameters_large_communities = std::vector<int64_t>({ 1, 32 });
+
+#ifdef APSP_ALG_MATRIX_BLOCKS
+const auto parameters_block_size       = std::vector<int64_t>({ 64 });
+const auto parameters_large_block_size = std::vector<int64_t>({ 64, 128 });
+#endif
+
+const std::mt19937_64::result_type graph_seed = 0x5eed;
+
+const int graph_low_weight  = 1;
+const int graph_high_weight = 20;
+
+using buffer_type = ::utilz::memory::buffer_arena;
+
+graph_type
+generate_graph(
+  size_type v,
+  size_type d,
+  size_type c)
+{
+  auto e = std::max(v - size_type(1), size_type((v * (v - size_type(1)) * d) / size_type(100)));
+
+  auto adjacency_matrix = ::utilz::graphs::generators::random_graph(
+    v,
+    e,
+    c,
+    graph_seed,
+    ::utilz::graphs::generators::community_graph_tag());
+
+  // We use uniform distribution to get random weight values
+  //
+  std::mt19937_64                           weight_distribution_engine(graph_seed);
+  std::uniform_int_distribution<value_type> weight_distribution(graph_low_weight, graph_high_weight);
+
+  graph_type graph;
+
+  auto& [vc, edges] = graph;
+
+  vc = v;
+  edges.reserve(e);
+  for (auto i = size_type(0); i < v; ++i)
+    for (auto j = size_type(0); j < v; ++j)
+      if (adjacency_matrix.at(i, j))
+        edges.push_back(std::make_tuple(i, j, weight_distribution(weight_distribution_engine)));
+
+  return graph;
+};
+
+communities_type
+generate_communities(
+  size_type v,
+  size_type c)
+{
+  // Membership of vertexes in communities is defined by
+  // `community_graph_tag` generator
+  //
+  communities_type communities;
+  for (auto i = size_type(0); i < v; ++i)
+    communities[i % c].push_back(i);
+
+  return communities;
+};
+
+void
+synthetic(benchmark::State& state)
+{
+  size_type v = size_type(state.range(0));
+  size_type d = size_type(state.range(1));
+  size_type c = size_type(state.range(2));
+
+#ifdef APSP_ALG_MATRIX_BLOCKS
+  size_type block_size = size_type(state.range(4));
+#endif
+
+  buffer_type buffer_fx;
+
+  graph_type       graph       = generate_graph(v, d, c);
+  communities_type communities = generate_communities(v, c);
+
+#ifdef APSP_ALG_MATRIX_FLAT
+  scan_matrix_params_type scan_matrix_params(buffer_fx, graph);
+#endif
+#ifdef APSP_ALG_MATRIX_BLOCKS
+  scan_matrix_params_type scan_matrix_params(buffer_fx, graph, block_size);
+#endif
+#ifdef APSP_ALG_MATRIX_CLUSTERS
+  scan_matrix_params_type scan_matrix_params(buffer_fx, graph, communities);
+#endif
+
+#ifdef APSP_ALG_ACCESS_FLAT
+  matrix_params_type matrix_params;
+#endif
+#ifdef APSP_ALG_ACCESS_BLOCKS
+  matrix_params_type matrix_params(block_size);
+#endif
+#ifdef APSP_ALG_ACCESS_CLUSTERS
+  matrix_params_type matrix_params(communities);
+#endif
+
+  matrix_type            matrix;
+  matrix_clusters_type   matrix_clusters;
+  matrix_run_config_type matrix_run_config;
+
+  scan_init_matrix(matrix, scan_matrix_params);
+
+  matrix_access_type matrix_access(matrix, matrix_params);
+
+#ifdef APSP_ALG_MATRIX_CLUSTERS
+  scan_matrix_clusters(matrix_clusters, scan_matrix_params);
+#endif
+
+#ifdef _OPENMP
+  omp_set_num_threads(int(state.range(3)));
+#endif
+
+  for (auto _ : state) {
+    // Every iteration has to start from the matrix of the graph (the previous
+    // one leaves a closed matrix, which kernels with pruning and skipping of
+    // blocks process differently), the matrix is restored from the graph
+    // outside of the measured time
+    //
+    state.PauseTiming();
+    scan_set_matrix(matrix_access, scan_matrix_params);
+    state.ResumeTiming();
+
+#ifdef APSP_ALG_MATRIX_CLUSTERS
+  #ifdef APSP_ALG_MATRIX_CLUSTERS_CONFIGURATION
+    up_clusters(matrix_clusters);
+  #endif
+
+    matrix_clusters.optimise();
+
+  #ifdef APSP_ALG_MATRIX_CLUSTERS_REARRANGEMENTS
+    matrix_arrange_procedure_type matrix_arrange_procedure;
+    matrix_arrange_procedure(
+      matrix_access,
+      matrix_clusters,
+      ::utilz::matrices::procedures::matrix_arrangement::matrix_arrangement_forward);
+  #endif
+#endif
+
+#ifdef APSP_ALG_RUN_CONFIGURATION
+    up(matrix, matrix_access, matrix_run_config, buffer_fx);
+#endif
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    SHELL_RUN(matrix, matrix_clusters, matrix_run_config);
+
+    auto end = std::chrono::high_resolution_clock::now();
+    auto elapsed_seconds = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+
+    state.SetIterationTime(elapsed_seconds.count());
+
+#ifdef APSP_ALG_RUN_CONFIGURATION
+    down(matrix, matrix_access, matrix_run_config, buffer_fx);
+#endif
+
+#ifdef APSP_ALG_MATRIX_CLUSTERS
+  #ifdef APSP_ALG_MATRIX_CLUSTERS_REARRANGEMENTS
+    matrix_arrange_procedure(
+      matrix_access,
+      matrix_clusters,
+      ::utilz::matrices::procedures::matrix_arrangement::matrix_arrangement_backward);
+  #endif
+#endif
+  }
+
+  double vertexes = double(state.range(0));
+
+  state.SetLabel(APSP_VARIANT_NAME);
+
+  state.counters["relaxations"] = benchmark::Counter(vertexes * vertexes * vertexes, benchmark::Counter::kIsIterationInvariantRate);
+  state.counters["threads"]     = benchmark::Counter(double(state.range(3)));
+}
+
+// Returns `1`, powers of two and the number of hardware threads (or only `1`
+// for sequential variants)
+//
+std::vector<int64_t>
+synthetic_threads()
+{
+  std::vector<int64_t> parameters_threads({ 1 });
+
+#ifdef _OPENMP
+  auto concurrency = int64_t(std::thread::hardware_concurrency());
+  for (auto t = int64_t(2); t <= concurrency; t *= 2)
+    parameters_threads.push_back(t);
+
+  if (parameters_threads.back() < concurrency)
+    parameters_threads.push_back(concurrency);
+#endif
+
+  return parameters_threads;
+}
+
+void
+synthetic_arguments(benchmark::internal::Benchmark* b)
+{
+  b->ArgsProduct({ parameters_vertexes,
+                   parameters_density,
+                   parameters_communities,
+                   synthetic_threads()
+#ifdef APSP_ALG_MATRIX_BLOCKS
+                   , parameters_block_size
+#endif
+                 });
+}
+
+// Large sizes are measured only using all hardware threads
+//
+void
+synthetic_large_arguments(benchmark::internal::Benchmark* b)
+{
+  b->ArgsProduct({ parameters_large_vertexes,
+                   parameters_large_density,
+                   parameters_large_communities,
+                   { synthetic_threads().back() }
+#ifdef APSP_ALG_MATRIX_BLOCKS
+                   , parameters_large_block_size
+#endif
+                 });
+}
+
+void
+synthetic_register(
+  const char* name,
+  void (*arguments)(benchmark::internal::Benchmark*))
+{
+  benchmark::RegisterBenchmark(name, synthetic)
+#ifdef APSP_ALG_MATRIX_BLOCKS
+    ->ArgNames({ "v", "d", "c", "t", "b" })
+#else
+    ->ArgNames({ "v", "d", "c", "t" })
+#endif
+    ->Apply(arguments)
+    ->Unit(benchmark::kMillisecond)
+    ->UseManualTime()
+    ->DisplayAggregatesOnly()
+    ->Repetitions(3);
+}
+
+int
+main(int argc, char** argv)
+{
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    return 1;
+
+  synthetic_register("apsp-v" APSP_VARIANT_NAME, synthetic_arguments);
+
+  // Large sizes take hours to complete and therefore are registered only when
+  // the filter explicitly selects them
+  //
+  if (benchmark::GetBenchmarkFilter().find("large") != std::string::npos)
+    synthetic_register("apsp-v" APSP_VARIANT_NAME "-large", synthetic_large_arguments);
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+
+  return 0;
+}
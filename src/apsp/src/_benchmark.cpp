@@ -16,6 +16,7 @@
 #include "memory.hpp"
 #include "measure.hpp"
 #include "graphs-io.hpp"
+#include "graphs-edges.hpp"
 
 #include "matrix.hpp"
 #include "matrix-manip.hpp"
@@ -50,8 +51,9 @@ const auto parameters = std::array<std::tuple<std::string, std::string>, 2>(
 using size_type  = typename utzmx::traits::matrix_traits<matrix_type>::size_type;
 using value_type = typename utzmx::traits::matrix_traits<matrix_type>::value_type;
 
-using buffer_type             = ::utilz::memory::buffer_dyn;
-using graph_type              = typename std::tuple<size_type, std::vector<std::tuple<size_type, size_type, value_type>>>;
+using buffer_type             = ::utilz::memory::buffer_arena;
+using edges_type              = typename ::utilz::graphs::edges_container<size_type, value_type>;
+using graph_type              = typename std::tuple<size_type, edges_type>;
 using communities_type        = typename std::map<size_type, std::vector<size_type>>;
 using scan_matrix_params_type = utzmx::io::scan_matrix_params<matrix_type>;
 
@@ -85,7 +87,7 @@ public:
         throw std::logic_error("erro: the file '" + graph_path.generic_string() + "' doesn't exist.");
 
       graph_format_type graph_format = graph_format_type::graph_fmt_weightlist;
-      graph_type        graph        = ::utilz::graphs::io::scan_graph<size_type, value_type>(graph_format, graph_fs);
+      graph_type        graph        = ::utilz::graphs::io::scan_graph<size_type, value_type, edges_type>(graph_format, graph_fs);
 
 #ifdef APSP_ALG_MATRIX_CLUSTERS
       communities_format_type communities_format   = communities_format_type::communities_fmt_rlang;
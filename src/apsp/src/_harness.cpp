@@ -0,0 +1,613 @@
+// portability
+#include "portables/hacks/defines.h"
+
+// global includes
+//
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <random>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+// global C includes
+//
+#include <stdlib.h>
+#include <unistd.h>
+
+// local utilz
+//
+#include "graphs-generators.hpp"
+#include "graphs-io.hpp"
+
+// This is a tiny program which runs all built `_application-v*` executables
+// across a sweep of thread counts and graph sizes and reports how each of
+// them scales:
+//
+// - strong scaling, the same graph is solved with growing number of threads
+// - weak scaling, the graph grows together with number of threads, keeping
+//   the amount of work per thread (`v * v * v / t`) constant
+//
+// Threads are pinned through standard OpenMP environment variables
+// (`OMP_PROC_BIND=close` and `OMP_PLACES=cores`), sequential variants are
+// executed with a single thread only.
+//
+// The list of variants and their matrix layouts is provided at compile time
+// in a form of `<name>:<layout>:<parallel>` items separated by ','.
+//
+
+#ifndef APSP_HARNESS_VARIANTS
+  #define APSP_HARNESS_VARIANTS ""
+#endif
+
+using size_type  = size_t;
+using value_type = int;
+
+struct harness_variant
+{
+  std::string name;
+  std::string layout;
+  bool        parallel;
+};
+
+struct harness_result
+{
+  std::string variant;
+  std::string scaling;
+  size_type   vertexes;
+  int         threads;
+
+  std::vector<double> samples;
+
+  bool failed;
+
+  double median;
+  double min;
+  double stddev;
+  double speedup;
+  double efficiency;
+};
+
+std::vector<std::string>
+split(const std::string& s, char separator)
+{
+  std::vector<std::string> items;
+
+  std::string       item;
+  std::stringstream ss(s);
+  while (std::getline(ss, item, separator))
+    if (!item.empty())
+      items.push_back(item);
+
+  return items;
+};
+
+bool
+parse_list(const std::string& s, std::vector<int>& out)
+{
+  for (auto item : split(s, ',')) {
+    auto value = atoi(item.c_str());
+    if (value <= 0)
+      return false;
+
+    out.push_back(value);
+  }
+  return !out.empty();
+};
+
+std::vector<harness_variant>
+parse_variants(const std::string& s)
+{
+  std::vector<harness_variant> variants;
+  for (auto item : split(s, ',')) {
+    auto parts = split(item, ':');
+    if (parts.size() != 3)
+      throw std::logic_error("erro: invalid variant definition '" + item + "'");
+
+    variants.push_back({ parts[0], parts[1], parts[2] == "1" });
+  }
+  return variants;
+};
+
+// Generates (if doesn't exist) a random graph with community structure and
+// communities file for it in the `directory`
+//
+std::tuple<std::filesystem::path, std::filesystem::path>
+prepare_graph(
+  const std::filesystem::path& directory,
+  size_type                    v,
+  int                          edge_percent,
+  size_type                    c)
+{
+  auto code = std::to_string(v) + "-" + std::to_string(edge_percent) + "-" + std::to_string(c);
+
+  auto graph_path       = directory / ("harness-" + code + ".g");
+  auto communities_path = directory / ("harness-" + code + ".communities.g");
+
+  if (std::filesystem::exists(graph_path) && std::filesystem::exists(communities_path))
+    return std::make_tuple(graph_path, communities_path);
+
+  std::cerr << "Generating graph: " << code << std::endl;
+
+  auto e = std::max(v - size_type(1), size_type((double(v) * double(v - size_type(1)) * edge_percent) / 100.0));
+
+  auto adjacency_matrix = ::utilz::graphs::generators::random_graph(
+    v,
+    e,
+    c,
+    std::mt19937_64::result_type(v),
+    ::utilz::graphs::generators::community_graph_tag());
+
+  // We use uniform distribution to get random weight values
+  //
+  std::mt19937_64                           weight_distribution_engine(v);
+  std::uniform_int_distribution<value_type> weight_distribution(1, 20);
+
+  std::vector<std::tuple<size_type, size_type, value_type>> edges;
+  for (auto i = size_type(0); i < v; ++i)
+    for (auto j = size_type(0); j < v; ++j)
+      if (adjacency_matrix.at(i, j))
+        edges.push_back(std::make_tuple(i, j, weight_distribution(weight_distribution_engine)));
+
+  std::ofstream graph_fs(graph_path);
+  if (!graph_fs.is_open())
+    throw std::logic_error("erro: can't create graph file '" + graph_path.generic_string() + "'");
+
+  ::utilz::graphs::io::print_graph(::utilz::graphs::io::graph_format::graph_fmt_weightlist, graph_fs, v, edges);
+
+  // Vertex `i` belongs to community `i % c` (see `community_graph_tag`),
+  // communities are saved in 'rlang' format with 1-based indexes
+  //
+  std::ofstream communities_fs(communities_path);
+  if (!communities_fs.is_open())
+    throw std::logic_error("erro: can't create communities file '" + communities_path.generic_string() + "'");
+
+  for (auto q = size_type(0); q < c; ++q) {
+    communities_fs << "$`" << (q + 1) << "`\n[1]";
+    for (auto i = q; i < v; i += c)
+      communities_fs << ' ' << (i + 1);
+    communities_fs << "\n\n";
+  }
+
+  return std::make_tuple(graph_path, communities_path);
+};
+
+// Executes a single variant and returns value of `Exec:` phase (in milliseconds)
+// or a negative value in case of failure
+//
+double
+execute_variant(
+  const std::filesystem::path& executable,
+  const harness_variant&       variant,
+  const std::filesystem::path& graph_path,
+  const std::filesystem::path& communities_path,
+  int                          threads,
+  size_type                    block_size,
+  size_t                       reserve)
+{
+  setenv("OMP_NUM_THREADS", std::to_string(threads).c_str(), 1);
+  setenv("OMP_PROC_BIND", "close", 1);
+  setenv("OMP_PLACES", "cores", 1);
+
+  // The amount of memory to reserve is computed by the application if it
+  // isn't provided explicitly
+  //
+  std::stringstream command;
+  command << executable.generic_string()
+          << " -g " << graph_path.generic_string() << " -G weightlist"
+          << " -o /dev/null -O weightlist";
+
+  if (reserve != size_t(0))
+    command << " -r " << reserve;
+
+  if (variant.layout == "blocks")
+    command << " -s " << block_size;
+  if (variant.layout == "clusters")
+    command << " -c " << communities_path.generic_string() << " -C rlang";
+
+  command << " 2>&1 1>/dev/null";
+
+  FILE* pipe = popen(command.str().c_str(), "r");
+  if (pipe == nullptr)
+    return -1.0;
+
+  const std::regex exec_regex("Exec:\\s+(\\d+)ms");
+
+  double result = -1.0;
+
+  char buffer[512];
+  while (fgets(buffer, sizeof(buffer), pipe) != nullptr) {
+    std::cmatch match;
+    if (std::regex_search(buffer, match, exec_regex))
+      result = std::stod(match[1].str());
+  }
+
+  if (pclose(pipe) != 0)
+    return -1.0;
+
+  return result;
+};
+
+void
+calculate_statistics(harness_result& result)
+{
+  auto samples = result.samples;
+  if (samples.empty())
+    return;
+
+  std::sort(samples.begin(), samples.end());
+
+  auto n = samples.size();
+
+  result.min    = samples.front();
+  result.median = n % 2 == 0 ? (samples[n / 2 - 1] + samples[n / 2]) / 2.0 : samples[n / 2];
+
+  auto mean = std::accumulate(samples.begin(), samples.end(), 0.0) / double(n);
+  auto sum  = 0.0;
+  for (auto s : samples)
+    sum += (s - mean) * (s - mean);
+
+  result.stddev = n > 1 ? std::sqrt(sum / double(n - 1)) : 0.0;
+};
+
+void
+print_csv(std::ostream& os, const std::vector<harness_result>& results)
+{
+  os << "variant,scaling,vertexes,threads,status,repeats,median_ms,min_ms,stddev_ms,speedup,efficiency\n";
+  for (auto& r : results)
+    os << r.variant << ','
+       << r.scaling << ','
+       << r.vertexes << ','
+       << r.threads << ','
+       << (r.failed ? "failed" : "ok") << ','
+       << r.samples.size() << ','
+       << r.median << ','
+       << r.min << ','
+       << r.stddev << ','
+       << r.speedup << ','
+       << r.efficiency << '\n';
+};
+
+void
+print_json(std::ostream& os, const std::vector<harness_result>& results)
+{
+  os << "[\n";
+  for (auto i = size_t(0); i < results.size(); ++i) {
+    auto& r = results[i];
+
+    os << "  { \"variant\": \"" << r.variant << "\""
+       << ", \"scaling\": \"" << r.scaling << "\""
+       << ", \"vertexes\": " << r.vertexes
+       << ", \"threads\": " << r.threads
+       << ", \"status\": \"" << (r.failed ? "failed" : "ok") << "\""
+       << ", \"samples\": [";
+    for (auto j = size_t(0); j < r.samples.size(); ++j)
+      os << (j == 0 ? "" : ", ") << r.samples[j];
+    os << "]"
+       << ", \"median_ms\": " << r.median
+       << ", \"min_ms\": " << r.min
+       << ", \"stddev_ms\": " << r.stddev
+       << ", \"speedup\": " << r.speedup
+       << ", \"efficiency\": " << r.efficiency
+       << " }" << (i + 1 == results.size() ? "\n" : ",\n");
+  }
+  os << "]\n";
+};
+
+int
+main(int argc, char* argv[]) __hack_noexcept
+{
+  std::string opt_directory;
+  std::string opt_workspace;
+  std::string opt_output;
+  std::string opt_output_format;
+
+  std::vector<std::string> opt_variants;
+  std::vector<int>         opt_threads;
+  std::vector<int>         opt_sizes;
+
+  int       opt_weak_size    = 0;
+  int       opt_edge_percent = 10;
+  size_type opt_communities  = 8;
+  size_type opt_block_size   = 64;
+  int       opt_repeats      = 5;
+  size_t    opt_reserve      = 0;
+
+  // Supported options
+  // d: <path>, directory with `_application-v*` executables (default: current directory)
+  // w: <path>, directory to store generated graphs, created if it doesn't exist (default: temporary directory)
+  // o: <path>, path to output file (default: standard output)
+  // O: <enum>, format of an output file
+  //    Supported values:
+  //    - 'csv' (default)
+  //    - 'json'
+  // v: <name>, variant to execute, can be specified multiple times (default: all variants)
+  // t: <list>, comma separated list of thread counts (default: 1, 2, 4, ... up to number of cores)
+  // n: <list>, comma separated list of vertex counts for strong scaling (default: 512,1024,2048)
+  // W: <int>,  vertex count of a single thread problem for weak scaling (default: weak scaling is disabled)
+  // e: <int>,  percentage of edges in a graph (default: 10)
+  // c: <int>,  number of communities in a graph (default: 8)
+  // s: <int>,  block size for blocked variants (default: 64)
+  // k: <int>,  number of repetitions (default: 5)
+  // r: <int>,  amount of memory (in MB) to reserve (default: computed by the application)
+  //
+  const char* options = "d:w:o:O:v:t:n:W:e:c:s:k:r:";
+
+  std::cerr << "Options:\n";
+
+  int opt;
+  while ((opt = getopt(argc, argv, options)) != -1) {
+    switch (opt) {
+      case 'd':
+        std::cerr << "-d: " << optarg << "\n";
+        opt_directory = optarg;
+        break;
+      case 'w':
+        std::cerr << "-w: " << optarg << "\n";
+        opt_workspace = optarg;
+        break;
+      case 'o':
+        std::cerr << "-o: " << optarg << "\n";
+        opt_output = optarg;
+        break;
+      case 'O':
+        std::cerr << "-O: " << optarg << "\n";
+        opt_output_format = optarg;
+
+        if (opt_output_format != "csv" && opt_output_format != "json") {
+          std::cerr << "erro: invalid output format has been detected in '-O' option" << '\n';
+          return 1;
+        }
+        break;
+      case 'v':
+        std::cerr << "-v: " << optarg << "\n";
+        opt_variants.push_back(optarg);
+        break;
+      case 't':
+        std::cerr << "-t: " << optarg << "\n";
+        if (!parse_list(optarg, opt_threads)) {
+          std::cerr << "erro: invalid list of thread counts has been detected in '-t' option" << '\n';
+          return 1;
+        }
+        break;
+      case 'n':
+        std::cerr << "-n: " << optarg << "\n";
+        if (!parse_list(optarg, opt_sizes)) {
+          std::cerr << "erro: invalid list of vertex counts has been detected in '-n' option" << '\n';
+          return 1;
+        }
+        break;
+      case 'W':
+        std::cerr << "-W: " << optarg << "\n";
+        opt_weak_size = atoi(optarg);
+        if (opt_weak_size <= 0) {
+          std::cerr << "erro: unsupported number of vertexes specified in '-W' option" << '\n';
+          return 1;
+        }
+        break;
+      case 'e':
+        std::cerr << "-e: " << optarg << "\n";
+        opt_edge_percent = atoi(optarg);
+        if (opt_edge_percent <= 0 || opt_edge_percent > 100) {
+          std::cerr << "erro: unsupported percent of edges specified in '-e' option" << '\n';
+          return 1;
+        }
+        break;
+      case 'c':
+        std::cerr << "-c: " << optarg << "\n";
+        opt_communities = size_type(atoi(optarg));
+        if (opt_communities == size_type(0)) {
+          std::cerr << "erro: unsupported number of communities specified in '-c' option" << '\n';
+          return 1;
+        }
+        break;
+      case 's':
+        std::cerr << "-s: " << optarg << "\n";
+        opt_block_size = size_type(atoi(optarg));
+        if (opt_block_size == size_type(0)) {
+          std::cerr << "erro: missing value after '-s' option" << '\n';
+          return 1;
+        }
+        break;
+      case 'k':
+        std::cerr << "-k: " << optarg << "\n";
+        opt_repeats = atoi(optarg);
+        if (opt_repeats <= 0) {
+          std::cerr << "erro: unsupported number of repetitions specified in '-k' option" << '\n';
+          return 1;
+        }
+        break;
+      case 'r':
+        std::cerr << "-r: " << optarg << "\n";
+        opt_reserve = size_t(atoi(optarg));
+        if (opt_reserve == size_t(0)) {
+          std::cerr << "erro: missing value after '-r' option" << '\n';
+          return 1;
+        }
+        break;
+      default:
+        return 1;
+    }
+  }
+
+  // Initialise defaults
+  //
+  if (opt_threads.empty()) {
+    auto concurrency = std::max(int(std::thread::hardware_concurrency()), 1);
+    for (auto t = 1; t < concurrency; t *= 2)
+      opt_threads.push_back(t);
+
+    opt_threads.push_back(concurrency);
+  }
+  if (opt_sizes.empty())
+    opt_sizes = { 512, 1024, 2048 };
+
+  if (std::find(opt_threads.begin(), opt_threads.end(), 1) == opt_threads.end())
+    opt_threads.insert(opt_threads.begin(), 1);
+
+  std::sort(opt_threads.begin(), opt_threads.end());
+
+  std::filesystem::path directory = opt_directory.empty() ? std::filesystem::current_path() : std::filesystem::path(opt_directory);
+  std::filesystem::path workspace = opt_workspace.empty() ? std::filesystem::temp_directory_path() : std::filesystem::path(opt_workspace);
+
+  std::vector<harness_variant> variants;
+  try {
+    for (auto variant : parse_variants(APSP_HARNESS_VARIANTS)) {
+      if (!opt_variants.empty() && std::find(opt_variants.begin(), opt_variants.end(), variant.name) == opt_variants.end())
+        continue;
+
+      if (!std::filesystem::exists(directory / ("_application-v" + variant.name))) {
+        std::cerr << "warn: the variant '" << variant.name << "' isn't built and will be skipped" << '\n';
+        continue;
+      }
+
+      variants.push_back(variant);
+    }
+  } catch (const std::logic_error& e) {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+
+  if (variants.empty()) {
+    std::cerr << "erro: there are no variants to execute" << '\n';
+    return 1;
+  }
+
+  try {
+    std::filesystem::create_directories(workspace);
+  } catch (const std::filesystem::filesystem_error&) {
+    std::cerr << "erro: can't create the directory '" << workspace.generic_string() << "' (denoted by -w option)" << '\n';
+    return 1;
+  }
+
+  // Initialise list of experiments (scaling, vertex count, thread count), the
+  // vertex count of weak scaling is a target, which is rounded for every
+  // variant (see below)
+  //
+  std::vector<std::tuple<std::string, double, int>> experiments;
+  for (auto n : opt_sizes)
+    for (auto t : opt_threads)
+      experiments.push_back(std::make_tuple("strong", double(n), t));
+
+  if (opt_weak_size != 0) {
+    // Keep `v * v * v / t` constant
+    //
+    for (auto t : opt_threads)
+      experiments.push_back(std::make_tuple("weak", double(opt_weak_size) * std::cbrt(double(t)), t));
+  }
+
+  auto failures = 0;
+
+  std::vector<harness_result> results;
+  try {
+    for (auto& variant : variants) {
+      auto executable = directory / ("_application-v" + variant.name);
+
+      // Vertex count of weak scaling is rounded to a multiple of the block size
+      // for blocked variants (which require it) and to a multiple of 8 for the
+      // rest of them
+      //
+      const auto granularity = variant.layout == "blocks" ? opt_block_size : size_type(8);
+
+      // Baseline (single thread) median of each scaling and size, it is used
+      // to calculate speedup and efficiency
+      //
+      std::map<std::string, double> baselines;
+      for (auto [scaling, target, t] : experiments) {
+        if (!variant.parallel && t != 1)
+          continue;
+
+        auto n = size_type(target);
+        if (scaling == "weak")
+          n = std::max(size_type(std::llround(target / double(granularity))), size_type(1)) * granularity;
+
+        auto [graph_path, communities_path] = prepare_graph(workspace, n, opt_edge_percent, std::min(opt_communities, n));
+
+        harness_result result{ variant.name, scaling, n, t };
+        for (auto k = 0; k < opt_repeats; ++k) {
+          std::cerr << "Running: " << variant.name << " (" << scaling << ", v: " << n << ", t: " << t << ", #" << k << ")" << std::endl;
+
+          auto ms = execute_variant(executable, variant, graph_path, communities_path, t, opt_block_size, opt_reserve);
+          if (ms < 0.0) {
+            result.failed = true;
+            break;
+          }
+
+          result.samples.push_back(ms);
+        }
+
+        // A failed experiment is recorded (without measurements) and the
+        // sweep continues with the rest of experiments
+        //
+        if (result.failed) {
+          std::cerr << "warn: the variant '" << variant.name << "' has failed (" << scaling << ", v: " << n << ", t: " << t << "), please investigate" << '\n';
+
+          result.samples.clear();
+          results.push_back(result);
+
+          ++failures;
+          continue;
+        }
+
+        calculate_statistics(result);
+
+        auto key = scaling == "strong" ? scaling + "-" + std::to_string(n) : scaling;
+        if (t == 1)
+          baselines[key] = result.median;
+
+        auto baseline = baselines[key];
+
+        // Strong scaling: speedup is `T(1) / T(t)` and efficiency is `speedup / t`,
+        // weak scaling: the ideal time is constant, so efficiency is `T(1) / T(t)`
+        // and speedup is `t * efficiency`
+        //
+        auto ratio = result.median > 0.0 ? baseline / result.median : 0.0;
+        if (scaling == "strong") {
+          result.speedup    = ratio;
+          result.efficiency = ratio / double(t);
+        } else {
+          result.speedup    = ratio * double(t);
+          result.efficiency = ratio;
+        }
+
+        results.push_back(result);
+      }
+    }
+  } catch (const std::exception& e) {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+
+  // Open the output stream
+  //
+  std::ofstream output_fstream(opt_output);
+  if (!opt_output.empty() && !output_fstream.is_open()) {
+    std::cerr << "erro: can't open output file (denoted by -o option)";
+    return 1;
+  }
+
+  std::ostream& output_stream = output_fstream.is_open() ? output_fstream : std::cout;
+
+  if (opt_output_format == "json")
+    print_json(output_stream, results);
+  else
+    print_csv(output_stream, results);
+
+  output_stream.flush();
+
+  if (failures != 0) {
+    std::cerr << "erro: " << failures << " experiment(s) have failed" << '\n';
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,791 @@
+// gtest
+//
+#include "gtest/gtest.h"
+
+// global includes
+//
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#ifdef _OPENMP
+  #include <omp.h>
+#endif
+
+// local utilz
+//
+#include "graphs-edges.hpp"
+#include "graphs-ingest.hpp"
+#include "graphs-io.hpp"
+#include "graphs-ordering.hpp"
+#include "constants.hpp"
+#include "matrix.hpp"
+#include "matrix-access.hpp"
+#include "matrix-io.hpp"
+#include "matrix-layout.hpp"
+#include "memory.hpp"
+#include "memory-scratch.hpp"
+
+#ifndef _WIN32
+#include "memory-mmap.hpp"
+#endif
+
+namespace utzmx = ::utilz::matrices;
+namespace utzly = ::utilz::matrices::layout;
+namespace utzmi = ::utilz::matrices::io;
+namespace utzio = ::utilz::graphs::io;
+
+using buffer_type = ::utilz::memory::buffer_arena;
+
+namespace {
+
+std::shared_ptr<char>
+make_memory(size_t size)
+{
+  return std::shared_ptr<char>(new char[size], std::default_delete<char[]>());
+};
+
+} // namespace
+
+// ---
+// buffer_arena
+//
+
+TEST(buffer_arena, concurrent_allocate_deallocate)
+{
+  buffer_type buffer(64);
+
+  const auto sizes = std::vector<size_t>{ 1, 24, 64, 100, 512, 4096, 4097, 8192, 65536 };
+
+  auto failures = 0;
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(dynamic) reduction(+ : failures)
+#endif
+  for (auto i = 0; i < 2048; ++i) {
+    const auto size = sizes[size_t(i) % sizes.size()];
+
+    auto p = buffer.allocate(size);
+    std::memset(p, i & 0x7F, size);
+
+    for (auto k = size_t(0); k < size; ++k)
+      if (p[k] != char(i & 0x7F)) {
+        ++failures;
+        break;
+      }
+
+    buffer.deallocate(p, size);
+  }
+
+  const auto statistics = buffer.statistics();
+
+  ASSERT_EQ(failures, 0);
+  ASSERT_EQ(statistics.used, size_t(0));
+  ASSERT_GE(statistics.peak, size_t(65536));
+};
+
+TEST(buffer_arena, concurrent_allocations_fit_reservation)
+{
+  const auto requests = std::vector<size_t>(size_t(512), size_t(96));
+
+  const auto size = buffer_type::reservation(requests, 64);
+
+  buffer_type buffer(make_memory(size), size, 64);
+
+  auto failures = 0;
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static, 1) reduction(+ : failures)
+#endif
+  for (auto i = size_t(0); i < requests.size(); ++i) {
+    try {
+      buffer.allocate(requests[i]);
+    } catch (const std::runtime_error&) {
+      ++failures;
+    }
+  }
+
+  ASSERT_EQ(failures, 0);
+};
+
+TEST(buffer_arena, size_class_reuse)
+{
+  buffer_type buffer(64);
+
+  auto p = buffer.allocate(100);
+  buffer.deallocate(p, 100);
+
+  // 70 and 100 bytes belong to the same (128 bytes) size class
+  //
+  auto q = buffer.allocate(70);
+
+  ASSERT_EQ(p, q);
+
+  auto r = buffer.allocate(300);
+
+  ASSERT_NE(p, r);
+};
+
+TEST(buffer_arena, large_reuse_by_exact_size)
+{
+  buffer_type buffer(64);
+
+  auto p = buffer.allocate(8192);
+  buffer.deallocate(p, 8192);
+
+  auto q = buffer.allocate(16384);
+
+  ASSERT_NE(p, q);
+
+  auto r = buffer.allocate(8192);
+
+  ASSERT_EQ(p, r);
+};
+
+TEST(buffer_arena, fixed_reservation_exhaustion)
+{
+  const auto size = buffer_type::reservation({ 8192 }, 64);
+
+  buffer_type buffer(make_memory(size), size, 64);
+
+  auto p = buffer.allocate(8192);
+
+  ASSERT_NE(p, nullptr);
+  ASSERT_THROW(buffer.allocate(8192), std::runtime_error);
+
+  // A freed block of the same size is reused instead of the reservation
+  //
+  buffer.deallocate(p, 8192);
+
+  ASSERT_EQ(buffer.allocate(8192), p);
+};
+
+TEST(buffer_arena, statistics)
+{
+  buffer_type buffer(64);
+
+  auto p = buffer.allocate(8192);
+  auto q = buffer.allocate(8192);
+
+  buffer.deallocate(p, 8192);
+
+  const auto statistics = buffer.statistics();
+
+  ASSERT_EQ(statistics.reserved, size_t(16384));
+  ASSERT_EQ(statistics.used, size_t(8192));
+  ASSERT_EQ(statistics.peak, size_t(16384));
+  ASSERT_DOUBLE_EQ(statistics.fragmentation(), 0.5);
+
+  buffer.deallocate(q, 8192);
+
+  ASSERT_EQ(buffer.statistics().used, size_t(0));
+  ASSERT_EQ(buffer.statistics().peak, size_t(16384));
+  ASSERT_DOUBLE_EQ(buffer.statistics().fragmentation(), 1.0);
+};
+
+// ---
+// scratch_arena
+//
+
+TEST(scratch_arena, team_larger_than_cores)
+{
+  // Oversubscribe the cores (as OMP_NUM_THREADS larger than the number of
+  // cores does), the arena is sized from the team and not from the cores
+  //
+#ifdef _OPENMP
+  const auto cores   = (std::max)(size_t(1), size_t(std::thread::hardware_concurrency()));
+  const auto threads = omp_get_max_threads();
+
+  omp_set_num_threads(int(cores * size_t(4)));
+#endif
+
+  const auto workers = ::utilz::memory::scratch_arena<int>::team_size();
+  const auto length  = size_t(100);
+
+  buffer_type buffer(64);
+
+  ::utilz::memory::scratch_arena<int> scratch;
+  scratch.reserve(buffer, 2, length, -1);
+
+  ASSERT_EQ(scratch.workers(), workers);
+
+  auto failures = 0;
+
+#ifdef _OPENMP
+  #pragma omp parallel reduction(+ : failures)
+#endif
+  {
+    const auto context = scratch.context();
+#ifdef _OPENMP
+    const auto worker = omp_get_thread_num();
+#else
+    const auto worker = 0;
+#endif
+
+    for (auto a = size_t(0); a < size_t(2); ++a)
+      for (auto k = size_t(0); k < length; ++k) {
+        if (context.array(a)[k] != -1)
+          ++failures;
+
+        context.array(a)[k] = worker;
+      }
+
+#ifdef _OPENMP
+  #pragma omp barrier
+#endif
+
+    for (auto a = size_t(0); a < size_t(2); ++a)
+      for (auto k = size_t(0); k < length; ++k)
+        if (context.array(a)[k] != worker)
+          ++failures;
+  }
+
+#ifdef _OPENMP
+  omp_set_num_threads(threads);
+
+  ASSERT_EQ(workers, cores * size_t(4));
+#endif
+
+  ASSERT_EQ(failures, 0);
+};
+
+TEST(scratch_arena_DeathTest, team_larger_than_reserved)
+{
+  // The arena is filled by a parallel team, so the child is re-executed
+  // instead of being forked from a threaded process
+  //
+  ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+  buffer_type buffer(64);
+
+  ::utilz::memory::scratch_arena<int> scratch;
+  scratch.reserve(buffer, 2, 100, 0);
+
+  ASSERT_DEATH(scratch.context(scratch.workers()), "doesn't have scratch arrays");
+};
+
+// ---
+// relayout
+//
+
+TEST(relayout, permute_chunks)
+{
+  const auto count = size_t(7);
+  const auto chunk = size_t(3);
+
+  // Chunk `x` receives the chunk, which was at `(x * 3 + 1) % 7`
+  //
+  auto source = [count](size_t x) -> size_t { return (x * 3 + 1) % count; };
+
+  std::vector<int> data(count * chunk);
+  std::iota(data.begin(), data.end(), 0);
+
+  const auto original = data;
+
+  utzly::impl::permute_chunks(data.data(), count, chunk, source, true);
+
+  for (auto x = size_t(0); x < count; ++x)
+    for (auto k = size_t(0); k < chunk; ++k)
+      ASSERT_EQ(data[x * chunk + k], original[source(x) * chunk + k]) << "  chunk is: " << x;
+};
+
+TEST(relayout, relayout_bands)
+{
+  const auto n = size_t(12);
+  const auto b = size_t(4);
+
+  std::vector<int> data(n * n);
+  std::iota(data.begin(), data.end(), 0);
+
+  const auto original = data;
+
+  utzly::impl::relayout_bands(data.data(), n, b, true);
+
+  // Every band of `b` rows is a sequence of `b * b` tiles
+  //
+  for (auto i = size_t(0); i < n; ++i)
+    for (auto j = size_t(0); j < n; ++j)
+      ASSERT_EQ(data[(i / b) * b * n + (j / b) * b * b + (i % b) * b + j % b], original[i * n + j]) << "  indexes are: [" << i << "," << j << "]";
+
+  utzly::impl::relayout_bands(data.data(), n, b, false);
+
+  ASSERT_EQ(data, original);
+};
+
+TEST(relayout, round_trip)
+{
+  // The size isn't a power of two (so the Z-order of 3 * 3 tiles is
+  // incomplete) and rows are padded
+  //
+  const auto n      = size_t(12);
+  const auto ld     = size_t(15);
+  const auto b      = size_t(4);
+  const auto blocks = n / b;
+
+  utzmx::square_matrix<int> m(n, ld, std::allocator<int>());
+  for (auto i = size_t(0); i < n; ++i)
+    for (auto j = size_t(0); j < n; ++j)
+      m.at(i, j) = int(i * n + j);
+
+  const auto original = m;
+
+  utzly::relayout(m, b, utzly::matrix_layout::matrix_layout_flat, utzly::matrix_layout::matrix_layout_tiled);
+
+  const auto data = m.at(0);
+  for (auto i = size_t(0); i < n; ++i)
+    for (auto j = size_t(0); j < n; ++j)
+      ASSERT_EQ(data[((i / b) * blocks + j / b) * b * b + (i % b) * b + j % b], original.at(i, j)) << "  indexes are: [" << i << "," << j << "]";
+
+  utzly::relayout(m, b, utzly::matrix_layout::matrix_layout_tiled, utzly::matrix_layout::matrix_layout_morton);
+
+  const auto positions = utzly::tiles_positions(utzly::matrix_layout::matrix_layout_morton, blocks);
+  for (auto i = size_t(0); i < n; ++i)
+    for (auto j = size_t(0); j < n; ++j)
+      ASSERT_EQ(data[positions[(i / b) * blocks + j / b] * b * b + (i % b) * b + j % b], original.at(i, j)) << "  indexes are: [" << i << "," << j << "]";
+
+  utzly::relayout(m, b, utzly::matrix_layout::matrix_layout_morton, utzly::matrix_layout::matrix_layout_flat);
+
+  for (auto i = size_t(0); i < n; ++i)
+    for (auto j = size_t(0); j < n; ++j)
+      ASSERT_EQ(m.at(i, j), original.at(i, j)) << "  indexes are: [" << i << "," << j << "]";
+};
+
+TEST(relayout, size_not_multiple_of_tile)
+{
+  std::vector<int> data(size_t(10) * size_t(10));
+
+  ASSERT_THROW(
+    utzly::relayout(data.data(), 10, 4, utzly::matrix_layout::matrix_layout_flat, utzly::matrix_layout::matrix_layout_tiled),
+    std::logic_error);
+};
+
+// ---
+// scan_graph_pipelined
+//
+
+namespace {
+
+using edges_type = std::vector<std::tuple<int, int, float>>;
+
+std::tuple<int, edges_type>
+scan_sequential(utzio::graph_format format, const std::string& text)
+{
+  std::istringstream is(text);
+  return utzio::scan_graph<int, float>(format, is);
+};
+
+std::tuple<int, edges_type>
+scan_pipelined(utzio::graph_format format, const std::string& text, size_t threads = size_t(3), size_t chunk_size = size_t(7))
+{
+  std::istringstream is(text);
+  return utzio::scan_graph_pipelined<int, float>(format, is, threads, chunk_size);
+};
+
+} // namespace
+
+TEST(scan_graph_pipelined, matches_scan_graph)
+{
+  // Lines are longer than chunks, so most of the chunks carry a partial line
+  //
+  const auto graphs = std::vector<std::tuple<utzio::graph_format, std::string>>{
+    { utzio::graph_format::graph_fmt_edgelist, "0 1\n1 2\n2 0\n10 3\n3 11\n4 5\n" },
+    { utzio::graph_format::graph_fmt_weightlist, "0 1 1.5\n1 2 2\n2 0 12.25\n10 3 4\n3 11 5\n4 5 6\n" },
+    { utzio::graph_format::graph_fmt_dimacs, "c comment\np sp 12 6\nc comment\na 0 1 1.5\na 1 2 2\na 2 0 12.25\na 10 3 4\na 3 11 5\na 4 5 6\n" },
+    { utzio::graph_format::graph_fmt_dimacs, "a 0 1 1.5\na 1 2 2\n" }
+  };
+
+  for (const auto& [format, text] : graphs) {
+    const auto [expected_vc, expected_edges] = scan_sequential(format, text);
+
+    for (auto chunk_size : { size_t(1), size_t(7), size_t(4096) }) {
+      const auto [vc, edges] = scan_pipelined(format, text, 3, chunk_size);
+
+      ASSERT_EQ(vc, expected_vc) << "  text is: " << text << "  chunk size is: " << chunk_size;
+      ASSERT_EQ(edges, expected_edges) << "  text is: " << text << "  chunk size is: " << chunk_size;
+    }
+  }
+};
+
+TEST(scan_graph_pipelined, final_line_without_newline)
+{
+  const auto text = std::string("0 1 1\n1 2 2\n2 13 3");
+
+  const auto [vc, edges] = scan_pipelined(utzio::graph_format::graph_fmt_weightlist, text);
+
+  ASSERT_EQ(vc, 14);
+  ASSERT_EQ(edges.size(), size_t(3));
+  ASSERT_EQ(edges.back(), std::make_tuple(2, 13, 3.0f));
+  ASSERT_EQ(edges, std::get<1>(scan_sequential(utzio::graph_format::graph_fmt_weightlist, text)));
+};
+
+TEST(scan_graph_pipelined, malformed_line)
+{
+  const auto text = std::string("0 1 1\n1 2 2\n2 x 3\n3 4 4\n4 5 5\n");
+
+  ASSERT_THROW(scan_sequential(utzio::graph_format::graph_fmt_weightlist, text), std::logic_error);
+  ASSERT_THROW(scan_pipelined(utzio::graph_format::graph_fmt_weightlist, text), std::logic_error);
+
+  ASSERT_THROW(scan_pipelined(utzio::graph_format::graph_fmt_dimacs, "a 0 1 1\nx 1 2 2\n"), std::logic_error);
+};
+
+TEST(scan_graph_pipelined, preamble_count_mismatch)
+{
+  // Edges refer to vertexes beyond the declared number of vertexes
+  //
+  const auto vertexes = std::string("p 2 2\na 0 1 1\na 1 2 2\n");
+
+  ASSERT_THROW(scan_sequential(utzio::graph_format::graph_fmt_dimacs, vertexes), std::logic_error);
+  ASSERT_THROW(scan_pipelined(utzio::graph_format::graph_fmt_dimacs, vertexes), std::logic_error);
+
+  // The declared number of edges doesn't match
+  //
+  const auto edges = std::string("p sp 3 3\na 0 1 1\na 1 2 2\n");
+
+  ASSERT_THROW(scan_sequential(utzio::graph_format::graph_fmt_dimacs, edges), std::logic_error);
+  ASSERT_THROW(scan_pipelined(utzio::graph_format::graph_fmt_dimacs, edges), std::logic_error);
+
+  // Isolated vertexes after the last one referred by edges are kept
+  //
+  const auto isolated = std::string("p sp 5 2\na 0 1 1\na 1 2 2\n");
+
+  ASSERT_EQ(std::get<0>(scan_sequential(utzio::graph_format::graph_fmt_dimacs, isolated)), 5);
+  ASSERT_EQ(std::get<0>(scan_pipelined(utzio::graph_format::graph_fmt_dimacs, isolated)), 5);
+};
+
+// ---
+// edges_container
+//
+
+TEST(edges_container, widen_and_shrink_to_fit)
+{
+  const auto wide = size_t(5000000000);
+
+  ::utilz::graphs::edges_container<size_t, int> edges;
+
+  edges.push_back(0, 1, 1);
+  edges.push_back(2, 3, 2);
+
+  ASSERT_TRUE(edges.narrow());
+
+  // A vertex, which doesn't fit into 32 bits, switches the storage
+  //
+  edges.push_back(4, wide, 3);
+
+  ASSERT_FALSE(edges.narrow());
+  ASSERT_EQ(edges.size(), size_t(3));
+  ASSERT_EQ(edges.at(0), std::make_tuple(size_t(0), size_t(1), 1));
+  ASSERT_EQ(edges.at(1), std::make_tuple(size_t(2), size_t(3), 2));
+  ASSERT_EQ(edges.at(2), std::make_tuple(size_t(4), wide, 3));
+
+  // The storage stays wide while any of the vertexes doesn't fit
+  //
+  edges.shrink_to_fit();
+
+  ASSERT_FALSE(edges.narrow());
+
+  edges.set(2, 4, 5);
+  edges.shrink_to_fit();
+
+  ASSERT_TRUE(edges.narrow());
+  ASSERT_EQ(edges.at(0), std::make_tuple(size_t(0), size_t(1), 1));
+  ASSERT_EQ(edges.at(1), std::make_tuple(size_t(2), size_t(3), 2));
+  ASSERT_EQ(edges.at(2), std::make_tuple(size_t(4), size_t(5), 3));
+};
+
+// ---
+// compact_graph
+//
+
+TEST(compact_graph, sparse_ids)
+{
+  const auto original = std::vector<std::tuple<size_t, size_t, int>>{
+    { 1000000, 7, 1 },
+    { 7, size_t(5000000000), 2 },
+    { size_t(5000000000), 1000000, 3 },
+    { 7, 1000000, 4 }
+  };
+
+  ::utilz::graphs::edges_container<size_t, int> edges;
+  for (auto& edge : original)
+    edges.push_back(edge);
+
+  ASSERT_FALSE(edges.narrow());
+
+  auto vc  = size_t(5000000001);
+  auto ids = ::utilz::graphs::ordering::compact_graph(vc, edges);
+
+  ASSERT_EQ(vc, size_t(3));
+  ASSERT_EQ(ids, (std::vector<size_t>{ 7, 1000000, size_t(5000000000) }));
+
+  // Compacted vertexes fit into 32 bits again, original vertexes are restored
+  // through `ids` (in the order of edges)
+  //
+  ASSERT_TRUE(edges.narrow());
+  ASSERT_EQ(edges.size(), original.size());
+
+  for (auto x = size_t(0); x < edges.size(); ++x) {
+    ASSERT_LT(edges.from(x), vc);
+    ASSERT_LT(edges.to(x), vc);
+    ASSERT_EQ(std::make_tuple(ids[edges.from(x)], ids[edges.to(x)], edges.weight(x)), original[x]) << "  edge is: " << x;
+  }
+};
+
+TEST(compact_graph, isolated_vertexes)
+{
+  // Vertexes 1, 3, 4, 6 and 7 are declared by the preamble, but have no edges
+  //
+  std::istringstream is("p sp 8 2\na 0 2 1\na 2 5 2\n");
+
+  auto [vc, edges] = utzio::scan_graph<size_t, int, ::utilz::graphs::edges_container<size_t, int>>(utzio::graph_format::graph_fmt_dimacs, is);
+
+  ASSERT_EQ(vc, size_t(8));
+
+  auto ids = ::utilz::graphs::ordering::compact_graph(vc, edges);
+
+  ASSERT_EQ(vc, size_t(3));
+  ASSERT_EQ(ids, (std::vector<size_t>{ 0, 2, 5 }));
+};
+
+#ifndef _WIN32
+
+// ---
+// buffer_mmap
+//
+
+namespace {
+
+using mapped_graph_type = std::tuple<size_t, ::utilz::graphs::edges_container<size_t, int>>;
+
+mapped_graph_type
+make_mapped_graph(size_t vc)
+{
+  mapped_graph_type graph;
+
+  auto& [count, edges] = graph;
+
+  count = vc;
+  for (auto v = size_t(0); v < vc; ++v) {
+    edges.push_back(v, (v + 1) % vc, int(v % 3 + 1));
+    edges.push_back(v, (v * 7 + 3) % vc, int(v % 5 + 4));
+  }
+  return graph;
+};
+
+template<typename A>
+void
+compute_mapped_matrix(A& matrix_access, size_t vc)
+{
+  for (auto k = size_t(0); k < vc; ++k)
+    for (auto i = size_t(0); i < vc; ++i)
+      for (auto j = size_t(0); j < vc; ++j)
+        matrix_access.at(i, j) = (std::min)(matrix_access.at(i, j), matrix_access.at(i, k) + matrix_access.at(k, j));
+};
+
+// Reads the matrix back from the description in the mapped file and prints it
+// in the same way as `print_matrix` does (using labels and ids, if any)
+//
+std::string
+print_mapped_matrix(const std::string& path)
+{
+  std::ifstream fs(path, std::ios::binary);
+
+  const std::vector<char> file((std::istreambuf_iterator<char>(fs)), std::istreambuf_iterator<char>());
+
+  ::utilz::memory::buffer_mmap_header header;
+  std::memcpy(&header, file.data(), sizeof(header));
+
+  EXPECT_EQ(std::string(header.magic, sizeof(header.magic)), "APSPMMAP");
+  EXPECT_EQ(header.element_size, uint64_t(sizeof(int)));
+  EXPECT_EQ(header.blocks_count, header.blocks * header.blocks);
+  EXPECT_EQ(file.size(), size_t(header.rows_offset + header.rows_count * sizeof(uint64_t)));
+
+  auto read = [&file](auto& records, uint64_t offset) -> void {
+    std::memcpy(records.data(), file.data() + offset, records.size() * sizeof(records[0]));
+  };
+
+  std::vector<::utilz::memory::buffer_mmap_block> blocks(header.blocks_count);
+  std::vector<uint64_t>                           labels(header.labels_count);
+  std::vector<uint64_t>                           ids(header.ids_count);
+  std::vector<uint64_t>                           rows(header.rows_count);
+
+  read(blocks, header.blocks_offset);
+  read(labels, header.labels_offset);
+  read(ids, header.ids_offset);
+  read(rows, header.rows_offset);
+
+  // Rows (and columns) of blocks start after the rows of preceding diagonal
+  // blocks, which are either of the block size or of sizes of communities
+  //
+  std::vector<uint64_t> offsets(header.blocks + 1, uint64_t(0));
+  for (auto k = uint64_t(0); k < header.blocks; ++k)
+    offsets[k + 1] = offsets[k] + blocks[k * header.blocks + k].height;
+
+  auto vertex = [&rows](uint64_t x) -> uint64_t { return rows.empty() ? x : rows[x]; };
+
+  // Blocked matrices are padded up to a multiple of the block size
+  //
+  const auto size = offsets.back();
+
+  std::vector<int> values(size * size);
+  for (auto ib = uint64_t(0); ib < header.blocks; ++ib)
+    for (auto jb = uint64_t(0); jb < header.blocks; ++jb) {
+      const auto& block = blocks[ib * header.blocks + jb];
+      for (auto r = uint64_t(0); r < block.height; ++r)
+        for (auto c = uint64_t(0); c < block.width; ++c) {
+          auto x = vertex(offsets[ib] + r) * size + vertex(offsets[jb] + c);
+          std::memcpy(&values[x], file.data() + block.offset + (r * block.stride + c) * header.element_size, sizeof(int));
+        }
+    }
+
+  auto label = [&labels](uint64_t v) -> uint64_t { return labels.empty() ? v : labels[v]; };
+  auto id    = [&ids](uint64_t v) -> uint64_t { return ids.empty() ? v : ids[v]; };
+
+  const auto n        = labels.empty() ? header.vertices : uint64_t(labels.size());
+  const auto infinity = ::utilz::constants::infinity<int>();
+
+  std::vector<std::tuple<size_t, size_t, int>> edges;
+  for (auto i = uint64_t(0); i < n; ++i)
+    for (auto j = uint64_t(0); j < n; ++j) {
+      auto value = values[label(i) * size + label(j)];
+      if (i != j && value != infinity)
+        edges.push_back(std::make_tuple(size_t(id(i)), size_t(id(j)), value));
+    }
+
+  std::ostringstream os;
+  utzio::print_graph(utzio::graph_format::graph_fmt_weightlist, os, size_t(ids.empty() ? n : ids.back() + 1), edges);
+
+  return os.str();
+};
+
+std::string
+mapped_path(const char* name)
+{
+  return (std::filesystem::temp_directory_path() / (std::string("_test-utilz-") + name + ".mmap")).string();
+};
+
+} // namespace
+
+TEST(buffer_mmap, describe_blocks)
+{
+  using block_type  = utzmx::square_matrix<int, ::utilz::memory::buffer_allocator<int>>;
+  using matrix_type = utzmx::square_matrix<block_type, ::utilz::memory::buffer_allocator<block_type>>;
+
+  const auto path = mapped_path("blocks");
+
+  // The number of vertexes isn't a multiple of the block size, so the last
+  // row (and column) of blocks is padded
+  //
+  auto graph = make_mapped_graph(10);
+
+  std::string expected;
+  {
+    ::utilz::memory::buffer_mmap mapping(path, size_t(1024) * size_t(1024));
+
+    buffer_type buffer(mapping.memory(), mapping.size(), 64);
+
+    matrix_type                               matrix;
+    utzmx::access::matrix_params<matrix_type> matrix_params(4);
+    utzmi::scan_matrix_params<matrix_type>    scan_params(buffer, graph, 4);
+
+    utzmi::scan_init_matrix(matrix, scan_params);
+
+    utzmx::access::matrix_access<utzmx::access::matrix_access_schema_flat, matrix_type> matrix_access(matrix, matrix_params);
+
+    utzmi::scan_set_matrix(matrix_access, scan_params);
+
+    compute_mapped_matrix(matrix_access, std::get<0>(graph));
+
+    const auto rows = utzmi::storage_rows(matrix_access);
+
+    ASSERT_TRUE(rows.empty());
+
+    // Vertexes are stored in the reverse order (as if the graph was relabelled)
+    // and printed through labels, which also leaves out padding
+    //
+    std::vector<size_t> labels(std::get<0>(graph));
+    for (auto v = size_t(0); v < labels.size(); ++v)
+      labels[v] = labels.size() - v - 1;
+
+    mapping.describe(sizeof(int), std::get<0>(graph), size_t(matrix.size()), utzmi::storage_blocks(matrix), labels, std::vector<size_t>(), rows);
+    mapping.sync();
+
+    std::ostringstream os;
+    utzmi::print_matrix(utzio::graph_format::graph_fmt_weightlist, os, matrix_access, labels, std::vector<size_t>());
+
+    expected = os.str();
+  }
+
+  ASSERT_FALSE(expected.empty());
+  ASSERT_EQ(print_mapped_matrix(path), expected);
+
+  std::filesystem::remove(path);
+};
+
+TEST(buffer_mmap, describe_clusters)
+{
+  using block_type  = utzmx::rect_matrix<int, ::utilz::memory::buffer_allocator<int>>;
+  using matrix_type = utzmx::square_matrix<block_type, ::utilz::memory::buffer_allocator<block_type>>;
+
+  const auto path = mapped_path("clusters");
+
+  // Communities are of different sizes, so blocks are of different sizes and
+  // the vertexes of rows are written
+  //
+  auto graph = make_mapped_graph(10);
+
+  std::map<size_t, std::vector<size_t>> communities{
+    { 0, { 0, 1, 2 } },
+    { 1, { 3, 4, 5, 6, 7 } },
+    { 2, { 8, 9 } }
+  };
+
+  std::string expected;
+  {
+    ::utilz::memory::buffer_mmap mapping(path, size_t(1024) * size_t(1024));
+
+    buffer_type buffer(mapping.memory(), mapping.size(), 64);
+
+    matrix_type                               matrix;
+    utzmx::access::matrix_params<matrix_type> matrix_params(communities);
+    utzmi::scan_matrix_params<matrix_type>    scan_params(buffer, graph, communities);
+
+    utzmi::scan_init_matrix(matrix, scan_params);
+
+    utzmx::access::matrix_access<utzmx::access::matrix_access_schema_flat, matrix_type> matrix_access(matrix, matrix_params);
+
+    utzmi::scan_set_matrix(matrix_access, scan_params);
+
+    compute_mapped_matrix(matrix_access, std::get<0>(graph));
+
+    const auto rows = utzmi::storage_rows(matrix_access);
+
+    ASSERT_EQ(rows.size(), std::get<0>(graph));
+
+    mapping.describe(sizeof(int), std::get<0>(graph), size_t(matrix.size()), utzmi::storage_blocks(matrix), std::vector<size_t>(), std::vector<size_t>(), rows);
+    mapping.sync();
+
+    std::ostringstream os;
+    utzmi::print_matrix(utzio::graph_format::graph_fmt_weightlist, os, matrix_access);
+
+    expected = os.str();
+  }
+
+  ASSERT_FALSE(expected.empty());
+  ASSERT_EQ(print_mapped_matrix(path), expected);
+
+  std::filesystem::remove(path);
+};
+
+#endif
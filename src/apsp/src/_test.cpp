@@ -14,6 +14,7 @@
 // local utilz
 #include "communities-io.hpp"
 #include "graphs-io.hpp"
+#include "graphs-edges.hpp"
 #include "matrix-io.hpp"
 #include "matrix-manip.hpp"
 #include "matrix-traits.hpp"
@@ -25,7 +26,7 @@
 //
 #include "_shell_inject.hpp"
 
-using buffer_type      = ::utilz::memory::buffer_dyn;
+using buffer_type      = ::utilz::memory::buffer_arena;
 
 class Fixture : public ::testing::Test
 {
@@ -85,8 +86,8 @@ public:
     throw std::logic_error("erro: the file '" + res_path.generic_string() + "' doesn't exist.");
 
     graph_format_type graph_format = graph_format_type::graph_fmt_weightlist;
-    graph_type        src_graph    = ::utilz::graphs::io::scan_graph<size_type, value_type>(graph_format, src_fs);
-    graph_type        res_graph    = ::utilz::graphs::io::scan_graph<size_type, value_type>(graph_format, res_fs);
+    graph_type        src_graph    = ::utilz::graphs::io::scan_graph<size_type, value_type, edges_type>(graph_format, src_fs);
+    graph_type        res_graph    = ::utilz::graphs::io::scan_graph<size_type, value_type, edges_type>(graph_format, res_fs);
 
 #ifdef APSP_ALG_MATRIX_CLUSTERS
     communities_format_type communities_format   = communities_format_type::communities_fmt_rlang;
@@ -190,7 +191,7 @@ public:
   }
 };
 
-const auto graphs = testing::Values("7-7 (2)", "7-7 (3)", "7-7", "8-9", "9-12 (2)", "9-12", "10-14", "10-36", "17-46", "17-48", "17-57", "17-61 (2)", "17-61", "17-67", "32-376", "32-376 (2)");
+const auto graphs = testing::Values("7-7 (2)", "7-7 (3)", "7-7", "8-9", "9-12 (2)", "9-12", "10-14", "10-36", "17-46", "17-48", "17-57", "17-61 (2)", "17-61", "17-67", "32-376", "32-376 (2)", "127-504");
 
 #ifdef APSP_ALG_MATRIX_FLAT
 const auto values = graphs;
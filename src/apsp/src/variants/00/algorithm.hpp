@@ -6,6 +6,9 @@
 
 #include "portables/hacks/defines.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "matrix.hpp"
 #include "matrix-access.hpp"
 
@@ -15,6 +18,56 @@ using matrix_type            = utzmx::square_matrix<g_type, g_allocator_type<g_t
 using matrix_access_type     = utzmx::access::matrix_access<utzmx::access::matrix_access_schema_flat, matrix_type>;
 using matrix_params_type     = utzmx::access::matrix_params<matrix_type>;
 
+#ifdef APSP_ALG_KERNEL_PRUNING
+
+// Pruning flavour of the kernel. Row `k` doesn't change on iteration `k`,
+// therefore if `ik + min(kj)` is not less than the maximum of row `i`, none
+// of the values in the row can be improved and the row is skipped (this also
+// covers infinite `ik`). Maximums of rows are tracked along the relaxation
+// and never underestimated.
+//
+__hack_noinline
+void
+run(
+  matrix_type& matrix)
+{
+  using size_type  = typename utzmx::traits::matrix_traits<matrix_type>::size_type;
+  using value_type = typename utzmx::traits::matrix_traits<matrix_type>::value_type;
+
+  const auto x = matrix.size();
+
+  std::vector<value_type> row_max(x);
+  for (auto i = size_type(0); i < x; ++i)
+    row_max[i] = *std::max_element(matrix.at(i), matrix.at(i) + x);
+
+  for (auto k = size_type(0); k < x; ++k) {
+    const auto kj_min = *std::min_element(matrix.at(k), matrix.at(k) + x);
+
+#ifdef _OPENMP
+  #pragma omp parallel for default(none) shared(matrix, row_max) firstprivate(x, k, kj_min)
+#endif
+    for (auto i = size_type(0); i < x; ++i) {
+      const auto ik = matrix.at(i, k);
+      if (ik + kj_min >= row_max[i])
+        continue;
+
+      auto maximum = matrix.at(i, 0);
+#ifdef _OPENMP
+  #pragma omp simd reduction(max:maximum)
+#else
+      __hack_ivdep
+#endif
+      for (auto j = size_type(0); j < x; ++j) {
+        matrix.at(i, j) = (std::min)(matrix.at(i, j), ik + matrix.at(k, j));
+        maximum = (std::max)(maximum, matrix.at(i, j));
+      }
+      row_max[i] = maximum;
+    }
+  }
+};
+
+#else
+
 __hack_noinline
 void
 run(
@@ -36,3 +89,5 @@ run(
       for (auto j = size_type(0); j < x; ++j)
         matrix.at(i, j) = (std::min)(matrix.at(i, j), matrix.at(i, k) + matrix.at(k, j));
 };
+
+#endif
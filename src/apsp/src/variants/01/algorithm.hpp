@@ -6,34 +6,27 @@
 
 #include "portables/hacks/defines.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "measure.hpp"
 
 #include "matrix.hpp"
 #include "matrix-access.hpp"
+#include "matrix-layout.hpp"
+#include "matrix-summary.hpp"
+
+#include "kernel.hpp"
 
 namespace utzmx = ::utilz::matrices;
+namespace utzsm = ::utilz::matrices::summary;
+namespace utzly = ::utilz::matrices::layout;
 
 using matrix_block_type      = utzmx::square_matrix<g_type, g_allocator_type<g_type>>;
 using matrix_type            = utzmx::square_matrix<matrix_block_type, g_allocator_type<matrix_block_type>>;
 using matrix_access_type     = utzmx::access::matrix_access<utzmx::access::matrix_access_schema_flat, matrix_type>;
 using matrix_params_type     = utzmx::access::matrix_params<matrix_type>;
 
-void
-calculate_block(
-  matrix_block_type& ij,
-  matrix_block_type& ik,
-  matrix_block_type& kj)
-{
-  using size_type = typename utzmx::traits::matrix_traits<matrix_block_type>::size_type;
-
-  const auto x = ij.size();
-  for (auto k = size_type(0); k < x; ++k)
-    for (auto i = size_type(0); i < x; ++i)
-      __hack_ivdep
-      for (auto j = size_type(0); j < x; ++j)
-        ij.at(i, j) = (std::min)(ij.at(i, j), ik.at(i, k) + kj.at(k, j));
-};
-
 __hack_noinline
 void
 run(
@@ -41,8 +34,14 @@ run(
 {
   using size_type = typename utzmx::traits::matrix_traits<matrix_type>::size_type;
 
+  utzsm::infinite_blocks infinite(matrix);
+
+  // Peripheral blocks are scheduled in the order of tiles layout
+  //
+  const auto sequence = utzly::tiles_sequence(utzly::tiles_layout(), matrix.size());
+
 #ifdef _OPENMP
-  #pragma omp parallel default(none) shared(matrix)
+  #pragma omp parallel default(none) shared(matrix, infinite, sequence)
 #endif
   {
 #ifdef _OPENMP
@@ -62,42 +61,49 @@ run(
             auto& im = matrix.at(i, m);
             auto& mi = matrix.at(m, i);
 
+            // Infinite blocks stay infinite when relaxed through
+            // themselves
+            //
+            if (!infinite.at(i, m)) {
 #ifdef _OPENMP
   #pragma omp task untied default(none) shared(im, mm)
 #endif
-            {
-              SCOPE_MEASURE_MILLISECONDS("VERT");
-              calculate_block(im, im, mm);
+              {
+                SCOPE_MEASURE_MILLISECONDS("VERT");
+                calculate_block(im, im, mm);
+              }
             }
 
+            if (!infinite.at(m, i)) {
 #ifdef _OPENMP
   #pragma omp task untied default(none) shared(mi, mm)
 #endif
-            {
-              SCOPE_MEASURE_MILLISECONDS("HORZ");
-              calculate_block(mi, mm, mi);
+              {
+                SCOPE_MEASURE_MILLISECONDS("HORZ");
+                calculate_block(mi, mm, mi);
+              }
             }
           }
         }
 #ifdef _OPENMP
   #pragma omp taskwait
 #endif
-        for (auto i = size_type(0); i < matrix.size(); ++i) {
-          if (i != m) {
+        for (auto tile : sequence) {
+          const auto i = std::get<0>(tile);
+          const auto j = std::get<1>(tile);
+          if (i != m && j != m && !infinite.at(i, m) && !infinite.at(m, j)) {
+            auto& ij = matrix.at(i, j);
             auto& im = matrix.at(i, m);
-            for (auto j = size_type(0); j < matrix.size(); ++j) {
-              if (j != m) {
-                auto& ij = matrix.at(i, j);
-                auto& mj = matrix.at(m, j);
+            auto& mj = matrix.at(m, j);
 
 #ifdef _OPENMP
-  #pragma omp task untied default(none) shared(ij, im, mj)
+  #pragma omp task untied default(none) shared(ij, im, mj, infinite) firstprivate(i, j)
 #endif
-                {
-                  SCOPE_MEASURE_MILLISECONDS("PERH");
-                  calculate_block(ij, im, mj);
-                }
-              }
+            {
+              SCOPE_MEASURE_MILLISECONDS("PERH");
+              calculate_block(ij, im, mj);
+
+              infinite.update(i, j, ij);
             }
           }
         }
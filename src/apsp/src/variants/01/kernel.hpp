@@ -0,0 +1,111 @@
+#pragma once
+
+#include "portables/hacks/defines.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "matrix-traits.hpp"
+
+// Min-plus kernel of blocked Floyd-Warshall (`ij = min(ij, ik + kj)`). The
+// kernel is shared by the variants which process blocks in the same order (01,
+// out-of-core 11 and 13). Blocks are either square matrices of the same size
+// or views of a flat matrix, which can be rectangular at its last row and
+// column of blocks (`ij` is `height(ij) x width(ij)` and `ik` is
+// `height(ij) x width(ik)`).
+//
+
+// Returns a height and a width of a block, square blocks have only a size
+//
+template<typename B>
+auto
+block_height(
+  B& b)
+{
+  if constexpr (requires { b.height(); })
+    return b.height();
+  else
+    return b.size();
+};
+
+template<typename B>
+auto
+block_width(
+  B& b)
+{
+  if constexpr (requires { b.width(); })
+    return b.width();
+  else
+    return b.size();
+};
+
+#ifdef APSP_ALG_KERNEL_PRUNING
+
+// Pruning flavour of the kernel. Row `k` of `kj` doesn't change on iteration
+// `k` (even when `kj` is `ij`), therefore if `ik + min(kj)` is not less than
+// the maximum of row `i` of `ij`, none of the values in the row can be
+// improved and the row is skipped (this also covers infinite `ik`). Maximums
+// of rows are tracked along the relaxation and never underestimated.
+//
+template<typename B>
+void
+calculate_block(
+  B& ij,
+  B& ik,
+  B& kj)
+{
+  using size_type  = typename ::utilz::matrices::traits::matrix_traits<B>::size_type;
+  using value_type = typename ::utilz::matrices::traits::matrix_traits<B>::value_type;
+
+  const auto h = size_type(block_height(ij));
+  const auto w = size_type(block_width(ij));
+  const auto x = size_type(block_width(ik));
+
+  static thread_local std::vector<value_type> row_max;
+
+  row_max.resize(h);
+  for (auto i = size_type(0); i < h; ++i)
+    row_max[i] = *std::max_element(ij.at(i), ij.at(i) + w);
+
+  for (auto k = size_type(0); k < x; ++k) {
+    const auto kj_min = *std::min_element(kj.at(k), kj.at(k) + w);
+
+    for (auto i = size_type(0); i < h; ++i) {
+      const auto ik_val = ik.at(i, k);
+      if (ik_val + kj_min >= row_max[i])
+        continue;
+
+      auto maximum = ij.at(i, 0);
+
+      __hack_ivdep
+      for (auto j = size_type(0); j < w; ++j) {
+        ij.at(i, j) = (std::min)(ij.at(i, j), ik_val + kj.at(k, j));
+        maximum = (std::max)(maximum, ij.at(i, j));
+      }
+      row_max[i] = maximum;
+    }
+  }
+};
+
+#else
+
+template<typename B>
+void
+calculate_block(
+  B& ij,
+  B& ik,
+  B& kj)
+{
+  using size_type = typename ::utilz::matrices::traits::matrix_traits<B>::size_type;
+
+  const auto h = size_type(block_height(ij));
+  const auto w = size_type(block_width(ij));
+  const auto x = size_type(block_width(ik));
+  for (auto k = size_type(0); k < x; ++k)
+    for (auto i = size_type(0); i < h; ++i)
+      __hack_ivdep
+      for (auto j = size_type(0); j < w; ++j)
+        ij.at(i, j) = (std::min)(ij.at(i, j), ik.at(i, k) + kj.at(k, j));
+};
+
+#endif
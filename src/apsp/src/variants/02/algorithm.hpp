@@ -35,6 +35,19 @@ struct run_configuration
   pointer mm_array_nxt_col;
 };
 
+// Returns sizes (in bytes) of allocations made by `up` (in the order they are
+// made) for a graph of `vertices`
+//
+std::vector<size_t>
+required_bytes(
+  matrix_params_type& params,
+  size_t              vertices)
+{
+  using value_type = typename utzmx::traits::matrix_traits<matrix_type>::value_type;
+
+  return std::vector<size_t>(size_t(4), vertices * sizeof(value_type));
+};
+
 __hack_noinline
 void
 up(
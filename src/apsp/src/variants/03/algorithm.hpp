@@ -8,16 +8,21 @@
 
 #include "portables/hacks/defines.h"
 
-#include <thread>
-#include <omp.h>
+#include <algorithm>
+#include <vector>
 
 #include "constants.hpp"
 #include "memory.hpp"
+#include "memory-scratch.hpp"
 
 #include "matrix.hpp"
 #include "matrix-access.hpp"
+#include "matrix-layout.hpp"
+#include "matrix-summary.hpp"
 
 namespace utzmx = ::utilz::matrices;
+namespace utzsm = ::utilz::matrices::summary;
+namespace utzly = ::utilz::matrices::layout;
 
 template<typename S>
 struct run_configuration;
@@ -28,22 +33,25 @@ using matrix_access_type     = utzmx::access::matrix_access<utzmx::access::matri
 using matrix_params_type     = utzmx::access::matrix_params<matrix_type>;
 using matrix_run_config_type = run_configuration<matrix_type>;
 
+// Scratch arrays of every worker (see `scratch_arena`)
+//
+enum scratch_arrays
+{
+  scratch_cur_row = 0,
+  scratch_prv_col = 1,
+  scratch_cur_col = 2,
+  scratch_nxt_row = 3,
+  scratch_ckb1    = 4,
+  scratch_ckb3w   = 5,
+  scratch_count   = 6
+};
+
 template<typename S>
 struct run_configuration
 {
-  using pointer = typename utzmx::traits::matrix_traits<S>::pointer;
-
-  pointer mm_array_cur_row;
-  pointer mm_array_prv_col;
-  pointer mm_array_cur_col;
-  pointer mm_array_nxt_row;
-  pointer ckb1;
-  pointer ck1b1;
-  pointer ckb1w;
-  pointer ckb3w;
-
-  size_t allocation_line;
-  size_t allocation_size;
+  using value_type = typename utzmx::traits::matrix_traits<S>::value_type;
+
+  ::utilz::memory::scratch_arena<value_type> scratch;
 };
 
 void
@@ -53,17 +61,25 @@ calculate_diagonal(
 {
   using size_type  = typename utzmx::traits::matrix_traits<matrix_block_type>::size_type;
   using value_type = typename utzmx::traits::matrix_traits<matrix_block_type>::value_type;
+  using pointer    = typename utzmx::traits::matrix_traits<matrix_block_type>::pointer;
+
+  const auto scratch = run_config.scratch.context();
 
-  run_config.mm_array_prv_col[0] = ::utilz::constants::infinity<value_type>();
-  run_config.mm_array_nxt_row[0] = mm.at(0, 1);
+  pointer mm_array_cur_row = scratch.array(scratch_cur_row);
+  pointer mm_array_prv_col = scratch.array(scratch_prv_col);
+  pointer mm_array_cur_col = scratch.array(scratch_cur_col);
+  pointer mm_array_nxt_row = scratch.array(scratch_nxt_row);
+
+  mm_array_prv_col[0] = ::utilz::constants::infinity<value_type>();
+  mm_array_nxt_row[0] = mm.at(0, 1);
 
   for (auto k = size_type(1); k < mm.size(); ++k) {
     for (auto i = size_type(0); i < k; ++i)
-      run_config.mm_array_cur_row[i] = ::utilz::constants::infinity<value_type>();
+      mm_array_cur_row[i] = ::utilz::constants::infinity<value_type>();
 
     for (auto i = size_type(0); i < k; ++i) {
       const auto x = mm.at(k, i);
-      const auto z = run_config.mm_array_prv_col[i];
+      const auto z = mm_array_prv_col[i];
 
       auto minimum = ::utilz::constants::infinity<value_type>();
 
@@ -71,27 +87,27 @@ calculate_diagonal(
       for (auto j = size_type(0); j < k; ++j) {
         mm.at(i, j) = (std::min)(mm.at(i, j), z + mm.at(k - 1, j));
 
-        minimum = (std::min)(minimum, mm.at(i, j) + run_config.mm_array_nxt_row[j]);
-        run_config.mm_array_cur_row[j] = (std::min)(run_config.mm_array_cur_row[j], mm.at(i, j) + x);
+        minimum = (std::min)(minimum, mm.at(i, j) + mm_array_nxt_row[j]);
+        mm_array_cur_row[j] = (std::min)(mm_array_cur_row[j], mm.at(i, j) + x);
       }
-      run_config.mm_array_cur_col[i] = minimum;
+      mm_array_cur_col[i] = minimum;
     }
 
     for (auto i = size_type(0); i < k; ++i) {
-      mm.at(k, i) = run_config.mm_array_cur_row[i];
-      mm.at(i, k) = run_config.mm_array_cur_col[i];
+      mm.at(k, i) = mm_array_cur_row[i];
+      mm.at(i, k) = mm_array_cur_col[i];
 
-      run_config.mm_array_prv_col[i] = run_config.mm_array_cur_col[i];
-      run_config.mm_array_nxt_row[i] = mm.at(i, k + 1);
+      mm_array_prv_col[i] = mm_array_cur_col[i];
+      mm_array_nxt_row[i] = mm.at(i, k + 1);
     }
 
     if (k < (mm.size() - 1))
-      run_config.mm_array_nxt_row[k] = mm.at(k, k + 1);
+      mm_array_nxt_row[k] = mm.at(k, k + 1);
   }
 
   const auto x = mm.size() - size_type(1);
   for (auto i = size_type(0); i < x; ++i) {
-    const auto ix = run_config.mm_array_prv_col[i];
+    const auto ix = mm_array_prv_col[i];
 
     __hack_ivdep
     for (auto j = size_type(0); j < x; ++j)
@@ -109,15 +125,11 @@ calculate_vertical(
   using value_type = typename utzmx::traits::matrix_traits<matrix_block_type>::value_type;
   using pointer    = typename utzmx::traits::matrix_traits<matrix_block_type>::pointer;
 
-#ifdef _OPENMP
-  auto allocation_shift = run_config.allocation_line * omp_get_thread_num();
-#else
-  auto allocation_shift = 0;
-#endif
+  const auto scratch = run_config.scratch.context();
 
-  pointer im_array_prv_weight = run_config.mm_array_prv_col + allocation_shift;
-  pointer im_array_cur_weight = run_config.mm_array_cur_row + allocation_shift;
-  pointer mm_array_nxt_weight = run_config.ckb3w + allocation_shift;
+  pointer im_array_prv_weight = scratch.array(scratch_prv_col);
+  pointer im_array_cur_weight = scratch.array(scratch_cur_row);
+  pointer mm_array_nxt_weight = scratch.array(scratch_ckb3w);
 
   const auto x = im.size();
 
@@ -168,13 +180,9 @@ calculate_horizontal(
   using size_type  = typename utzmx::traits::matrix_traits<matrix_block_type>::size_type;
   using pointer    = typename utzmx::traits::matrix_traits<matrix_block_type>::pointer;
 
-#ifdef _OPENMP
-  auto allocation_shift = run_config.allocation_line * omp_get_thread_num();
-#else
-  auto allocation_shift = 0;
-#endif
+  const auto scratch = run_config.scratch.context();
 
-  pointer mm_array_nxt_weight = run_config.ckb1 + allocation_shift;
+  pointer mm_array_nxt_weight = scratch.array(scratch_ckb1);
 
   const auto x = mi.size();
 
@@ -206,6 +214,52 @@ calculate_horizontal(
   }
 }
 
+#ifdef APSP_ALG_KERNEL_PRUNING
+
+// Pruning flavour of the peripheral kernel. Neither `ik` nor `kj` change in
+// the peripheral phase, therefore if `ik + min(kj)` is not less than the
+// maximum of row `i` of `ij`, none of the values in the row can be improved
+// through `k` and the row is skipped (this also covers infinite `ik`).
+//
+void
+calculate_peripheral(
+  matrix_block_type& ij,
+  matrix_block_type& ik,
+  matrix_block_type& kj)
+{
+  using size_type  = typename utzmx::traits::matrix_traits<matrix_block_type>::size_type;
+  using value_type = typename utzmx::traits::matrix_traits<matrix_block_type>::value_type;
+
+  const auto x = ij.size();
+
+  static thread_local std::vector<value_type> kj_min;
+
+  kj_min.resize(x);
+  for (auto k = size_type(0); k < x; ++k)
+    kj_min[k] = *std::min_element(kj.at(k), kj.at(k) + x);
+
+  for (auto i = size_type(0); i < x; ++i) {
+    auto row_max = *std::max_element(ij.at(i), ij.at(i) + x);
+
+    for (auto k = size_type(0); k < x; ++k) {
+      const auto ik_val = ik.at(i, k);
+      if (ik_val + kj_min[k] >= row_max)
+        continue;
+
+      auto maximum = ij.at(i, 0);
+
+      __hack_ivdep
+      for (auto j = size_type(0); j < x; ++j) {
+        ij.at(i, j) = (std::min)(ij.at(i, j), ik_val + kj.at(k, j));
+        maximum = (std::max)(maximum, ij.at(i, j));
+      }
+      row_max = maximum;
+    }
+  }
+}
+
+#else
+
 void
 calculate_peripheral(
   matrix_block_type& ij,
@@ -222,6 +276,24 @@ calculate_peripheral(
         ij.at(i, j) = (std::min)(ij.at(i, j), ik.at(i, k) + kj.at(k, j));
 }
 
+#endif
+
+
+// Returns sizes (in bytes) of allocations made by `up` (in the order they are
+// made) for a graph of `vertices`
+//
+std::vector<size_t>
+required_bytes(
+  matrix_params_type& params,
+  size_t              vertices)
+{
+  using value_type = typename utzmx::traits::matrix_traits<matrix_type>::value_type;
+
+  const auto block_size      = params.block_size();
+  const auto allocation_line = (vertices + block_size - size_t(1)) / block_size * block_size;
+
+  return { ::utilz::memory::scratch_arena<value_type>::required_bytes(scratch_count, allocation_line) };
+};
 
 __hack_noinline
 void
@@ -231,40 +303,11 @@ up(
   matrix_run_config_type&  matrix_run_config,
   ::utilz::memory::buffer& b)
 {
-  using size_type  = typename utzmx::traits::matrix_traits<matrix_type>::size_type;
   using value_type = typename utzmx::traits::matrix_traits<matrix_type>::value_type;
-  using pointer    = typename utzmx::traits::matrix_traits<matrix_type>::pointer;
-
-#ifdef _OPENMP
-  auto allocation_mulx = std::thread::hardware_concurrency();
-#else
-  auto allocation_mulx = 1;
-#endif
 
-  auto allocation_line = matrix_access.dimensions().max();
-  auto allocation_size = allocation_line * sizeof(value_type) * allocation_mulx;
-
-  matrix_run_config.allocation_line = allocation_line;
-  matrix_run_config.allocation_size = allocation_size;
-  matrix_run_config.mm_array_cur_row = reinterpret_cast<pointer>(b.allocate(allocation_size));
-  matrix_run_config.mm_array_prv_col = reinterpret_cast<pointer>(b.allocate(allocation_size));
-  matrix_run_config.mm_array_cur_col = reinterpret_cast<pointer>(b.allocate(allocation_size));
-  matrix_run_config.mm_array_nxt_row = reinterpret_cast<pointer>(b.allocate(allocation_size));
-  matrix_run_config.ckb1  = reinterpret_cast<pointer>(b.allocate(allocation_size));
-  matrix_run_config.ck1b1 = reinterpret_cast<pointer>(b.allocate(allocation_size));
-  matrix_run_config.ckb1w = reinterpret_cast<pointer>(b.allocate(allocation_size));
-  matrix_run_config.ckb3w = reinterpret_cast<pointer>(b.allocate(allocation_size));
-
-  for (size_type i = size_type(0); i < allocation_line * allocation_mulx; ++i) {
-    matrix_run_config.mm_array_cur_row[i] = ::utilz::constants::infinity<value_type>();
-    matrix_run_config.mm_array_prv_col[i] = ::utilz::constants::infinity<value_type>();
-    matrix_run_config.mm_array_cur_col[i] = ::utilz::constants::infinity<value_type>();
-    matrix_run_config.mm_array_nxt_row[i] = ::utilz::constants::infinity<value_type>();
-    matrix_run_config.ckb1[i]  = ::utilz::constants::infinity<value_type>();
-    matrix_run_config.ck1b1[i] = ::utilz::constants::infinity<value_type>();
-    matrix_run_config.ckb1w[i] = ::utilz::constants::infinity<value_type>();
-    matrix_run_config.ckb3w[i] = ::utilz::constants::infinity<value_type>();
-  }
+  // Every worker of the team gets its own scratch arrays
+  //
+  matrix_run_config.scratch.reserve(b, scratch_count, matrix_access.dimensions().max(), ::utilz::constants::infinity<value_type>());
 };
 
 __hack_noinline
@@ -275,16 +318,7 @@ down(
   matrix_run_config_type&  matrix_run_config,
   ::utilz::memory::buffer& b)
 {
-  using alptr_type = typename ::utilz::memory::buffer::pointer;
-
-  b.deallocate(reinterpret_cast<alptr_type>(matrix_run_config.mm_array_cur_row), matrix_run_config.allocation_size);
-  b.deallocate(reinterpret_cast<alptr_type>(matrix_run_config.mm_array_prv_col), matrix_run_config.allocation_size);
-  b.deallocate(reinterpret_cast<alptr_type>(matrix_run_config.mm_array_cur_col), matrix_run_config.allocation_size);
-  b.deallocate(reinterpret_cast<alptr_type>(matrix_run_config.mm_array_nxt_row), matrix_run_config.allocation_size);
-  b.deallocate(reinterpret_cast<alptr_type>(matrix_run_config.ckb1),  matrix_run_config.allocation_size);
-  b.deallocate(reinterpret_cast<alptr_type>(matrix_run_config.ck1b1), matrix_run_config.allocation_size);
-  b.deallocate(reinterpret_cast<alptr_type>(matrix_run_config.ckb1w), matrix_run_config.allocation_size);
-  b.deallocate(reinterpret_cast<alptr_type>(matrix_run_config.ckb3w), matrix_run_config.allocation_size);
+  matrix_run_config.scratch.release();
 }
 
 __hack_noinline
@@ -294,8 +328,15 @@ run(
   matrix_run_config_type& matrix_run_config)
 {
   using size_type  = typename utzmx::traits::matrix_traits<matrix_type>::size_type;
+
+  utzsm::infinite_blocks infinite(matrix);
+
+  // Peripheral blocks are scheduled in the order of tiles layout
+  //
+  const auto sequence = utzly::tiles_sequence(utzly::tiles_layout(), matrix.size());
+
 #ifdef _OPENMP
-  #pragma omp parallel default(none) shared(matrix, matrix_run_config)
+  #pragma omp parallel default(none) shared(matrix, matrix_run_config, infinite, sequence)
 #endif
   {
 #ifdef _OPENMP
@@ -311,33 +352,42 @@ run(
             auto& im = matrix.at(i, m);
             auto& mi = matrix.at(m, i);
 
+            // Infinite blocks stay infinite when relaxed through
+            // themselves
+            //
+            if (!infinite.at(i, m)) {
 #ifdef _OPENMP
   #pragma omp task untied default(none) shared(im, mm, matrix_run_config)
 #endif
-            calculate_vertical(im, mm, matrix_run_config);
+              calculate_vertical(im, mm, matrix_run_config);
+            }
 
+            if (!infinite.at(m, i)) {
 #ifdef _OPENMP
   #pragma omp task untied default(none) shared(mi, mm, matrix_run_config)
 #endif
-            calculate_horizontal(mi, mm, matrix_run_config);
+              calculate_horizontal(mi, mm, matrix_run_config);
+            }
           }
         }
 #ifdef _OPENMP
   #pragma omp taskwait
 #endif
-        for (auto i = size_type(0); i < matrix.size(); ++i) {
-          if (i != m) {
+        for (auto tile : sequence) {
+          const auto i = std::get<0>(tile);
+          const auto j = std::get<1>(tile);
+          if (i != m && j != m && !infinite.at(i, m) && !infinite.at(m, j)) {
+            auto& ij = matrix.at(i, j);
             auto& im = matrix.at(i, m);
-            for (auto j = size_type(0); j < matrix.size(); ++j) {
-              if (j != m) {
-                auto& ij = matrix.at(i, j);
-                auto& mj = matrix.at(m, j);
+            auto& mj = matrix.at(m, j);
 
 #ifdef _OPENMP
-  #pragma omp task untied default(none) shared(ij, im, mj)
+  #pragma omp task untied default(none) shared(ij, im, mj, infinite) firstprivate(i, j)
 #endif
-                calculate_peripheral(ij, im, mj);
-              }
+            {
+              calculate_peripheral(ij, im, mj);
+
+              infinite.update(i, j, ij);
             }
           }
         }
@@ -5,19 +5,40 @@
 
 #define APSP_ALG_ACCESS_CLUSTERS
 
+#define APSP_ALG_RUN_CONFIGURATION
+
 #include "portables/hacks/defines.h"
 
+#include <algorithm>
+#include <vector>
+
+#include "memory.hpp"
 #include "matrix.hpp"
 #include "matrix-traits.hpp"
 #include "matrix-access.hpp"
+#include "matrix-panels.hpp"
+#include "roofline.hpp"
 
 namespace utzmx = ::utilz::matrices;
+namespace utzpn = ::utilz::matrices::panels;
+
+template<typename S>
+struct run_configuration;
 
 using matrix_clusters_type   = utzmx::clusters;
 using matrix_block_type      = utzmx::rect_matrix<g_type, g_allocator_type<g_type>>;
 using matrix_type            = utzmx::square_matrix<matrix_block_type, g_allocator_type<matrix_block_type>>;
 using matrix_access_type     = utzmx::access::matrix_access<utzmx::access::matrix_access_schema_flat, matrix_type>;
 using matrix_params_type     = utzmx::access::matrix_params<matrix_type>;
+using matrix_run_config_type = run_configuration<matrix_type>;
+
+template<typename S>
+struct run_configuration
+{
+  using value_type = typename utzmx::traits::matrix_traits<S>::value_type;
+
+  utzpn::bridges_panels<value_type> panels;
+};
 
 void
 calculate_block(
@@ -28,16 +49,106 @@ calculate_block(
 {
   using size_type = typename utzmx::traits::matrix_traits<matrix_block_type>::size_type;
 
-  const auto ij_w = ij.width();
+  const auto ij_s = ij.stride();
   const auto ij_h = ij.height();
 
   for (auto k : bridges)
     for (auto i = size_type(0); i < ij_h; ++i)
       __hack_ivdep
-      for (auto j = size_type(0); j < ij_w; ++j)
+      for (auto j = size_type(0); j < ij_s; ++j)
         ij.at(i, j) = (std::min)(ij.at(i, j), ik.at(i, k) + kj.at(k, j));
 };
 
+#ifdef APSP_ALG_KERNEL_PRUNING
+
+// Pruning flavour of the kernel over panels (see below). Panels don't change
+// in the peripheral phase, therefore if `ik + min(kj)` is not less than the
+// maximum of row `i` of `ij`, none of the values in the row can be improved
+// through bridge `k` and the row is skipped. Only columns of the block are
+// relaxed, its padding is left as is.
+//
+void
+calculate_block(
+  matrix_block_type& ij,
+  const g_type*      ik,
+  const g_type*      kj,
+  size_t             count)
+{
+  using size_type  = typename utzmx::traits::matrix_traits<matrix_block_type>::size_type;
+  using value_type = typename utzmx::traits::matrix_traits<matrix_block_type>::value_type;
+
+  const auto ij_w = ij.width();
+  const auto ij_h = ij.height();
+
+  const auto ik_stride = utzpn::panel_stride<g_type>(count);
+  const auto kj_stride = utzpn::panel_stride<g_type>(ij.width());
+
+  static thread_local std::vector<value_type> kj_min;
+
+  kj_min.resize(count);
+  for (auto k = size_type(0); k < count; ++k)
+    kj_min[k] = *std::min_element(kj + k * kj_stride, kj + k * kj_stride + ij_w);
+
+  for (auto i = size_type(0); i < ij_h; ++i) {
+    const auto ij_row = ij.at(i);
+    const auto ik_row = ik + i * ik_stride;
+
+    auto row_max = *std::max_element(ij_row, ij_row + ij_w);
+
+    for (auto k = size_type(0); k < count; ++k) {
+      const auto ik_val = ik_row[k];
+      if (ik_val + kj_min[k] >= row_max)
+        continue;
+
+      const auto kj_row = kj + k * kj_stride;
+
+      auto maximum = ij_row[0];
+
+      __hack_ivdep
+      for (auto j = size_type(0); j < ij_w; ++j) {
+        ij_row[j] = (std::min)(ij_row[j], ik_val + kj_row[j]);
+        maximum = (std::max)(maximum, ij_row[j]);
+      }
+      row_max = maximum;
+    }
+  }
+};
+
+#else
+
+// Same as above, but bridges columns of `ik` and bridges rows of `kj` are
+// packed into panels (see `matrix-panels.hpp`)
+//
+void
+calculate_block(
+  matrix_block_type& ij,
+  const g_type*      ik,
+  const g_type*      kj,
+  size_t             count)
+{
+  using size_type = typename utzmx::traits::matrix_traits<matrix_block_type>::size_type;
+
+  const auto ij_s = ij.stride();
+  const auto ij_h = ij.height();
+
+  const auto ik_stride = utzpn::panel_stride<g_type>(count);
+  const auto kj_stride = utzpn::panel_stride<g_type>(ij.width());
+
+  for (auto k = size_type(0); k < count; ++k) {
+    const auto kj_row = kj + k * kj_stride;
+    for (auto i = size_type(0); i < ij_h; ++i) {
+      const auto ij_row = ij.at(i);
+      const auto ik_val = ik[i * ik_stride + k];
+
+      __hack_ivdep
+      for (auto j = size_type(0); j < ij_s; ++j)
+        ij_row[j] = (std::min)(ij_row[j], ik_val + kj_row[j]);
+    }
+  }
+};
+
+#endif
+
 void
 calculate_block(
   matrix_block_type& ij,
@@ -47,26 +158,94 @@ calculate_block(
   using size_type = typename utzmx::traits::matrix_traits<matrix_block_type>::size_type;
 
   const auto kj_size = kj.height();
-  const auto ij_w    = ij.width();
+  const auto ij_s    = ij.stride();
   const auto ij_h    = ij.height();
 
   for (auto k = size_type(0); k < kj_size; ++k)
     for (auto i = size_type(0); i < ij_h; ++i)
       __hack_ivdep
-      for (auto j = size_type(0); j < ij_w; ++j)
+      for (auto j = size_type(0); j < ij_s; ++j)
         ij.at(i, j) = (std::min)(ij.at(i, j), ik.at(i, k) + kj.at(k, j));
 };
 
+::utilz::roofline::counters
+roofline(
+  matrix_type& matrix,
+  matrix_clusters_type& matrix_clusters)
+{
+  // All phases relax blocks through all bridges of the diagonal block
+  //
+  return ::utilz::roofline::count(
+    matrix,
+    [&matrix_clusters](auto m) -> auto {
+      auto count = matrix_clusters.get_all_bridges_positions(m).size();
+      return std::make_tuple(count, count, count);
+    });
+};
+
+// Returns sizes (in bytes) of allocations made by `up` (in the order they are
+// made) for a graph of `vertices`
+//
+std::vector<size_t>
+required_bytes(
+  matrix_params_type& params,
+  size_t              vertices)
+{
+  using value_type = typename utzmx::traits::matrix_traits<matrix_type>::value_type;
+
+  std::vector<size_t> sizes(params.communities_sizes().begin(), params.communities_sizes().end());
+
+  auto capacity = size_t(0);
+  for (auto size : sizes)
+    capacity = (std::max)(capacity, size);
+
+  auto [columns_bytes, rows_bytes] = utzpn::panels_bytes<value_type>(sizes, sizes, capacity);
+  return std::vector<size_t>{ columns_bytes, rows_bytes };
+};
+
+__hack_noinline
+void
+up(
+  matrix_type&             matrix,
+  matrix_access_type&      matrix_access,
+  matrix_run_config_type&  run_config,
+  ::utilz::memory::buffer& b)
+{
+  using size_type = typename utzmx::traits::matrix_traits<matrix_type>::size_type;
+
+  // The number of bridges can't exceed the size of the diagonal block
+  //
+  auto capacity = size_type(0);
+  for (auto i = size_type(0); i < matrix.size(); ++i)
+    capacity = std::max({ capacity, matrix.at(i, i).height() });
+
+  utzpn::allocate_panels(run_config.panels, matrix, capacity, b);
+};
+
+__hack_noinline
+void
+down(
+  matrix_type&             matrix,
+  matrix_access_type&      matrix_access,
+  matrix_run_config_type&  run_config,
+  ::utilz::memory::buffer& b)
+{
+  utzpn::free_panels(run_config.panels, b);
+};
+
 __hack_noinline
 void
 run(
   matrix_type& matrix,
-  matrix_clusters_type& matrix_clusters)
+  matrix_clusters_type& matrix_clusters,
+  matrix_run_config_type& run_config)
 {
   using size_type = typename utzmx::traits::matrix_traits<matrix_type>::size_type;
 
+  auto& panels = run_config.panels;
+
 #ifdef _OPENMP
-  #pragma omp parallel default(none) shared(matrix, matrix_clusters)
+  #pragma omp parallel default(none) shared(matrix, matrix_clusters, panels)
 #endif
   {
 #ifdef _OPENMP
@@ -99,18 +278,43 @@ run(
 #ifdef _OPENMP
   #pragma omp taskwait
 #endif
+        const auto count = positions.size();
+        if (count == size_type(0))
+          continue;
+
+        // Column and row blocks don't change in the peripheral phase, so their
+        // bridges are packed once and reused by all peripheral blocks
+        //
         for (auto i = size_type(0); i < matrix.size(); ++i) {
           if (i != m) {
             auto& im = matrix.at(i, m);
+            auto& mi = matrix.at(m, i);
+
+#ifdef _OPENMP
+  #pragma omp task untied default(none) shared(im, mi, panels, positions) firstprivate(i)
+#endif
+            {
+              utzpn::pack_columns(im, positions.base(), panels.columns(i));
+              utzpn::pack_rows(mi, positions.base(), panels.rows(i));
+            }
+          }
+        }
+#ifdef _OPENMP
+  #pragma omp taskwait
+#endif
+        for (auto i = size_type(0); i < matrix.size(); ++i) {
+          if (i != m) {
             for (auto j = size_type(0); j < matrix.size(); ++j) {
               if (j != m) {
                 auto& ij = matrix.at(i, j);
-                auto& mj = matrix.at(m, j);
+
+                const auto ik = panels.columns(i);
+                const auto kj = panels.rows(j);
 
 #ifdef _OPENMP
-  #pragma omp task untied default(none) shared(ij, im, mj, positions)
+  #pragma omp task untied default(none) shared(ij) firstprivate(ik, kj, count)
 #endif
-                calculate_block(ij, im, mj, positions);
+                calculate_block(ij, ik, kj, count);
               }
             }
           }
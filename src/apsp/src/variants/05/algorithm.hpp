@@ -449,6 +449,27 @@ calculation_routine(
   return 0UL;
 };
 
+// Returns sizes (in bytes) of allocations made by `up` (in the order they are
+// made) for a graph of `vertices`
+//
+std::vector<size_t>
+required_bytes(
+  matrix_params_type& params,
+  size_t              vertices)
+{
+  const auto block_size    = params.block_size();
+  const auto tasks_count   = (vertices + block_size - size_t(1)) / block_size;
+  const auto threads_count = (std::min)(tasks_count, size_t(std::thread::hardware_concurrency()));
+
+  return std::vector<size_t>{
+    tasks_count * tasks_count * sizeof(size_t),
+    tasks_count * tasks_count * sizeof(PKRCORE_SYNCBLOCK),
+    tasks_count * sizeof(PKRCORE_TASK),
+    threads_count * sizeof(PKRCORE_THREAD),
+    tasks_count * sizeof(stream_node<matrix_type>)
+  };
+};
+
 __hack_noinline
 void
 up(
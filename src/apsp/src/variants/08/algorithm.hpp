@@ -2,6 +2,8 @@
 
 #define APSP_ALG_MATRIX_CLUSTERS
 
+#define APSP_ALG_ACCESS_CLUSTERS
+
 #define APSP_ALG_RUN_CONFIGURATION
 
 #define APSP_ALG_MATRIX_CLUSTERS_CONFIGURATION
@@ -13,51 +15,86 @@
 
 #include "portables/hacks/defines.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "measure.hpp"
 
 #include "memory.hpp"
+#include "memory-scratch.hpp"
 #include "matrix.hpp"
-
-#include <omp.h>
-#include <thread>
+#include "matrix-layout.hpp"
+#include "matrix-panels.hpp"
+#include "matrix-summary.hpp"
+#include "roofline.hpp"
 
 namespace utzmx = ::utilz::matrices;
+namespace utzly = ::utilz::matrices::layout;
+namespace utzpn = ::utilz::matrices::panels;
+namespace utzsm = ::utilz::matrices::summary;
+
+template<typename S>
+struct run_configuration;
+
+using matrix_clusters_type   = utzmx::clusters;
+using matrix_block_type      = utzmx::rect_matrix<g_type, g_allocator_type<g_type>>;
+using matrix_type            = utzmx::square_matrix<matrix_block_type, g_allocator_type<matrix_block_type>>;
+using matrix_access_type     = utzmx::access::matrix_access<utzmx::access::matrix_access_schema_flat, matrix_type>;
+using matrix_params_type     = utzmx::access::matrix_params<matrix_type>;
+using matrix_run_config_type = run_configuration<matrix_type>;
+
+// Scratch arrays of every worker (see `scratch_arena`)
+//
+enum scratch_arrays
+{
+  scratch_cur_row = 0,
+  scratch_prv_col = 1,
+  scratch_cur_col = 2,
+  scratch_nxt_row = 3,
+  scratch_count   = 4
+};
 
 template<typename S>
 struct run_configuration
 {
-  using pointer = typename utzmx::traits::matrix_traits<S>::pointer;
+  using pointer    = typename utzmx::traits::matrix_traits<S>::pointer;
+  using value_type = typename utzmx::traits::matrix_traits<S>::value_type;
+
+  ::utilz::memory::scratch_arena<value_type> scratch;
 
-  pointer mm_array_cur_col;
-  pointer mm_array_prv_col;
-  pointer mm_array_cur_row;
-  pointer mm_array_nxt_row;
   pointer mm_cp;
 
-  size_t allocation_line;
-  size_t allocation_size;
+  utzpn::bridges_panels<value_type> panels;
+
   size_t allocation_cp_size;
 };
 
-template<typename T, typename A, typename U>
 void
 calculate_diagonal(
-  utzmx::rect_matrix<T, A>& mm,
-  run_configuration<utzmx::square_matrix<utzmx::rect_matrix<T, A>, U>>& run_config)
+  matrix_block_type& mm,
+  matrix_run_config_type& run_config)
 {
-  using size_type  = typename utzmx::traits::matrix_traits<utzmx::rect_matrix<T, A>>::size_type;
-  using value_type = typename utzmx::traits::matrix_traits<utzmx::rect_matrix<T, A>>::value_type;
+  using size_type  = typename utzmx::traits::matrix_traits<matrix_block_type>::size_type;
+  using value_type = typename utzmx::traits::matrix_traits<matrix_block_type>::value_type;
+  using pointer    = typename utzmx::traits::matrix_traits<matrix_block_type>::pointer;
+
+  const auto scratch = run_config.scratch.context();
+
+  pointer mm_array_cur_row = scratch.array(scratch_cur_row);
+  pointer mm_array_prv_col = scratch.array(scratch_prv_col);
+  pointer mm_array_cur_col = scratch.array(scratch_cur_col);
+  pointer mm_array_nxt_row = scratch.array(scratch_nxt_row);
 
-  run_config.mm_array_prv_col[0] = ::utilz::constants::infinity<value_type>();
-  run_config.mm_array_nxt_row[0] = mm.at(0, 1);
+  mm_array_prv_col[0] = ::utilz::constants::infinity<value_type>();
+  mm_array_nxt_row[0] = mm.at(0, 1);
 
   for (auto k = size_type(1); k < mm.height(); ++k) {
     for (auto i = size_type(0); i < k; ++i)
-      run_config.mm_array_cur_row[i] = ::utilz::constants::infinity<value_type>();
+      mm_array_cur_row[i] = ::utilz::constants::infinity<value_type>();
 
     for (auto i = size_type(0); i < k; ++i) {
       const auto x = mm.at(k, i);
-      const auto z = run_config.mm_array_prv_col[i];
+      const auto z = mm_array_prv_col[i];
 
       auto minimum = ::utilz::constants::infinity<value_type>();
 
@@ -65,27 +102,27 @@ calculate_diagonal(
       for (auto j = size_type(0); j < k; ++j) {
         mm.at(i, j) = (std::min)(mm.at(i, j), z + mm.at(k - 1, j));
 
-        minimum = (std::min)(minimum, mm.at(i, j) + run_config.mm_array_nxt_row[j]);
-        run_config.mm_array_cur_row[j] = (std::min)(run_config.mm_array_cur_row[j], mm.at(i, j) + x);
+        minimum = (std::min)(minimum, mm.at(i, j) + mm_array_nxt_row[j]);
+        mm_array_cur_row[j] = (std::min)(mm_array_cur_row[j], mm.at(i, j) + x);
       }
-      run_config.mm_array_cur_col[i] = minimum;
+      mm_array_cur_col[i] = minimum;
     }
 
     for (auto i = size_type(0); i < k; ++i) {
-      mm.at(k, i) = run_config.mm_array_cur_row[i];
-      mm.at(i, k) = run_config.mm_array_cur_col[i];
+      mm.at(k, i) = mm_array_cur_row[i];
+      mm.at(i, k) = mm_array_cur_col[i];
 
-      run_config.mm_array_prv_col[i] = run_config.mm_array_cur_col[i];
-      run_config.mm_array_nxt_row[i] = mm.at(i, k + 1);
+      mm_array_prv_col[i] = mm_array_cur_col[i];
+      mm_array_nxt_row[i] = mm.at(i, k + 1);
     }
 
     if (k < (mm.height() - 1))
-      run_config.mm_array_nxt_row[k] = mm.at(k, k + 1);
+      mm_array_nxt_row[k] = mm.at(k, k + 1);
   }
 
   const auto x = mm.height() - size_type(1);
   for (auto i = size_type(0); i < x; ++i) {
-    const auto ix = run_config.mm_array_prv_col[i];
+    const auto ix = mm_array_prv_col[i];
 
     __hack_ivdep
     for (auto j = size_type(0); j < x; ++j)
@@ -93,16 +130,15 @@ calculate_diagonal(
   }
 }
 
-template<typename T, typename A, typename U>
 void
 calculate_vertical_fast(
-  utzmx::rect_matrix<T, A>& im,
-  utzmx::rect_matrix<T, A>& mm,
-  run_configuration<utzmx::square_matrix<utzmx::rect_matrix<T, A>, U>>& run_config,
+  matrix_block_type& im,
+  matrix_block_type& mm,
+  matrix_run_config_type& run_config,
   auto bridges)
 {
-  using size_type = typename utzmx::traits::matrix_traits<utzmx::rect_matrix<T>>::size_type;
-  using pointer   = typename utzmx::traits::matrix_traits<utzmx::rect_matrix<T>>::pointer;
+  using size_type = typename utzmx::traits::matrix_traits<matrix_block_type>::size_type;
+  using pointer   = typename utzmx::traits::matrix_traits<matrix_block_type>::pointer;
 
   auto mm_cp = run_config.mm_cp;
 
@@ -143,40 +179,38 @@ calculate_vertical_fast(
   }
 };
 
-template<typename T, typename A>
 void
 calculate_vertical(
-  utzmx::rect_matrix<T, A>& ij,
-  utzmx::rect_matrix<T, A>& ik,
-  utzmx::rect_matrix<T, A>& kj,
+  matrix_block_type& ij,
+  matrix_block_type& ik,
+  matrix_block_type& kj,
   auto bridges)
 {
-  using size_type = typename utzmx::traits::matrix_traits<utzmx::rect_matrix<T>>::size_type;
+  using size_type = typename utzmx::traits::matrix_traits<matrix_block_type>::size_type;
 
-  const auto ij_w = ij.width();
+  const auto ij_s = ij.stride();
   const auto ij_h = ij.height();
 
   for (auto i = size_type(0); i < ij_h; ++i)
     for (auto k : bridges)
       __hack_ivdep
-      for (auto j = size_type(0); j < ij_w; ++j)
+      for (auto j = size_type(0); j < ij_s; ++j)
         ij.at(i, j) = (std::min)(ij.at(i, j), ik.at(i, k) + kj.at(k, j));
 };
 
-template<typename T, typename A, typename U>
 void
 calculate_horizontal_fast(
-  utzmx::rect_matrix<T, A>& mi,
-  utzmx::rect_matrix<T, A>& mm,
-  run_configuration<utzmx::square_matrix<utzmx::rect_matrix<T, A>, U>>& run_config,
+  matrix_block_type& mi,
+  matrix_block_type& mm,
+  matrix_run_config_type& run_config,
   auto bridges)
 {
-  using size_type = typename utzmx::traits::matrix_traits<utzmx::rect_matrix<T>>::size_type;
-  using pointer   = typename utzmx::traits::matrix_traits<utzmx::rect_matrix<T, A>>::pointer;
+  using size_type = typename utzmx::traits::matrix_traits<matrix_block_type>::size_type;
+  using pointer   = typename utzmx::traits::matrix_traits<matrix_block_type>::pointer;
 
   auto mm_cp = run_config.mm_cp;
 
-  const auto w = mi.width();
+  const auto s = mi.stride();
   const auto h = mm.height();
   const auto x = bridges[0];
 
@@ -185,7 +219,7 @@ calculate_horizontal_fast(
       const auto iz = mm.at(i, z);
 
       __hack_ivdep
-      for (auto j = size_type(0); j < w; ++j)
+      for (auto j = size_type(0); j < s; ++j)
         mi.at(i, j) = (std::min)(mi.at(i, j), iz + mi.at(z, j));
     }
   }
@@ -198,7 +232,7 @@ calculate_horizontal_fast(
       const auto ki = mm.at(k, i);
 
       __hack_ivdep
-      for (auto j = size_type(0); j < w; ++j) {
+      for (auto j = size_type(0); j < s; ++j) {
         mi.at(i, j) = (std::min)(mi.at(i, j), iz + mi.at(z, j));
         mi.at(k, j) = (std::min)(mi.at(k, j), ki + mi.at(i, j));
       }
@@ -210,49 +244,139 @@ calculate_horizontal_fast(
     const auto iz = mm.at(i, z);
 
     __hack_ivdep
-    for (auto j = size_type(0); j < w; ++j)
+    for (auto j = size_type(0); j < s; ++j)
       mi.at(i, j) = (std::min)(mi.at(i, j), iz + mi.at(z, j));
   }
 };
 
-template<typename T, typename A>
 void
 calculate_horizontal(
-  utzmx::rect_matrix<T, A>& ij,
-  utzmx::rect_matrix<T, A>& ik,
-  utzmx::rect_matrix<T, A>& kj,
+  matrix_block_type& ij,
+  matrix_block_type& ik,
+  matrix_block_type& kj,
   auto bridges)
 {
-  using size_type = typename utzmx::traits::matrix_traits<utzmx::rect_matrix<T>>::size_type;
+  using size_type = typename utzmx::traits::matrix_traits<matrix_block_type>::size_type;
 
-  const auto ij_w = ij.width();
+  const auto ij_s = ij.stride();
   const auto ij_h = ij.height();
 
   for (auto i = size_type(0); i < ij_h; ++i)
     for (auto k : bridges)
       __hack_ivdep
-      for (auto j = size_type(0); j < ij_w; ++j)
+      for (auto j = size_type(0); j < ij_s; ++j)
         ij.at(i, j) = (std::min)(ij.at(i, j), ik.at(i, k) + kj.at(k, j));
 };
 
-template<typename T, typename A>
+#ifdef APSP_ALG_KERNEL_PRUNING
+
+// Pruning flavour of the peripheral kernel over panels (see below). Panels
+// don't change in the peripheral phase, therefore if `ik + min(kj)` is not
+// less than the maximum of row `i` of `ij`, none of the values in the row can
+// be improved through bridge `k` and the row is skipped. Only columns of the
+// block are relaxed, its padding is left as is.
+//
 void
 calculate_peripheral(
-  utzmx::rect_matrix<T, A>& ij,
-  utzmx::rect_matrix<T, A>& ik,
-  utzmx::rect_matrix<T, A>& kj,
-  auto bridges)
+  matrix_block_type& ij,
+  const g_type*      ik,
+  const g_type*      kj,
+  size_t             count)
 {
-  using size_type = typename utzmx::traits::matrix_traits<utzmx::rect_matrix<T>>::size_type;
+  using size_type  = typename utzmx::traits::matrix_traits<matrix_block_type>::size_type;
+  using value_type = typename utzmx::traits::matrix_traits<matrix_block_type>::value_type;
 
   const auto ij_w = ij.width();
   const auto ij_h = ij.height();
 
-  for (auto i = size_type(0); i < ij_h; ++i)
-    for (auto k : bridges)
+  const auto ik_stride = utzpn::panel_stride<g_type>(count);
+  const auto kj_stride = utzpn::panel_stride<g_type>(ij.width());
+
+  static thread_local std::vector<value_type> kj_min;
+
+  kj_min.resize(count);
+  for (auto k = size_type(0); k < count; ++k)
+    kj_min[k] = *std::min_element(kj + k * kj_stride, kj + k * kj_stride + ij_w);
+
+  for (auto i = size_type(0); i < ij_h; ++i) {
+    const auto ij_row = ij.at(i);
+    const auto ik_row = ik + i * ik_stride;
+
+    auto row_max = *std::max_element(ij_row, ij_row + ij_w);
+
+    for (auto k = size_type(0); k < count; ++k) {
+      const auto ik_val = ik_row[k];
+      if (ik_val + kj_min[k] >= row_max)
+        continue;
+
+      const auto kj_row = kj + k * kj_stride;
+
+      auto maximum = ij_row[0];
+
       __hack_ivdep
-      for (auto j = size_type(0); j < ij_w; ++j)
-        ij.at(i, j) = (std::min)(ij.at(i, j), ik.at(i, k) + kj.at(k, j));
+      for (auto j = size_type(0); j < ij_w; ++j) {
+        ij_row[j] = (std::min)(ij_row[j], ik_val + kj_row[j]);
+        maximum = (std::max)(maximum, ij_row[j]);
+      }
+      row_max = maximum;
+    }
+  }
+};
+
+#else
+
+// Bridges columns of `ik` and bridges rows of `kj` are packed into panels
+// (see `matrix-panels.hpp`), which turns the kernel into a dense one
+//
+void
+calculate_peripheral(
+  matrix_block_type& ij,
+  const g_type*      ik,
+  const g_type*      kj,
+  size_t             count)
+{
+  using size_type = typename utzmx::traits::matrix_traits<matrix_block_type>::size_type;
+
+  const auto ij_s = ij.stride();
+  const auto ij_h = ij.height();
+
+  const auto ik_stride = utzpn::panel_stride<g_type>(count);
+  const auto kj_stride = utzpn::panel_stride<g_type>(ij.width());
+
+  for (auto i = size_type(0); i < ij_h; ++i) {
+    const auto ij_row = ij.at(i);
+    const auto ik_row = ik + i * ik_stride;
+
+    for (auto k = size_type(0); k < count; ++k) {
+      const auto ik_val = ik_row[k];
+      const auto kj_row = kj + k * kj_stride;
+
+      __hack_ivdep
+      for (auto j = size_type(0); j < ij_s; ++j)
+        ij_row[j] = (std::min)(ij_row[j], ik_val + kj_row[j]);
+    }
+  }
+};
+
+#endif
+
+::utilz::roofline::counters
+roofline(
+  matrix_type& matrix,
+  matrix_clusters_type& matrix_clusters)
+{
+  // Vertical and horizontal phases relax blocks through input and output
+  // bridges, while peripheral phase uses the smallest of them (the "fast"
+  // kernels of optimal blocks perform fewer relaxations, so this is an upper
+  // bound)
+  //
+  return ::utilz::roofline::count(
+    matrix,
+    [&matrix_clusters](auto m) -> auto {
+      auto input  = matrix_clusters.get_input_bridges_positions(m).size();
+      auto output = matrix_clusters.get_output_bridges_positions(m).size();
+      return std::make_tuple(input, output, (std::min)(input, output));
+    });
 };
 
 __hack_noinline
@@ -291,24 +415,44 @@ up_clusters(
   }
 }
 
-template<typename T, typename A, typename U>
+// Returns sizes (in bytes) of allocations made by `up` (in the order they are
+// made) for a graph of `vertices`
+//
+std::vector<size_t>
+required_bytes(
+  matrix_params_type& params,
+  size_t              vertices)
+{
+  using value_type = typename utzmx::traits::matrix_traits<matrix_type>::value_type;
+
+  std::vector<size_t> sizes(params.communities_sizes().begin(), params.communities_sizes().end());
+
+  auto allocation_line = size_t(0);
+  for (auto size : sizes)
+    allocation_line = (std::max)(allocation_line, size);
+
+  std::vector<size_t> bytes = {
+    allocation_line * allocation_line * sizeof(value_type),
+    ::utilz::memory::scratch_arena<value_type>::required_bytes(scratch_count, allocation_line)
+  };
+
+  auto [columns_bytes, rows_bytes] = utzpn::panels_bytes<value_type>(sizes, sizes, allocation_line);
+  bytes.push_back(columns_bytes);
+  bytes.push_back(rows_bytes);
+
+  return bytes;
+};
+
 __hack_noinline
 void
 up(
-  utzmx::matrix_abstract<utzmx::square_matrix<utzmx::rect_matrix<T, A>, U>>& abstract,
-  ::utilz::memory::buffer& b,
-  run_configuration<utzmx::square_matrix<utzmx::rect_matrix<T, A>, U>>& run_config)
+  matrix_type&             matrix,
+  matrix_access_type&      matrix_access,
+  matrix_run_config_type&  run_config,
+  ::utilz::memory::buffer& b)
 {
-  using size_type  = typename utzmx::traits::matrix_traits<utzmx::square_matrix<utzmx::rect_matrix<T, A>, U>>::size_type;
-  using value_type = typename utzmx::traits::matrix_traits<utzmx::square_matrix<utzmx::rect_matrix<T, A>, U>>::value_type;
-
-#ifdef _OPENMP
-  auto allocation_mulx = std::thread::hardware_concurrency();
-#else
-  auto allocation_mulx = 1;
-#endif
-
-  auto& matrix = abstract.matrix();
+  using size_type  = typename utzmx::traits::matrix_traits<matrix_type>::size_type;
+  using value_type = typename utzmx::traits::matrix_traits<matrix_type>::value_type;
 
   auto allocation_line = size_type(0);
   for (auto i = size_type(0); i < matrix.size(); ++i) {
@@ -319,58 +463,58 @@ up(
     allocation_line = std::max({ allocation_line, block.width() });
   }
 
-  auto allocation_size     = allocation_line * sizeof(value_type) * allocation_mulx;
   auto allocation_cp_size  = allocation_line * allocation_line * sizeof(value_type);
 
-  run_config.allocation_line    = allocation_line;
-  run_config.allocation_size    = allocation_size;
   run_config.allocation_cp_size = allocation_cp_size;
-  run_config.mm_cp              = reinterpret_cast<T*>(b.allocate(allocation_cp_size));
-  run_config.mm_array_cur_row   = reinterpret_cast<T*>(b.allocate(allocation_size));
-  run_config.mm_array_prv_col   = reinterpret_cast<T*>(b.allocate(allocation_size));
-  run_config.mm_array_cur_col   = reinterpret_cast<T*>(b.allocate(allocation_size));
-  run_config.mm_array_nxt_row   = reinterpret_cast<T*>(b.allocate(allocation_size));
-
-  for (auto i = size_type(0); i < allocation_line * allocation_mulx; ++i) {
-    run_config.mm_array_cur_row[i] = ::utilz::constants::infinity<value_type>();
-    run_config.mm_array_prv_col[i] = ::utilz::constants::infinity<value_type>();
-    run_config.mm_array_cur_col[i] = ::utilz::constants::infinity<value_type>();
-    run_config.mm_array_nxt_row[i] = ::utilz::constants::infinity<value_type>();
-  }
+  run_config.mm_cp              = reinterpret_cast<g_type*>(b.allocate(allocation_cp_size));
+
   for (auto i = size_type(0); i < allocation_line * allocation_line; ++i) {
     run_config.mm_cp[i] = ::utilz::constants::infinity<value_type>();
   }
+
+  // Every worker of the team gets its own scratch arrays
+  //
+  run_config.scratch.reserve(b, scratch_count, allocation_line, ::utilz::constants::infinity<value_type>());
+
+  // The number of bridges can't exceed the size of the diagonal block
+  //
+  utzpn::allocate_panels(run_config.panels, matrix, allocation_line, b);
 };
 
-template<typename T, typename A, typename U>
 __hack_noinline
 void
 down(
-  utzmx::matrix_abstract<utzmx::square_matrix<utzmx::rect_matrix<T, A>, U>>& abstract,
-  ::utilz::memory::buffer& b,
-  run_configuration<utzmx::square_matrix<utzmx::rect_matrix<T, A>, U>>& run_config)
+  matrix_type&             matrix,
+  matrix_access_type&      matrix_access,
+  matrix_run_config_type&  run_config,
+  ::utilz::memory::buffer& b)
 {
   using alptr_type = typename ::utilz::memory::buffer::pointer;
 
-  b.deallocate(reinterpret_cast<alptr_type>(run_config.mm_cp)          , run_config.allocation_cp_size);
-  b.deallocate(reinterpret_cast<alptr_type>(run_config.mm_array_cur_row), run_config.allocation_size);
-  b.deallocate(reinterpret_cast<alptr_type>(run_config.mm_array_prv_col), run_config.allocation_size);
-  b.deallocate(reinterpret_cast<alptr_type>(run_config.mm_array_cur_col), run_config.allocation_size);
-  b.deallocate(reinterpret_cast<alptr_type>(run_config.mm_array_nxt_row), run_config.allocation_size);
+  b.deallocate(reinterpret_cast<alptr_type>(run_config.mm_cp), run_config.allocation_cp_size);
+
+  run_config.scratch.release();
+
+  utzpn::free_panels(run_config.panels, b);
 }
 
-template<typename T, typename A, typename U>
 __hack_noinline
 void
 run(
-  utzmx::square_matrix<utzmx::rect_matrix<T, A>, U>& blocks,
-  run_configuration<utzmx::square_matrix<utzmx::rect_matrix<T, A>, U>>& run_config,
-  utzmx::clusters& clusters)
+  matrix_type& blocks,
+  matrix_clusters_type& clusters,
+  matrix_run_config_type& run_config)
 {
-  using size_type = typename utzmx::traits::matrix_traits<utzmx::square_matrix<utzmx::square_matrix<T, A>, U>>::size_type;
+  using size_type = typename utzmx::traits::matrix_traits<matrix_type>::size_type;
+
+  utzsm::infinite_blocks infinite(blocks);
+
+  // Peripheral blocks are scheduled in the order of tiles layout
+  //
+  const auto sequence = utzly::tiles_sequence(utzly::tiles_layout(), blocks.size());
 
 #ifdef _OPENMP
-  #pragma omp parallel default(none) shared(blocks, run_config, clusters)
+  #pragma omp parallel default(none) shared(blocks, run_config, clusters, infinite, sequence)
 #endif
   {
 #ifdef _OPENMP
@@ -398,8 +542,11 @@ run(
             auto& im = blocks.at(i, m);
             auto& mi = blocks.at(m, i);
 
+            // Infinite blocks stay infinite when relaxed through
+            // themselves
+            //
             if (optimal) {
-              if (!input_positions.empty()) {
+              if (!input_positions.empty() && !infinite.at(i, m)) {
 #ifdef _OPENMP
   #pragma omp task untied default(none) shared(im, mm, run_config, input_positions)
 #endif
@@ -408,7 +555,7 @@ run(
                   calculate_vertical_fast(im, mm, run_config, input_positions);
                 }
               }
-              if (!output_positions.empty()) {
+              if (!output_positions.empty() && !infinite.at(m, i)) {
 #ifdef _OPENMP
   #pragma omp task untied default(none) shared(mi, mm, run_config, output_positions)
 #endif
@@ -419,7 +566,7 @@ run(
               }
             } else {
               if (input_positions.size() > output_positions.size()) {
-                if (!input_positions.empty()) {
+                if (!input_positions.empty() && !infinite.at(i, m)) {
 #ifdef _OPENMP
   #pragma omp task untied default(none) shared(im, mm, run_config, input_positions)
 #endif
@@ -429,7 +576,7 @@ run(
                   }
                 }
 
-                if (!output_positions.empty()) {
+                if (!output_positions.empty() && !infinite.at(m, i)) {
 #ifdef _OPENMP
   #pragma omp task untied default(none) shared(mi, mm, output_positions)
 #endif
@@ -439,7 +586,7 @@ run(
                   }
                 }
               } else {
-                if (!input_positions.empty()) {
+                if (!input_positions.empty() && !infinite.at(i, m)) {
 #ifdef _OPENMP
   #pragma omp task untied default(none) shared(im, mm, input_positions)
 #endif
@@ -449,7 +596,7 @@ run(
                   }
                 }
 
-                if (!output_positions.empty()) {
+                if (!output_positions.empty() && !infinite.at(m, i)) {
 #ifdef _OPENMP
   #pragma omp task untied default(none) shared(mi, mm, run_config, output_positions)
 #endif
@@ -472,22 +619,48 @@ run(
         if (min_positions.empty())
           continue;
 
+        // Column and row blocks don't change in the peripheral phase, so their
+        // bridges are packed once and reused by all peripheral blocks
+        //
         for (auto i = size_type(0); i < blocks.size(); ++i) {
           if (i != m) {
             auto& im = blocks.at(i, m);
-            for (auto j = size_type(0); j < blocks.size(); ++j) {
-              if (j != m) {
-                auto& ij = blocks.at(i, j);
-                auto& mj = blocks.at(m, j);
+            auto& mi = blocks.at(m, i);
 
 #ifdef _OPENMP
-  #pragma omp task untied default(none) shared(ij, im, mj, min_positions)
+  #pragma omp task untied default(none) shared(im, mi, run_config, min_positions, infinite) firstprivate(i, m)
 #endif
-                {
-                  SCOPE_MEASURE_MILLISECONDS("PERH");
-                  calculate_peripheral(ij, im, mj, min_positions);
-                }
-              }
+            {
+              SCOPE_MEASURE_MILLISECONDS("PACK");
+              if (!infinite.at(i, m))
+                utzpn::pack_columns(im, min_positions.base(), run_config.panels.columns(i));
+              if (!infinite.at(m, i))
+                utzpn::pack_rows(mi, min_positions.base(), run_config.panels.rows(i));
+            }
+          }
+        }
+#ifdef _OPENMP
+  #pragma omp taskwait
+#endif
+        const auto count = min_positions.size();
+
+        for (auto tile : sequence) {
+          const auto i = std::get<0>(tile);
+          const auto j = std::get<1>(tile);
+          if (i != m && j != m && !infinite.at(i, m) && !infinite.at(m, j)) {
+            auto& ij = blocks.at(i, j);
+
+            const auto ik = run_config.panels.columns(i);
+            const auto kj = run_config.panels.rows(j);
+
+#ifdef _OPENMP
+  #pragma omp task untied default(none) shared(ij, infinite) firstprivate(ik, kj, count, i, j)
+#endif
+            {
+              SCOPE_MEASURE_MILLISECONDS("PERH");
+              calculate_peripheral(ij, ik, kj, count);
+
+              infinite.update(i, j, ij);
             }
           }
         }
@@ -107,11 +107,13 @@ run(
 
   const auto sz = m.size();
 
-  MTL::Buffer* memory = run_config.device->newBuffer(m.at(0), sz * sz * sizeof(T), MTL::ResourceStorageModeShared);
+  MTL::Buffer* memory = run_config.device->newBuffer(sz * sz * sizeof(T), MTL::ResourceStorageModeShared);
 
-  // Copy matrix into dedicate buffer (shared across devices)
+  // Copy matrix into dedicate buffer (shared across devices), rows of the
+  // matrix can be padded while the buffer is dense
   //
-  memcpy(memory->contents(), m.at(0), sz * sz * sizeof(T));
+  for (auto i = size_type(0); i < sz; ++i)
+    memcpy(reinterpret_cast<T*>(memory->contents()) + i * sz, m.at(i), sz * sizeof(T));
 
   MTL::Size grid_size  = MTL::Size::Make(sz, sz, 1);
   // MTL::Size group_size = MTL::Size::Make(
@@ -156,7 +158,8 @@ run(
 
   // Copy memory back from the shared buffer into the matrix
   //
-  memcpy(m.at(0), memory->contents(), sz * sz * sizeof(T));
+  for (auto i = size_type(0); i < sz; ++i)
+    memcpy(m.at(i), reinterpret_cast<T*>(memory->contents()) + i * sz, sz * sizeof(T));
 
   memory->release();
 };
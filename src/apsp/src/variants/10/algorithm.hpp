@@ -0,0 +1,258 @@
+#pragma once
+
+#define APSP_ALG_MATRIX_FLAT
+
+#define APSP_ALG_ACCESS_FLAT
+
+#define APSP_ALG_ROOFLINE
+
+#include "portables/hacks/defines.h"
+
+#include "matrix.hpp"
+#include "matrix-access.hpp"
+#include "roofline.hpp"
+
+namespace utzmx = ::utilz::matrices;
+
+using matrix_type            = utzmx::square_matrix<g_type, g_allocator_type<g_type>>;
+using matrix_access_type     = utzmx::access::matrix_access<utzmx::access::matrix_access_schema_flat, matrix_type>;
+using matrix_params_type     = utzmx::access::matrix_params<matrix_type>;
+
+// The size of a leaf (in any of the dimensions), at which recursion stops and
+// the min-plus kernel is executed. It is small enough to fit three leafs into
+// L1 cache, the rest of cache levels are utilised by the recursion itself.
+//
+constexpr size_t recursive_leaf_size = 32;
+
+// The size of a problem (in any of the dimensions), starting from which
+// recursive calls are executed as separate tasks
+//
+constexpr size_t recursive_task_size = 256;
+
+// Min-plus kernel, which computes `x = min(x, y + z)` where `x` is `m * p`,
+// `y` is `m * q` and `z` is `q * p` sub-matrices of the same matrix with a row
+// stride `ld`. The `k`-`i`-`j` order makes it correct even when `x`, `y` and
+// `z` overlap (i.e. the same as classic Floyd-Warshall).
+//
+template<typename T>
+void
+calculate_leaf(
+  T* x,
+  T* y,
+  T* z,
+  size_t m,
+  size_t p,
+  size_t q,
+  size_t ld)
+{
+  for (auto k = size_t(0); k < q; ++k) {
+    const auto z_row = z + k * ld;
+    for (auto i = size_t(0); i < m; ++i) {
+      const auto x_row = x + i * ld;
+      const auto ik    = y[i * ld + k];
+
+      __hack_ivdep
+      for (auto j = size_t(0); j < p; ++j)
+        x_row[j] = (std::min)(x_row[j], ik + z_row[j]);
+    }
+  }
+};
+
+// Recursive (Kleene / divide-and-conquer) closure, which splits each of
+// the dimensions into two halves (the sizes don't have to be powers of two)
+// and executes quadrants in the order, which preserves Floyd-Warshall
+// dependencies:
+//
+// k = 1: X11 -> (X12, X21) -> X22
+// k = 2: X22 -> (X21, X12) -> X11
+//
+// When `x` doesn't overlap with `y` and `z` all four quadrants of the same `k`
+// are independent.
+//
+template<typename T>
+void
+calculate_recursive(
+  T* x,
+  T* y,
+  T* z,
+  size_t m,
+  size_t p,
+  size_t q,
+  size_t ld)
+{
+  if (m == size_t(0) || p == size_t(0) || q == size_t(0))
+    return;
+
+  if ((std::max)({ m, p, q }) <= recursive_leaf_size) {
+    calculate_leaf(x, y, z, m, p, q, ld);
+    return;
+  }
+
+  const auto m1 = m / size_t(2), m2 = m - m1;
+  const auto p1 = p / size_t(2), p2 = p - p1;
+  const auto q1 = q / size_t(2), q2 = q - q1;
+
+  T* x11 = x;
+  T* x12 = x + p1;
+  T* x21 = x + m1 * ld;
+  T* x22 = x + m1 * ld + p1;
+
+  T* y11 = y;
+  T* y12 = y + q1;
+  T* y21 = y + m1 * ld;
+  T* y22 = y + m1 * ld + q1;
+
+  T* z11 = z;
+  T* z12 = z + p1;
+  T* z21 = z + q1 * ld;
+  T* z22 = z + q1 * ld + p1;
+
+  const auto independent = x != y && x != z;
+
+#ifdef _OPENMP
+  const auto parallel = (std::max)({ m, p, q }) > recursive_task_size;
+#endif
+
+  if (independent) {
+#ifdef _OPENMP
+  #pragma omp task untied default(none) firstprivate(x11, y11, z11, m1, p1, q1, ld) if(parallel)
+#endif
+    calculate_recursive(x11, y11, z11, m1, p1, q1, ld);
+
+#ifdef _OPENMP
+  #pragma omp task untied default(none) firstprivate(x12, y11, z12, m1, p2, q1, ld) if(parallel)
+#endif
+    calculate_recursive(x12, y11, z12, m1, p2, q1, ld);
+
+#ifdef _OPENMP
+  #pragma omp task untied default(none) firstprivate(x21, y21, z11, m2, p1, q1, ld) if(parallel)
+#endif
+    calculate_recursive(x21, y21, z11, m2, p1, q1, ld);
+
+#ifdef _OPENMP
+  #pragma omp task untied default(none) firstprivate(x22, y21, z12, m2, p2, q1, ld) if(parallel)
+#endif
+    calculate_recursive(x22, y21, z12, m2, p2, q1, ld);
+
+#ifdef _OPENMP
+  #pragma omp taskwait
+#endif
+
+#ifdef _OPENMP
+  #pragma omp task untied default(none) firstprivate(x22, y22, z22, m2, p2, q2, ld) if(parallel)
+#endif
+    calculate_recursive(x22, y22, z22, m2, p2, q2, ld);
+
+#ifdef _OPENMP
+  #pragma omp task untied default(none) firstprivate(x21, y22, z21, m2, p1, q2, ld) if(parallel)
+#endif
+    calculate_recursive(x21, y22, z21, m2, p1, q2, ld);
+
+#ifdef _OPENMP
+  #pragma omp task untied default(none) firstprivate(x12, y12, z22, m1, p2, q2, ld) if(parallel)
+#endif
+    calculate_recursive(x12, y12, z22, m1, p2, q2, ld);
+
+#ifdef _OPENMP
+  #pragma omp task untied default(none) firstprivate(x11, y12, z21, m1, p1, q2, ld) if(parallel)
+#endif
+    calculate_recursive(x11, y12, z21, m1, p1, q2, ld);
+
+#ifdef _OPENMP
+  #pragma omp taskwait
+#endif
+  } else {
+    calculate_recursive(x11, y11, z11, m1, p1, q1, ld);
+
+#ifdef _OPENMP
+  #pragma omp task untied default(none) firstprivate(x12, y11, z12, m1, p2, q1, ld) if(parallel)
+#endif
+    calculate_recursive(x12, y11, z12, m1, p2, q1, ld);
+
+#ifdef _OPENMP
+  #pragma omp task untied default(none) firstprivate(x21, y21, z11, m2, p1, q1, ld) if(parallel)
+#endif
+    calculate_recursive(x21, y21, z11, m2, p1, q1, ld);
+
+#ifdef _OPENMP
+  #pragma omp taskwait
+#endif
+
+    calculate_recursive(x22, y21, z12, m2, p2, q1, ld);
+    calculate_recursive(x22, y22, z22, m2, p2, q2, ld);
+
+#ifdef _OPENMP
+  #pragma omp task untied default(none) firstprivate(x21, y22, z21, m2, p1, q2, ld) if(parallel)
+#endif
+    calculate_recursive(x21, y22, z21, m2, p1, q2, ld);
+
+#ifdef _OPENMP
+  #pragma omp task untied default(none) firstprivate(x12, y12, z22, m1, p2, q2, ld) if(parallel)
+#endif
+    calculate_recursive(x12, y12, z22, m1, p2, q2, ld);
+
+#ifdef _OPENMP
+  #pragma omp taskwait
+#endif
+
+    calculate_recursive(x11, y12, z21, m1, p1, q2, ld);
+  }
+};
+
+__hack_noinline
+void
+run(
+  matrix_type& matrix)
+{
+  using pointer = typename utzmx::traits::matrix_traits<matrix_type>::pointer;
+
+  const auto x = matrix.size();
+  if (x == 0)
+    return;
+
+  pointer p  = matrix.at(0);
+  auto    ld = matrix.stride();
+
+#ifdef _OPENMP
+  #pragma omp parallel default(none) shared(p) firstprivate(x, ld)
+#endif
+  {
+#ifdef _OPENMP
+  #pragma omp single
+#endif
+    calculate_recursive(p, p, p, x, x, x, ld);
+  }
+};
+
+// The recursion reaches memory only until three sub-matrices of a sub-problem
+// fit into the last level cache (or L1 cache, when the size of the last level
+// cache is unknown), after that all accesses are served by the cache. Every
+// such sub-problem of size `b` loads `x`, `y`, `z` and stores `x`, i.e. the
+// matrix is moved `n / b` times instead of `n` times.
+//
+::utilz::roofline::counters
+roofline(
+  matrix_type& matrix)
+{
+  using value_type = typename utzmx::traits::matrix_traits<matrix_type>::value_type;
+
+  const auto n = uint64_t(matrix.size());
+  const auto s = uint64_t(sizeof(value_type));
+
+  auto cache = ::utilz::roofline::last_level_cache_bytes();
+  if (cache == uint64_t(0))
+    cache = uint64_t(3) * recursive_leaf_size * recursive_leaf_size * s;
+
+  auto b = n;
+  while (b > uint64_t(recursive_leaf_size) && uint64_t(3) * b * b * s > cache)
+    b = b - b / uint64_t(2);
+
+  const auto c = b == uint64_t(0) ? uint64_t(0) : (n + b - uint64_t(1)) / b;
+
+  ::utilz::roofline::counters counters;
+  counters["EXEC"] = ::utilz::roofline::phase{ n * n * n, c * c * c * uint64_t(4) * b * b * s };
+
+  ::utilz::roofline::limit_to_footprint(counters, n * n * s);
+
+  return counters;
+};
@@ -0,0 +1,387 @@
+#pragma once
+
+#define APSP_ALG_MATRIX_BLOCKS
+
+#define APSP_ALG_ACCESS_BLOCKS
+
+#define APSP_ALG_RUN_CONFIGURATION
+
+#define APSP_ALG_ROOFLINE
+
+#define APSP_ALG_OUT_OF_CORE
+
+#include "portables/hacks/defines.h"
+
+#include <algorithm>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "measure.hpp"
+#include "memory.hpp"
+#include "roofline.hpp"
+#include "tiles-storage.hpp"
+
+#include "matrix.hpp"
+#include "matrix-access.hpp"
+#include "matrix-stride.hpp"
+#include "matrix-tiles.hpp"
+
+#include "01/kernel.hpp"
+
+// Out-of-core blocked Floyd-Warshall. The matrix is a matrix of tiles (see
+// `tiles_matrix`), which is stored in a tiles file (see `APSP_TILES_DIRECTORY`)
+// from the moment it is populated, and only a working set is kept in memory
+// during the execution:
+//
+// - a row and a column of tiles of the current diagonal block `m`
+// - a sliding window of peripheral tiles, which is triple buffered, i.e. while
+//   one batch of tiles is computed the next one is read and the previous one
+//   is written
+//
+// The tiles are processed in the same order (and by the same kernel) as in
+// variant 01, all reads and writes are executed by a pool of I/O threads and
+// overlap with computations. The result is printed directly from the file.
+//
+
+namespace utzmx = ::utilz::matrices;
+namespace utzst = ::utilz::storage;
+
+template<typename S>
+struct run_configuration;
+
+using matrix_block_type      = utzmx::square_matrix<g_type, g_allocator_type<g_type>>;
+using matrix_type            = utzmx::tiles_matrix<g_type>;
+using matrix_access_type     = utzmx::access::matrix_access<utzmx::access::matrix_access_schema_flat, matrix_type>;
+using matrix_params_type     = utzmx::access::matrix_params<matrix_type>;
+using matrix_run_config_type = run_configuration<matrix_type>;
+
+// Number of threads, which execute tiles reads and writes
+//
+constexpr size_t io_threads = 4;
+
+// Minimal number of peripheral tiles processed as a single batch (the actual
+// number is never less than number of threads)
+//
+constexpr size_t window_tiles = 8;
+
+template<typename S>
+struct run_configuration
+{
+  using size_type = typename utzmx::traits::matrix_traits<S>::size_type;
+
+  std::unique_ptr<utzst::io_pool> pool;
+
+  std::vector<matrix_block_type> row;
+  std::vector<matrix_block_type> col;
+  std::vector<matrix_block_type> window;
+
+  size_type window_size;
+};
+
+void
+wait_tile(
+  std::future<void>& f)
+{
+  if (f.valid())
+    f.get();
+};
+
+std::future<void>
+read_tile(
+  matrix_type&            matrix,
+  matrix_run_config_type& run_config,
+  size_t                  i,
+  size_t                  j,
+  matrix_block_type&      tile)
+{
+  auto m = &matrix;
+  auto p = tile.at(0);
+
+  return run_config.pool->submit([m, i, j, p]() { m->read(i, j, p); });
+};
+
+std::future<void>
+write_tile(
+  matrix_type&            matrix,
+  matrix_run_config_type& run_config,
+  size_t                  i,
+  size_t                  j,
+  matrix_block_type&      tile)
+{
+  auto m = &matrix;
+  auto p = tile.at(0);
+
+  return run_config.pool->submit([m, i, j, p]() { m->write(i, j, p); });
+};
+
+// Issues reads of a batch `c` of peripheral tiles into the window. The window
+// slots of the batch might still hold tiles of a batch `c - 3`, which are
+// being written
+//
+void
+read_window(
+  matrix_type&                                   matrix,
+  matrix_run_config_type&                        run_config,
+  const std::vector<std::pair<size_t, size_t>>&  peripheral,
+  size_t                                         c,
+  std::vector<std::future<void>>&                reads,
+  std::vector<std::future<void>>&                writes)
+{
+  const auto w = run_config.window_size;
+  const auto s = (c % size_t(3)) * w;
+  const auto f = c * w;
+  const auto e = (std::min)(f + w, peripheral.size());
+
+  for (auto t = f; t < e; ++t) {
+    wait_tile(writes[s + t - f]);
+
+    reads[s + t - f] = read_tile(matrix, run_config, peripheral[t].first, peripheral[t].second, run_config.window[s + t - f]);
+  }
+};
+
+// Returns sizes (in bytes) of allocations made by `up` (in the order they are
+// made) for a graph of `vertices`
+//
+std::vector<size_t>
+required_bytes(
+  matrix_params_type& params,
+  size_t              vertices)
+{
+  using value_type = typename utzmx::traits::matrix_traits<matrix_type>::value_type;
+
+  const auto block_size  = params.block_size();
+  const auto tiles_count = (vertices + block_size - size_t(1)) / block_size;
+
+#ifdef _OPENMP
+  auto window_size = (std::max)(window_tiles, size_t(std::thread::hardware_concurrency()));
+#else
+  auto window_size = window_tiles;
+#endif
+
+  const auto tile_bytes = block_size * utzmx::stride::leading_dimension<value_type>(block_size) * sizeof(value_type);
+
+  // Rows and columns tiles and the triple buffered window
+  //
+  return std::vector<size_t>(tiles_count * size_t(2) + window_size * size_t(3), tile_bytes);
+};
+
+__hack_noinline
+void
+up(
+  matrix_type&             matrix,
+  matrix_access_type&      matrix_access,
+  matrix_run_config_type&  matrix_run_config,
+  ::utilz::memory::buffer& b)
+{
+  using size_type  = typename utzmx::traits::matrix_traits<matrix_type>::size_type;
+  using value_type = typename utzmx::traits::matrix_traits<matrix_type>::value_type;
+
+  auto tiles_count = matrix.size();
+  auto tile_size   = matrix.tile_size();
+  auto tile_stride = matrix.tile_stride();
+
+#ifdef _OPENMP
+  auto window_size = (std::max)(window_tiles, size_t(std::thread::hardware_concurrency()));
+#else
+  auto window_size = window_tiles;
+#endif
+
+  matrix_run_config.window_size = window_size;
+
+  matrix_run_config.pool = std::make_unique<utzst::io_pool>(io_threads);
+
+  matrix_run_config.row.reserve(tiles_count);
+  matrix_run_config.col.reserve(tiles_count);
+  for (auto i = size_type(0); i < tiles_count; ++i) {
+    matrix_run_config.row.emplace_back(tile_size, tile_stride, g_allocator_type<value_type>(&b));
+    matrix_run_config.col.emplace_back(tile_size, tile_stride, g_allocator_type<value_type>(&b));
+  }
+
+  // The window is triple buffered: reading, computing and writing batches
+  //
+  matrix_run_config.window.reserve(window_size * size_type(3));
+  for (auto i = size_type(0); i < window_size * size_type(3); ++i)
+    matrix_run_config.window.emplace_back(tile_size, tile_stride, g_allocator_type<value_type>(&b));
+};
+
+__hack_noinline
+void
+down(
+  matrix_type&             matrix,
+  matrix_access_type&      matrix_access,
+  matrix_run_config_type&  matrix_run_config,
+  ::utilz::memory::buffer& b)
+{
+  matrix_run_config.row.clear();
+  matrix_run_config.col.clear();
+  matrix_run_config.window.clear();
+
+  matrix_run_config.pool.reset();
+};
+
+__hack_noinline
+void
+run(
+  matrix_type&            matrix,
+  matrix_run_config_type& matrix_run_config)
+{
+  using size_type = typename utzmx::traits::matrix_traits<matrix_type>::size_type;
+
+  auto& run_config = matrix_run_config;
+
+  const auto n = matrix.size();
+  const auto w = run_config.window_size;
+
+  std::vector<std::future<void>> row_reads(n);
+  std::vector<std::future<void>> col_reads(n);
+
+  std::vector<std::future<void>> window_reads(w * size_type(3));
+  std::vector<std::future<void>> window_writes(w * size_type(3));
+
+  std::vector<std::future<void>> writes;
+  writes.reserve(n * size_type(2));
+
+  // Peripheral tiles of the current diagonal block `m` in processing order
+  //
+  std::vector<std::pair<size_type, size_type>> peripheral;
+  peripheral.reserve(n * n);
+
+#ifdef _OPENMP
+  #pragma omp parallel default(none) shared(matrix, run_config, row_reads, col_reads, window_reads, window_writes, writes, peripheral) firstprivate(n, w)
+#endif
+  {
+#ifdef _OPENMP
+  #pragma omp single
+#endif
+    {
+      for (auto m = size_type(0); m < n; ++m) {
+        // All tiles written on the previous iteration have to reach the file
+        // before any of them can be read again
+        //
+        for (auto& f : writes)
+          wait_tile(f);
+        for (auto& f : window_writes)
+          wait_tile(f);
+
+        writes.clear();
+
+        for (auto i = size_type(0); i < n; ++i) {
+          row_reads[i] = read_tile(matrix, run_config, m, i, run_config.row[i]);
+          if (i != m)
+            col_reads[i] = read_tile(matrix, run_config, i, m, run_config.col[i]);
+        }
+
+        auto& mm = run_config.row[m];
+
+        wait_tile(row_reads[m]);
+        {
+          SCOPE_MEASURE_MILLISECONDS("DIAG");
+          calculate_block(mm, mm, mm);
+        }
+
+        for (auto i = size_type(0); i < n; ++i) {
+          if (i != m) {
+            auto& im = run_config.col[i];
+            auto& mi = run_config.row[i];
+
+            auto& im_read = col_reads[i];
+            auto& mi_read = row_reads[i];
+
+#ifdef _OPENMP
+  #pragma omp task untied default(none) shared(im, mm, im_read)
+#endif
+            {
+              wait_tile(im_read);
+
+              SCOPE_MEASURE_MILLISECONDS("VERT");
+              calculate_block(im, im, mm);
+            }
+
+#ifdef _OPENMP
+  #pragma omp task untied default(none) shared(mi, mm, mi_read)
+#endif
+            {
+              wait_tile(mi_read);
+
+              SCOPE_MEASURE_MILLISECONDS("HORZ");
+              calculate_block(mi, mm, mi);
+            }
+          }
+        }
+#ifdef _OPENMP
+  #pragma omp taskwait
+#endif
+        // The row and column aren't modified by the peripheral tiles and
+        // therefore can be written while peripheral tiles are computed
+        //
+        for (auto i = size_type(0); i < n; ++i) {
+          writes.push_back(write_tile(matrix, run_config, m, i, run_config.row[i]));
+          if (i != m)
+            writes.push_back(write_tile(matrix, run_config, i, m, run_config.col[i]));
+        }
+
+        peripheral.clear();
+        for (auto i = size_type(0); i < n; ++i)
+          if (i != m)
+            for (auto j = size_type(0); j < n; ++j)
+              if (j != m)
+                peripheral.emplace_back(i, j);
+
+        const auto batches = (peripheral.size() + w - size_type(1)) / w;
+
+        if (batches != size_type(0))
+          read_window(matrix, run_config, peripheral, size_type(0), window_reads, window_writes);
+
+        for (auto c = size_type(0); c < batches; ++c) {
+          if (c + size_type(1) < batches)
+            read_window(matrix, run_config, peripheral, c + size_type(1), window_reads, window_writes);
+
+          const auto s = (c % size_type(3)) * w;
+          const auto f = c * w;
+          const auto e = (std::min)(f + w, size_type(peripheral.size()));
+
+          for (auto t = f; t < e; ++t)
+            wait_tile(window_reads[s + t - f]);
+
+          for (auto t = f; t < e; ++t) {
+            auto& ij = run_config.window[s + t - f];
+            auto& im = run_config.col[peripheral[t].first];
+            auto& mj = run_config.row[peripheral[t].second];
+
+#ifdef _OPENMP
+  #pragma omp task untied default(none) shared(ij, im, mj)
+#endif
+            {
+              SCOPE_MEASURE_MILLISECONDS("PERH");
+              calculate_block(ij, im, mj);
+            }
+          }
+#ifdef _OPENMP
+  #pragma omp taskwait
+#endif
+          for (auto t = f; t < e; ++t)
+            window_writes[s + t - f] = write_tile(matrix, run_config, peripheral[t].first, peripheral[t].second, run_config.window[s + t - f]);
+        }
+      }
+    }
+  }
+
+  for (auto& f : writes)
+    wait_tile(f);
+  for (auto& f : window_writes)
+    wait_tile(f);
+};
+
+// The same phases as in blocked Floyd-Warshall, tiles of the file are read
+// and written the same way as blocks of the matrix are loaded and stored
+//
+::utilz::roofline::counters
+roofline(
+  matrix_type& matrix)
+{
+  using value_type = typename utzmx::traits::matrix_traits<matrix_type>::value_type;
+
+  return ::utilz::roofline::count_blocks<value_type>(uint64_t(matrix.size() * matrix.tile_size()), uint64_t(matrix.tile_size()));
+};
@@ -0,0 +1,418 @@
+#pragma once
+
+#define APSP_ALG_MATRIX_FLAT
+
+#define APSP_ALG_ACCESS_FLAT
+
+#define APSP_ALG_RUN_CONFIGURATION
+
+#define APSP_ALG_ROOFLINE
+
+#include "portables/hacks/defines.h"
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+#include "constants.hpp"
+#include "measure.hpp"
+#include "memory.hpp"
+#include "graphs-components.hpp"
+#include "roofline.hpp"
+
+#include "matrix.hpp"
+#include "matrix-access.hpp"
+#include "matrix-stride.hpp"
+
+// Floyd-Warshall over condensation of the graph. The algorithm:
+//
+// 1. Finds strongly connected components (SCC) of the graph and reorders
+//    vertexes in topological order of components, which makes the matrix
+//    block upper triangular (there are no edges to preceding components).
+// 2. Computes closure of every component independently (in parallel).
+// 3. Computes distances between components in reverse topological order:
+//
+//    D(a, b) = D(a, a) x min(E(a, c) x D(c, b))
+//
+//    where `c` is a successor of `a` in condensation graph, `b` is reachable
+//    from `c` and `E` are edges of the original graph. Blocks of components,
+//    which aren't reachable from each other, are never touched.
+//
+
+namespace utzmx = ::utilz::matrices;
+namespace utzgc = ::utilz::graphs::components;
+
+template<typename S>
+struct run_configuration;
+
+using matrix_type            = utzmx::square_matrix<g_type, g_allocator_type<g_type>>;
+using matrix_access_type     = utzmx::access::matrix_access<utzmx::access::matrix_access_schema_flat, matrix_type>;
+using matrix_params_type     = utzmx::access::matrix_params<matrix_type>;
+using matrix_run_config_type = run_configuration<matrix_type>;
+
+template<typename S>
+struct run_configuration
+{
+  // A copy of the matrix with vertexes reordered by components
+  //
+  S scratch;
+};
+
+// Floyd-Warshall closure of `m * m` sub-matrix `x` with a row stride `ld`
+//
+template<typename T>
+void
+calculate_component(
+  T*     x,
+  size_t m,
+  size_t ld)
+{
+  for (auto k = size_t(0); k < m; ++k) {
+    const auto k_row = x + k * ld;
+    for (auto i = size_t(0); i < m; ++i) {
+      const auto i_row = x + i * ld;
+      const auto ik    = i_row[k];
+
+      __hack_ivdep
+      for (auto j = size_t(0); j < m; ++j)
+        i_row[j] = (std::min)(i_row[j], ik + k_row[j]);
+    }
+  }
+};
+
+// Relaxes `m * p` sub-matrix `x` through `m * q` sub-matrix `y` (`x = y * x`)
+// with a row stride `ld`. The `y` has to be a closure (which allows to
+// relax `x` in place)
+//
+template<typename T>
+void
+calculate_closed(
+  T*       x,
+  const T* y,
+  size_t   m,
+  size_t   p,
+  size_t   ld)
+{
+  for (auto k = size_t(0); k < m; ++k) {
+    const auto k_row = x + k * ld;
+    for (auto i = size_t(0); i < m; ++i) {
+      const auto i_row = x + i * ld;
+      const auto ik    = y[i * ld + k];
+
+      __hack_ivdep
+      for (auto j = size_t(0); j < p; ++j)
+        i_row[j] = (std::min)(i_row[j], ik + k_row[j]);
+    }
+  }
+};
+
+// Condensation of the graph: vertexes ordered by components (in topological
+// order of components), positions of the first vertex of every component,
+// successors of every component and reachability of components
+//
+template<typename S>
+struct condensation
+{
+  S                           count;
+  std::vector<S>              starts;
+  std::vector<S>              order;
+  std::vector<std::vector<S>> successors;
+  std::vector<unsigned char>  reach;
+};
+
+condensation<typename utzmx::traits::matrix_traits<matrix_type>::size_type>
+condense(
+  matrix_type& matrix)
+{
+  using size_type  = typename utzmx::traits::matrix_traits<matrix_type>::size_type;
+  using value_type = typename utzmx::traits::matrix_traits<matrix_type>::value_type;
+
+  const auto n = matrix.size();
+
+  const auto infinity = ::utilz::constants::infinity<value_type>();
+
+  size_type              count;
+  std::vector<size_type> component;
+
+  std::tie(count, component) = utzgc::strongly_connected_components(
+    n,
+    [&matrix, infinity](size_type v, size_type w) -> bool {
+      return matrix.at(v, w) < infinity;
+    });
+
+  // Order vertexes by components, `starts` contains positions of the first
+  // vertex of every component
+  //
+  std::vector<size_type> starts(count + size_type(1), size_type(0));
+  std::vector<size_type> order(n);
+
+  for (auto v = size_type(0); v < n; ++v)
+    ++starts[component[v] + size_type(1)];
+
+  for (auto c = size_type(0); c < count; ++c)
+    starts[c + size_type(1)] += starts[c];
+
+  {
+    std::vector<size_type> positions(starts.begin(), starts.end() - 1);
+    for (auto v = size_type(0); v < n; ++v)
+      order[positions[component[v]]++] = v;
+  }
+
+  // Build condensation graph and its reachability (components are already
+  // in topological order, so reachability of a component is built from
+  // reachability of its successors)
+  //
+  std::vector<std::vector<size_type>> successors(count);
+  std::vector<unsigned char>          reach(count * count, (unsigned char)(0));
+
+  {
+    std::vector<size_type> marker(count, count);
+    for (auto c = size_type(0); c < count; ++c) {
+      for (auto x = starts[c]; x < starts[c + size_type(1)]; ++x) {
+        const auto v = order[x];
+        for (auto w = size_type(0); w < n; ++w) {
+          const auto d = component[w];
+          if (d != c && marker[d] != c && matrix.at(v, w) < infinity) {
+            marker[d] = c;
+            successors[c].push_back(d);
+          }
+        }
+      }
+    }
+  }
+
+  for (auto a = count; a-- > size_type(0);) {
+    for (auto c : successors[a]) {
+      reach[a * count + c] = 1;
+      for (auto b = c + size_type(1); b < count; ++b)
+        reach[a * count + b] |= reach[c * count + b];
+    }
+  }
+
+
+  return condensation<size_type>{ count, std::move(starts), std::move(order), std::move(successors), std::move(reach) };
+};
+
+// Returns sizes (in bytes) of allocations made by `up` (in the order they are
+// made) for a graph of `vertices`
+//
+std::vector<size_t>
+required_bytes(
+  matrix_params_type& params,
+  size_t              vertices)
+{
+  using value_type = typename utzmx::traits::matrix_traits<matrix_type>::value_type;
+
+  if (vertices == size_t(0))
+    return std::vector<size_t>();
+
+  return std::vector<size_t>{ vertices * utzmx::stride::leading_dimension<value_type>(vertices) * sizeof(value_type) };
+};
+
+__hack_noinline
+void
+up(
+  matrix_type&             matrix,
+  matrix_access_type&      matrix_access,
+  matrix_run_config_type&  run_config,
+  ::utilz::memory::buffer& b)
+{
+  run_config.scratch = matrix_type(matrix.size(), matrix.stride(), g_allocator_type<g_type>(&b));
+};
+
+__hack_noinline
+void
+down(
+  matrix_type&             matrix,
+  matrix_access_type&      matrix_access,
+  matrix_run_config_type&  run_config,
+  ::utilz::memory::buffer& b)
+{
+  run_config.scratch = matrix_type();
+};
+
+__hack_noinline
+void
+run(
+  matrix_type&            matrix,
+  matrix_run_config_type& run_config)
+{
+  using size_type  = typename utzmx::traits::matrix_traits<matrix_type>::size_type;
+  using value_type = typename utzmx::traits::matrix_traits<matrix_type>::value_type;
+
+  const auto n = matrix.size();
+  if (n == size_type(0))
+    return;
+
+  const auto ld = run_config.scratch.stride();
+
+  const auto infinity = ::utilz::constants::infinity<value_type>();
+
+  auto& scratch = run_config.scratch;
+
+  const auto condensed = condense(matrix);
+
+  const auto  count      = condensed.count;
+  const auto& starts     = condensed.starts;
+  const auto& order      = condensed.order;
+  const auto& successors = condensed.successors;
+  const auto& reach      = condensed.reach;
+
+  for (auto x = size_type(0); x < n; ++x)
+    for (auto y = size_type(0); y < n; ++y)
+      scratch.at(x, y) = matrix.at(order[x], order[y]);
+
+#ifdef _OPENMP
+  #pragma omp parallel default(none) shared(matrix, scratch, starts, order, successors, reach) firstprivate(ld, count, infinity)
+#endif
+  {
+#ifdef _OPENMP
+  #pragma omp single
+#endif
+    {
+      for (auto c = size_type(0); c < count; ++c) {
+        auto x = &scratch.at(starts[c], starts[c]);
+        auto m = starts[c + size_type(1)] - starts[c];
+
+#ifdef _OPENMP
+  #pragma omp task untied default(none) firstprivate(x, m, ld)
+#endif
+        {
+          SCOPE_MEASURE_MILLISECONDS("DIAG");
+          calculate_component(x, m, ld);
+        }
+      }
+#ifdef _OPENMP
+  #pragma omp taskwait
+#endif
+      for (auto a = count; a-- > size_type(0);) {
+        for (auto b = a + size_type(1); b < count; ++b) {
+          if (!reach[a * count + b])
+            continue;
+
+#ifdef _OPENMP
+  #pragma omp task untied default(none) shared(matrix, scratch, starts, order, successors, reach) firstprivate(a, b, ld, count, infinity)
+#endif
+          {
+            SCOPE_MEASURE_MILLISECONDS("PERH");
+
+            const auto a_start = starts[a];
+            const auto a_size  = starts[a + size_type(1)] - a_start;
+            const auto b_start = starts[b];
+            const auto b_size  = starts[b + size_type(1)] - b_start;
+
+            auto x = &scratch.at(a_start, b_start);
+
+            // Edges are taken from the original matrix, because the blocks
+            // of `a` in the scratch are being updated in parallel
+            //
+            for (auto c : successors[a]) {
+              if (c != b && !reach[c * count + b])
+                continue;
+
+              const auto c_start = starts[c];
+              const auto c_size  = starts[c + size_type(1)] - c_start;
+
+              for (auto i = size_type(0); i < a_size; ++i) {
+                const auto i_row = x + i * ld;
+                for (auto k = size_type(0); k < c_size; ++k) {
+                  const auto ik = matrix.at(order[a_start + i], order[c_start + k]);
+                  if (ik >= infinity)
+                    continue;
+
+                  const auto k_row = &scratch.at(c_start + k, b_start);
+
+                  __hack_ivdep
+                  for (auto j = size_type(0); j < b_size; ++j)
+                    i_row[j] = (std::min)(i_row[j], ik + k_row[j]);
+                }
+              }
+            }
+
+            calculate_closed(x, &scratch.at(a_start, a_start), a_size, b_size, ld);
+          }
+        }
+#ifdef _OPENMP
+  #pragma omp taskwait
+#endif
+      }
+    }
+  }
+
+  for (auto x = size_type(0); x < n; ++x)
+    for (auto y = size_type(0); y < n; ++y)
+      matrix.at(order[x], order[y]) = scratch.at(x, y);
+};
+
+// Only closures of components and blocks of reachable components are
+// relaxed, blocks between components are relaxed only through the edges
+// leaving the component (while closures are loaded and stored once). The
+// matrix is loaded and stored twice more to reorder it by components.
+//
+::utilz::roofline::counters
+roofline(
+  matrix_type& matrix)
+{
+  using size_type  = typename utzmx::traits::matrix_traits<matrix_type>::size_type;
+  using value_type = typename utzmx::traits::matrix_traits<matrix_type>::value_type;
+
+  const auto n = matrix.size();
+  const auto s = uint64_t(sizeof(value_type));
+
+  const auto infinity = ::utilz::constants::infinity<value_type>();
+
+  const auto condensed = condense(matrix);
+
+  const auto  count  = condensed.count;
+  const auto& starts = condensed.starts;
+  const auto& order  = condensed.order;
+  const auto& reach  = condensed.reach;
+
+  // Number of edges between every pair of components
+  //
+  std::vector<uint64_t> edges(count * count, uint64_t(0));
+  for (auto a = size_type(0); a < count; ++a)
+    for (auto c = a + size_type(1); c < count; ++c)
+      if (reach[a * count + c])
+        for (auto i = starts[a]; i < starts[a + size_type(1)]; ++i)
+          for (auto k = starts[c]; k < starts[c + size_type(1)]; ++k)
+            if (matrix.at(order[i], order[k]) < infinity)
+              ++edges[a * count + c];
+
+  ::utilz::roofline::counters counters = {
+    { "COPY", ::utilz::roofline::phase{ 0, uint64_t(4) * uint64_t(n) * uint64_t(n) * s } },
+    { "DIAG", ::utilz::roofline::phase{ 0, 0 } },
+    { "PERH", ::utilz::roofline::phase{ 0, 0 } }
+  };
+
+  for (auto a = size_type(0); a < count; ++a) {
+    const auto a_size = uint64_t(starts[a + size_type(1)] - starts[a]);
+
+    counters["DIAG"].relaxations += a_size * a_size * a_size;
+    counters["DIAG"].bytes       += a_size * a_size * s * uint64_t(2);
+
+    for (auto b = a + size_type(1); b < count; ++b) {
+      if (!reach[a * count + b])
+        continue;
+
+      const auto b_size = uint64_t(starts[b + size_type(1)] - starts[b]);
+
+      for (auto c : condensed.successors[a]) {
+        if (c != b && !reach[c * count + b])
+          continue;
+
+        const auto c_size = uint64_t(starts[c + size_type(1)] - starts[c]);
+
+        counters["PERH"].relaxations += edges[a * count + c] * b_size;
+        counters["PERH"].bytes       += (a_size * c_size + edges[a * count + c] * b_size) * s;
+      }
+
+      counters["PERH"].relaxations += a_size * a_size * b_size;
+      counters["PERH"].bytes       += (a_size * b_size * uint64_t(2) + a_size * a_size) * s;
+    }
+  }
+
+  ::utilz::roofline::limit_to_footprint(counters, uint64_t(2) * uint64_t(n) * uint64_t(n) * s);
+
+  return counters;
+};
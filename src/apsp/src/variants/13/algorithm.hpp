@@ -0,0 +1,194 @@
+#pragma once
+
+#define APSP_ALG_MATRIX_FLAT
+
+#define APSP_ALG_ACCESS_FLAT
+
+#define APSP_ALG_ROOFLINE
+
+#include "portables/hacks/defines.h"
+
+#include <algorithm>
+#include <tuple>
+
+#include "measure.hpp"
+
+#include "matrix.hpp"
+#include "matrix-access.hpp"
+#include "matrix-layout.hpp"
+#include "matrix-stride.hpp"
+#include "roofline.hpp"
+
+#include "01/kernel.hpp"
+
+// Blocked Floyd-Warshall (the same schedule and kernel as in 01), which runs
+// directly on a flat matrix. Blocks are views of the matrix (see `tile_view`),
+// so the matrix is never copied. The size of blocks is chosen to fit three of
+// them into L1 cache.
+//
+// When there is a block size (close to the preferred one) which divides the
+// size of the matrix, the matrix is converted to 'tiled' layout in place before
+// the calculation (so every block is contiguous) and back to 'flat' layout after
+// it (see `relayout`). Otherwise blocks are views of the flat matrix and the last
+// row and column of blocks are smaller.
+//
+
+namespace utzmx = ::utilz::matrices;
+namespace utzst = ::utilz::matrices::stride;
+namespace utzly = ::utilz::matrices::layout;
+
+using matrix_type            = utzmx::square_matrix<g_type, g_allocator_type<g_type>>;
+using matrix_access_type     = utzmx::access::matrix_access<utzmx::access::matrix_access_schema_flat, matrix_type>;
+using matrix_params_type     = utzmx::access::matrix_params<matrix_type>;
+using matrix_view_type       = utzmx::tile_view<g_type>;
+
+// Returns the size of blocks for a matrix of size `n` and whether the matrix
+// is converted to 'tiled' layout. It prefers a block size which divides the
+// size of the matrix (but isn't less than a half of the preferred one).
+//
+template<typename S>
+std::tuple<S, bool>
+block_size_of(
+  S n)
+{
+  const auto preferred  = (std::min)(n, S(utzst::tile_size<g_type>()));
+  auto       block_size = preferred;
+  while (block_size > preferred / S(2) && n % block_size != S(0))
+    --block_size;
+
+  const auto tiled = n % block_size == S(0);
+  if (!tiled)
+    block_size = preferred;
+
+  return std::make_tuple(block_size, tiled);
+};
+
+__hack_noinline
+void
+run(
+  matrix_type& matrix)
+{
+  using size_type = typename utzmx::traits::matrix_traits<matrix_type>::size_type;
+
+  const auto n = matrix.size();
+  if (n == size_type(0))
+    return;
+
+  size_type block_size;
+  bool      tiled;
+
+  std::tie(block_size, tiled) = block_size_of(n);
+
+  const auto blocks = (n + block_size - size_type(1)) / block_size;
+
+  if (tiled)
+    utzly::relayout(matrix, block_size, utzly::matrix_layout_flat, utzly::matrix_layout_tiled);
+
+  auto data = matrix.at(0);
+  auto view = [&matrix, data, n, blocks, block_size, tiled](size_type ib, size_type jb) -> matrix_view_type {
+    const auto i = ib * block_size;
+    const auto j = jb * block_size;
+    if (tiled)
+      return matrix_view_type(data + (ib * blocks + jb) * block_size * block_size, i, j, block_size, block_size, block_size);
+
+    return utzmx::make_tile_view(matrix, i, j, (std::min)(block_size, n - i), (std::min)(block_size, n - j));
+  };
+
+#ifdef _OPENMP
+  #pragma omp parallel default(none) shared(view) firstprivate(blocks)
+#endif
+  {
+#ifdef _OPENMP
+  #pragma omp single
+#endif
+    {
+      for (auto m = size_type(0); m < blocks; ++m) {
+        auto mm = view(m, m);
+
+        {
+          SCOPE_MEASURE_MILLISECONDS("DIAG");
+          calculate_block(mm, mm, mm);
+        }
+
+        for (auto i = size_type(0); i < blocks; ++i) {
+          if (i != m) {
+            auto im = view(i, m);
+            auto mi = view(m, i);
+
+#ifdef _OPENMP
+  #pragma omp task untied default(none) firstprivate(im, mm)
+#endif
+            {
+              SCOPE_MEASURE_MILLISECONDS("VERT");
+              calculate_block(im, im, mm);
+            }
+
+#ifdef _OPENMP
+  #pragma omp task untied default(none) firstprivate(mi, mm)
+#endif
+            {
+              SCOPE_MEASURE_MILLISECONDS("HORZ");
+              calculate_block(mi, mm, mi);
+            }
+          }
+        }
+#ifdef _OPENMP
+  #pragma omp taskwait
+#endif
+        for (auto i = size_type(0); i < blocks; ++i) {
+          if (i != m) {
+            auto im = view(i, m);
+            for (auto j = size_type(0); j < blocks; ++j) {
+              if (j != m) {
+                auto ij = view(i, j);
+                auto mj = view(m, j);
+
+#ifdef _OPENMP
+  #pragma omp task untied default(none) firstprivate(ij, im, mj)
+#endif
+                {
+                  SCOPE_MEASURE_MILLISECONDS("PERH");
+                  calculate_block(ij, im, mj);
+                }
+              }
+            }
+          }
+        }
+#ifdef _OPENMP
+  #pragma omp taskwait
+#endif
+      }
+    }
+  }
+
+  if (tiled)
+    utzly::relayout(matrix, block_size, utzly::matrix_layout_tiled, utzly::matrix_layout_flat);
+};
+
+// The same phases as in blocked Floyd-Warshall plus conversion of the matrix
+// to 'tiled' layout and back (each of them loads and stores the matrix)
+//
+::utilz::roofline::counters
+roofline(
+  matrix_type& matrix)
+{
+  using size_type  = typename utzmx::traits::matrix_traits<matrix_type>::size_type;
+  using value_type = typename utzmx::traits::matrix_traits<matrix_type>::value_type;
+
+  const auto n = matrix.size();
+  if (n == size_type(0))
+    return ::utilz::roofline::counters();
+
+  size_type block_size;
+  bool      tiled;
+
+  std::tie(block_size, tiled) = block_size_of(n);
+
+  auto counters = ::utilz::roofline::count_blocks<value_type>(uint64_t(n), uint64_t(block_size));
+  if (tiled)
+    counters["RLAY"] = ::utilz::roofline::phase{ 0, uint64_t(4) * uint64_t(n) * uint64_t(n) * uint64_t(sizeof(value_type)) };
+
+  ::utilz::roofline::limit_to_footprint(counters, uint64_t(n) * uint64_t(n) * uint64_t(sizeof(value_type)));
+
+  return counters;
+};
@@ -5,6 +5,7 @@
 #include "matrix-traits.hpp"
 #include "matrix-access.hpp"
 #include "matrix-manip.hpp"
+#include "roofline.hpp"
 
 // Define global types
 //
@@ -33,7 +34,8 @@ using schema_value = matrix_access_type::schema_value;
 
 using size_type               = typename ::utilz::matrices::traits::matrix_traits<matrix_type>::size_type;
 using value_type              = typename ::utilz::matrices::traits::matrix_traits<matrix_type>::value_type;
-using graph_type              = typename std::tuple<size_type, std::vector<std::tuple<size_type, size_type, value_type>>>;
+using edges_type              = typename ::utilz::graphs::edges_container<size_type, value_type>;
+using graph_type              = typename std::tuple<size_type, edges_type>;
 using communities_type        = typename std::map<size_type, std::vector<size_type>>;
 using graph_format_type       = ::utilz::graphs::io::graph_format;
 using communities_format_type = ::utilz::communities::io::communities_format;
@@ -76,3 +78,46 @@ using matrix_arrange_procedure_type = ::utilz::matrices::procedures::matrix_arra
     #define SHELL_RUN(matrix, matrix_clusters, matrix_run_config) (void)matrix_run_config; run(matrix, matrix_clusters)
   #endif
 #endif
+
+#ifdef APSP_ALG_MATRIX_FLAT
+  #ifdef APSP_ALG_ROOFLINE
+    #define SHELL_ROOFLINE(matrix, matrix_clusters) roofline(matrix); (void)matrix_clusters
+  #else
+    #define SHELL_ROOFLINE(matrix, matrix_clusters) ::utilz::roofline::count(matrix); (void)matrix_clusters
+  #endif
+#endif
+#ifdef APSP_ALG_MATRIX_BLOCKS
+  #ifdef APSP_ALG_ROOFLINE
+    #define SHELL_ROOFLINE(matrix, matrix_clusters) roofline(matrix); (void)matrix_clusters
+  #else
+    #define SHELL_ROOFLINE(matrix, matrix_clusters) ::utilz::roofline::count(matrix); (void)matrix_clusters
+  #endif
+#endif
+#ifdef APSP_ALG_MATRIX_CLUSTERS
+  #define SHELL_ROOFLINE(matrix, matrix_clusters) roofline(matrix, matrix_clusters)
+#endif
+
+// Variants which allocate memory in `up` report it through `required_bytes`,
+// while the rest (including variants which don't allocate from the buffer)
+// fall back to an empty list
+//
+template<typename P>
+  requires requires(P& params, size_t vertices) { required_bytes(params, vertices); }
+std::vector<size_t>
+shell_required_bytes(
+  P&     params,
+  size_t vertices)
+{
+  return required_bytes(params, vertices);
+};
+
+template<typename P>
+std::vector<size_t>
+shell_required_bytes(
+  P&     params,
+  size_t vertices)
+{
+  return std::vector<size_t>();
+};
+
+#define SHELL_REQUIRED_BYTES(matrix_params, vertices) shell_required_bytes(matrix_params, vertices)
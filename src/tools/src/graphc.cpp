@@ -25,14 +25,18 @@
 #endif
 
 #include "graphs-io.hpp"
+#include "graphs-edges.hpp"
+#include "graphs-ordering.hpp"
 
 namespace utzgio = ::utilz::graphs::io;
+namespace utzgor = ::utilz::graphs::ordering;
 
 // Major type definitions
 //
 using Index = long;
 using Value = long;
 using Tuple = std::tuple<Index, Index, Value>;
+using Edges = ::utilz::graphs::edges_container<Index, Value>;
 
 // This is a tiny program which converts graphs to a different formats
 //
@@ -42,6 +46,10 @@ main(int argc, char* argv[])
   utzgio::graph_format opt_input_format  = utzgio::graph_format::graph_fmt_none;
   utzgio::graph_format opt_output_format = utzgio::graph_format::graph_fmt_none;
 
+  utzgor::graph_ordering opt_ordering = utzgor::graph_ordering::graph_ord_none;
+
+  bool opt_compact = false;
+
   std::string opt_input;
   std::string opt_output;
 
@@ -60,8 +68,17 @@ main(int argc, char* argv[])
   //    - 'dimacs'
   //    - 'weightlist'
   //    - 'binary'
+  // l: <enum>, relabel vertexes to concentrate edges near the diagonal
+  //    Supported values
+  //    - 'bfs'
+  //    - 'rcm'
+  //    - 'degree'
+  // m: compact vertexes into a dense range, original vertex of every new one
+  //    is written to '<output>.ids' file (as 'new original' lines). Isolated
+  //    vertexes (ex. declared by a DIMACS 'p' line, but without edges) are
+  //    dropped
   //
-  const char* options = "g:G:o:O:";
+  const char* options = "g:G:o:O:l:m";
 
   std::cerr << "Options:\n";
 
@@ -110,6 +127,27 @@ main(int argc, char* argv[])
         }
         std::cerr << "erro: unexpected '-O' option detected" << '\n';
         return 1;
+      case 'l':
+        if (opt_ordering == utzgor::graph_ordering::graph_ord_none) {
+          std::cerr << "-l: " << optarg << "\n";
+
+          if (!utzgor::parse_graph_ordering(optarg, opt_ordering)) {
+            std::cerr << "erro: invalid graph ordering has been detected in '-l' option" << '\n';
+            return 1;
+          }
+          break;
+        }
+        std::cerr << "erro: unexpected '-l' option detected" << '\n';
+        return 1;
+      case 'm':
+        if (!opt_compact) {
+          std::cerr << "-m: true\n";
+
+          opt_compact = true;
+          break;
+        }
+        std::cerr << "erro: unexpected '-m' option detected" << '\n';
+        return 1;
     }
   }
   if (opt_input.empty()) {
@@ -147,7 +185,42 @@ main(int argc, char* argv[])
 
   // Scan graph (from one format)
   //
-  auto [vc, edges] = utzgio::scan_graph<Index, Value>(opt_input_format, input_stream);
+  auto [vc, edges] = utzgio::scan_graph<Index, Value, Edges>(opt_input_format, input_stream);
+
+  // Compact vertexes (if requested)
+  //
+  std::vector<Index> ids;
+  if (opt_compact)
+    ids = utzgor::compact_graph(vc, edges);
+
+  // Relabel vertexes (if requested)
+  //
+  if (opt_ordering != utzgor::graph_ordering::graph_ord_none) {
+    auto labels = utzgor::order_graph(opt_ordering, vc, edges);
+
+    utzgor::relabel_graph(labels, edges);
+
+    if (opt_compact) {
+      std::vector<Index> relabelled_ids(ids.size());
+      for (auto v = size_t(0); v < ids.size(); ++v)
+        relabelled_ids[labels[v]] = ids[v];
+
+      ids = std::move(relabelled_ids);
+    }
+  }
+
+  // Store original vertexes alongside the output
+  //
+  if (opt_compact) {
+    std::ofstream ids_stream(opt_output + ".ids");
+    if (!ids_stream.is_open()) {
+      std::cerr << "erro: can't open ids file (denoted by -o option)";
+      return 1;
+    }
+
+    for (auto v = size_t(0); v < ids.size(); ++v)
+      ids_stream << v << ' ' << ids[v] << '\n';
+  }
 
   // Print graph (to another format)
   //